@@ -0,0 +1,118 @@
+//
+//  AudioQueue.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 12/09/2017.
+//  Copyright © 2017 71Squared Ltd. All rights reserved.
+//
+
+#include "AudioQueue.hpp"
+#include <algorithm>
+#include <cstring>
+
+// Drift control gains and the largest change allowed to the sample rate. 0.5% is well below an audible pitch change
+static const double cDRIFT_PROPORTIONAL = 0.002;
+static const double cDRIFT_INTEGRAL = 0.00001;
+static const double cDRIFT_MAX_ADJUST = 0.005;
+
+// ------------------------------------------------------------------------------------------------------------
+// - Audio Queue
+
+AudioQueue::AudioQueue(uint32_t capacity)
+{
+    audioQueueBufferCapacity = 1;
+    while (audioQueueBufferCapacity < capacity)
+    {
+        audioQueueBufferCapacity <<= 1;
+    }
+    audioQueueBufferMask = audioQueueBufferCapacity - 1;
+    audioQueueBuffer.assign(audioQueueBufferCapacity, 0);
+    audioQueueBufferWritten = 0;
+    audioQueueBufferRead = 0;
+    audioQueueTargetLevel = audioQueueBufferCapacity / 2;
+    audioQueueDriftIntegral = 0;
+}
+
+AudioQueue::~AudioQueue()
+{
+}
+
+// Write the supplied number of samples into the queues buffer from the supplied buffer pointer
+uint32_t AudioQueue::write(const int16_t *buffer, uint32_t count)
+{
+    if (!buffer)
+    {
+        return 0;
+    }
+    
+    // Acquire the read position so the consumer has finished with the space before it is overwritten
+    const uint32_t written = audioQueueBufferWritten.load(std::memory_order_relaxed);
+    const uint32_t read = audioQueueBufferRead.load(std::memory_order_acquire);
+    
+    count = std::min(count, audioQueueBufferCapacity - (written - read));
+    
+    const uint32_t i = written & audioQueueBufferMask;
+    const uint32_t first = std::min(count, audioQueueBufferCapacity - i);
+    
+    memcpy(audioQueueBuffer.data() + i, buffer, first * sizeof(int16_t));
+    memcpy(audioQueueBuffer.data(), buffer + first, (count - first) * sizeof(int16_t));
+    
+    // Release so the consumer sees the samples before the new write position
+    audioQueueBufferWritten.store(written + count, std::memory_order_release);
+    
+    return count;
+}
+
+// Read the supplied number of samples from the queues buffer into the supplied buffer pointer
+uint32_t AudioQueue::read(int16_t *buffer, uint32_t count)
+{
+    const uint32_t read = audioQueueBufferRead.load(std::memory_order_relaxed);
+    const uint32_t written = audioQueueBufferWritten.load(std::memory_order_acquire);
+    
+    const uint32_t available = std::min(count, written - read);
+    
+    const uint32_t i = read & audioQueueBufferMask;
+    const uint32_t first = std::min(available, audioQueueBufferCapacity - i);
+    
+    memcpy(buffer, audioQueueBuffer.data() + i, first * sizeof(int16_t));
+    memcpy(buffer + first, audioQueueBuffer.data(), (available - first) * sizeof(int16_t));
+    
+    // An underrun plays silence rather than whatever was left in the host's buffer
+    std::fill(buffer + available, buffer + count, 0);
+    
+    audioQueueBufferRead.store(read + available, std::memory_order_release);
+    
+    return available;
+}
+
+// Return the number of used samples in the buffer
+int AudioQueue::bufferUsed()
+{
+    return static_cast<int>(audioQueueBufferWritten.load(std::memory_order_acquire) - audioQueueBufferRead.load(std::memory_order_acquire));
+}
+
+// Return the number of samples that can be written before the buffer is full
+uint32_t AudioQueue::bufferSpace()
+{
+    return audioQueueBufferCapacity - static_cast<uint32_t>(bufferUsed());
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Drift Control
+
+void AudioQueue::setTargetLevel(uint32_t samples)
+{
+    audioQueueTargetLevel = std::max(1u, std::min(samples, audioQueueBufferCapacity));
+    audioQueueDriftIntegral = 0;
+}
+
+double AudioQueue::rateAdjustment()
+{
+    // Proportional-integral control on the fill level error. The proportional part reacts to jitter in when frames
+    // are produced, while the integral part settles on the steady difference between the two clocks
+    const double error = (static_cast<double>(audioQueueTargetLevel) - bufferUsed()) / audioQueueTargetLevel;
+    
+    audioQueueDriftIntegral = std::max(-cDRIFT_MAX_ADJUST, std::min(cDRIFT_MAX_ADJUST, audioQueueDriftIntegral + error * cDRIFT_INTEGRAL));
+    
+    return 1.0 + std::max(-cDRIFT_MAX_ADJUST, std::min(cDRIFT_MAX_ADJUST, error * cDRIFT_PROPORTIONAL + audioQueueDriftIntegral));
+}
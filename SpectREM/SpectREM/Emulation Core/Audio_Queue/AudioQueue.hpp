@@ -0,0 +1,58 @@
+//
+//  AudioQueue.hpp
+//  SpectREM
+//
+//  Created by Michael Daley on 12/09/2017.
+//  Copyright © 2017 71Squared Ltd. All rights reserved.
+//
+
+#ifndef AudioQueue_hpp
+#define AudioQueue_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Lock-free ring of interleaved samples between one producer, the thread generating frames, and one consumer, the
+// host audio callback. Neither side ever waits on the other
+class AudioQueue
+{
+
+public:
+    // Capacity is in samples and is rounded up to a power of two
+    AudioQueue(uint32_t capacity = 1 << 15);
+    ~AudioQueue();
+
+    // Producer. Returns the number of samples queued, which is less than count if the queue is full
+    uint32_t        write(const int16_t *buffer, uint32_t count);
+
+    // Consumer. Returns the number of samples read. Anything that couldn't be read is filled with silence
+    uint32_t        read(int16_t *buffer, uint32_t count);
+
+    // Fill level. Safe to call from either side
+    int             bufferUsed();
+    uint32_t        bufferSpace();
+    uint32_t        bufferCapacity() { return audioQueueBufferCapacity; }
+
+    // Drift control, producer side only. The producer and consumer clocks never match exactly, so the fill level slowly
+    // wanders. rateAdjustment returns a ratio a little above or below 1 to apply to the number of samples generated
+    // per frame that steers the fill level back to the target latency. It is meant to be called just after a frame has
+    // been written, so the target needs to cover a frame plus one host callback to avoid running dry
+    void            setTargetLevel(uint32_t samples);
+    double          rateAdjustment();
+
+private:
+    std::vector<int16_t>    audioQueueBuffer;
+    uint32_t                audioQueueBufferCapacity;
+    uint32_t                audioQueueBufferMask;
+
+    // Free running sample counts. Only the producer stores to written and only the consumer stores to read
+    std::atomic<uint32_t>   audioQueueBufferRead;
+    std::atomic<uint32_t>   audioQueueBufferWritten;
+
+    uint32_t                audioQueueTargetLevel;
+    double                  audioQueueDriftIntegral;
+
+};
+
+#endif /* AudioQueue_hpp */
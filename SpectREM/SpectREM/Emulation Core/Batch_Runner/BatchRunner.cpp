@@ -0,0 +1,211 @@
+//
+//  BatchRunner.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "BatchRunner.hpp"
+#include <algorithm>
+
+// Frames a machine is run for before its thread looks at the queues again. Long enough that taking a slice costs
+// nothing next to running it, short enough that the last machines of a batch get spread across the threads
+static const uint32_t cFRAMES_PER_SLICE = 50;
+
+// ------------------------------------------------------------------------------------------------------------
+// - Constructor/Deconstructor
+
+BatchRunner::BatchRunner(uint32_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        batchWorkers.push_back(std::make_unique<Worker>());
+    }
+    
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        batchThreads.emplace_back(&BatchRunner::workerLoop, this, i);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+BatchRunner::~BatchRunner()
+{
+    {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        batchStopping = true;
+    }
+    batchStarted.notify_all();
+    
+    for (std::thread &thread : batchThreads)
+    {
+        thread.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Run
+
+void BatchRunner::run(const std::vector<ZXSpectrum *> &machines, uint32_t frames, FrameCallback frameCallback)
+{
+    if (machines.empty() || frames == 0)
+    {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> runLock(batchRunMutex);
+    std::unique_lock<std::mutex> lock(batchMutex);
+    
+    batchMachines = &machines;
+    batchFrameCallback = frameCallback;
+    batchMachinesLeft = machines.size();
+    batchTasksQueued = machines.size();
+    
+    // Machines are dealt out to the threads in turn to start with, and move between them from then on
+    for (size_t i = 0; i < machines.size(); i++)
+    {
+        Worker &worker = *batchWorkers[ i % batchWorkers.size() ];
+        std::lock_guard<std::mutex> workerLock(worker.mutex);
+        worker.tasks.push_back(Task{ i, frames });
+    }
+    
+    batchWorkersActive = static_cast<uint32_t>(batchWorkers.size());
+    batchGeneration++;
+    batchStarted.notify_all();
+    
+    batchFinished.wait(lock, [this]{ return batchWorkersActive == 0; });
+    
+    batchMachines = nullptr;
+    batchFrameCallback = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Workers
+
+void BatchRunner::workerLoop(uint32_t worker)
+{
+    uint64_t generation = 0;
+    
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(batchMutex);
+            batchStarted.wait(lock, [&]{ return batchStopping || batchGeneration != generation; });
+            if (batchStopping)
+            {
+                return;
+            }
+            generation = batchGeneration;
+        }
+        
+        // A thread with nothing to take stays in the batch while machines are still running, as a slice it can take
+        // may yet be put back on another thread's queue
+        Task task;
+        while (batchMachinesLeft > 0)
+        {
+            if (takeTask(worker, task))
+            {
+                runTask(worker, task);
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(batchIdleMutex);
+                batchIdle.wait(lock, [this]{ return batchMachinesLeft == 0 || batchTasksQueued > 0; });
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(batchMutex);
+        if (--batchWorkersActive == 0)
+        {
+            batchFinished.notify_all();
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool BatchRunner::takeTask(uint32_t worker, Task &task)
+{
+    // The thread's own newest slice first, which is usually the machine it has just run
+    {
+        Worker &own = *batchWorkers[ worker ];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            batchTasksQueued--;
+            return true;
+        }
+    }
+    
+    // Otherwise the oldest slice of the next thread along that has one
+    for (size_t i = 1; i < batchWorkers.size(); i++)
+    {
+        Worker &victim = *batchWorkers[ ( worker + i ) % batchWorkers.size() ];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            batchTasksQueued--;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void BatchRunner::runTask(uint32_t worker, Task &task)
+{
+    ZXSpectrum *machine = (*batchMachines)[ task.index ];
+    uint32_t frames = std::min(task.framesLeft, cFRAMES_PER_SLICE);
+    bool keepRunning = true;
+    
+    while (frames > 0 && keepRunning)
+    {
+        machine->generateFrame();
+        if (batchFrameCallback)
+        {
+            keepRunning = batchFrameCallback(task.index, machine);
+        }
+        frames--;
+        task.framesLeft--;
+    }
+    
+    if (keepRunning && task.framesLeft > 0)
+    {
+        {
+            Worker &own = *batchWorkers[ worker ];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.tasks.push_back(task);
+            batchTasksQueued++;
+        }
+        wakeIdleWorkers();
+    }
+    else if (--batchMachinesLeft == 0)
+    {
+        wakeIdleWorkers();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void BatchRunner::wakeIdleWorkers()
+{
+    // Taking the lock means a thread that has just found nothing to take is either already waiting or will see the
+    // change when it checks, so the wake up can't be missed
+    {
+        std::lock_guard<std::mutex> lock(batchIdleMutex);
+    }
+    batchIdle.notify_all();
+}
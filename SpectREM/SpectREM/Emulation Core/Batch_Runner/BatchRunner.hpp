@@ -0,0 +1,88 @@
+//
+//  BatchRunner.hpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#ifndef BatchRunner_hpp
+#define BatchRunner_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ZXSpectrum.hpp"
+
+// Runs many independent machines at once on a pool of threads, one per core by default. Each machine is run a slice
+// of frames at a time. Every thread has its own queue of slices and carries on with the machine it just ran, and a
+// thread that runs out of work takes the oldest slice from another thread's queue, so machines that take longer than
+// others don't leave threads idle at the end of a batch
+class BatchRunner
+{
+    
+public:
+    // Called on the thread that ran the frame, after every frame a machine generates. Returning false stops that machine
+    typedef std::function<bool(size_t index, ZXSpectrum *machine)> FrameCallback;
+    
+    // A thread count of 0 uses one thread per core
+    BatchRunner(uint32_t threadCount = 0);
+    ~BatchRunner();
+    
+    uint32_t                getThreadCount() { return static_cast<uint32_t>(batchThreads.size()); }
+    
+    // Runs each machine for the given number of frames and returns once they have all finished. The machines must all
+    // be different and nothing else may use them until run returns. They are run as they are set up, so they should be
+    // resumed first, and made headless if their display isn't wanted. Batches from more than one thread are run one
+    // after another
+    void                    run(const std::vector<ZXSpectrum *> &machines, uint32_t frames, FrameCallback frameCallback = nullptr);
+    
+private:
+    struct Task
+    {
+        size_t              index;
+        uint32_t            framesLeft;
+    };
+    
+    struct Worker
+    {
+        std::mutex          mutex;
+        std::deque<Task>    tasks;
+    };
+    
+    void                    workerLoop(uint32_t worker);
+    bool                    takeTask(uint32_t worker, Task &task);
+    void                    runTask(uint32_t worker, Task &task);
+    void                    wakeIdleWorkers();
+    
+private:
+    std::vector<std::unique_ptr<Worker>>    batchWorkers;
+    std::vector<std::thread>                batchThreads;
+    
+    // Batch being run. batchRunMutex is held for the whole of a batch, batchMutex guards starting and finishing it
+    // and the queues have their own locks
+    std::mutex                              batchRunMutex;
+    std::mutex                              batchMutex;
+    std::condition_variable                 batchStarted;
+    std::condition_variable                 batchFinished;
+    uint64_t                                batchGeneration = 0;
+    uint32_t                                batchWorkersActive = 0;
+    bool                                    batchStopping = false;
+    const std::vector<ZXSpectrum *>       * batchMachines = nullptr;
+    FrameCallback                           batchFrameCallback;
+    std::atomic<size_t>                     batchMachinesLeft{ 0 };
+    
+    // Threads with nothing to take sleep until a slice is queued or the last machine finishes
+    std::mutex                              batchIdleMutex;
+    std::condition_variable                 batchIdle;
+    std::atomic<size_t>                     batchTasksQueued{ 0 };
+    
+};
+
+#endif /* BatchRunner_hpp */
@@ -15,37 +15,37 @@ Debug::Debug()
 {
     std::cout << "Debugger::Constructor" << "\n";
     byteRegisters_ = {
-        {"A" , CZ80Core::eREG_A},
-        {"F" , CZ80Core::eREG_F},
-        {"B" , CZ80Core::eREG_B},
-        {"C" , CZ80Core::eREG_C},
-        {"D" , CZ80Core::eREG_D},
-        {"E" , CZ80Core::eREG_E},
-        {"H" , CZ80Core::eREG_H},
-        {"L" , CZ80Core::eREG_L},
-        {"A'" , CZ80Core::eREG_ALT_A},
-        {"F'" , CZ80Core::eREG_ALT_F},
-        {"B'" , CZ80Core::eREG_ALT_B},
-        {"C'" , CZ80Core::eREG_ALT_C},
-        {"D'" , CZ80Core::eREG_ALT_D},
-        {"E'" , CZ80Core::eREG_ALT_E},
-        {"H'" , CZ80Core::eREG_ALT_H},
-        {"L'" , CZ80Core::eREG_ALT_L},
-        {"I" , CZ80Core::eREG_I},
-        {"R" , CZ80Core::eREG_R}
+        {"A" , CZ80CoreBase::eREG_A},
+        {"F" , CZ80CoreBase::eREG_F},
+        {"B" , CZ80CoreBase::eREG_B},
+        {"C" , CZ80CoreBase::eREG_C},
+        {"D" , CZ80CoreBase::eREG_D},
+        {"E" , CZ80CoreBase::eREG_E},
+        {"H" , CZ80CoreBase::eREG_H},
+        {"L" , CZ80CoreBase::eREG_L},
+        {"A'" , CZ80CoreBase::eREG_ALT_A},
+        {"F'" , CZ80CoreBase::eREG_ALT_F},
+        {"B'" , CZ80CoreBase::eREG_ALT_B},
+        {"C'" , CZ80CoreBase::eREG_ALT_C},
+        {"D'" , CZ80CoreBase::eREG_ALT_D},
+        {"E'" , CZ80CoreBase::eREG_ALT_E},
+        {"H'" , CZ80CoreBase::eREG_ALT_H},
+        {"L'" , CZ80CoreBase::eREG_ALT_L},
+        {"I" , CZ80CoreBase::eREG_I},
+        {"R" , CZ80CoreBase::eREG_R}
     };
 
     wordRegisters_ = {
-        {"AF" , CZ80Core::eREG_AF},
-        {"BC" , CZ80Core::eREG_BC},
-        {"DE" , CZ80Core::eREG_DE},
-        {"HL" , CZ80Core::eREG_HL},
-        {"AF'" , CZ80Core::eREG_ALT_AF},
-        {"BC'" , CZ80Core::eREG_ALT_BC},
-        {"DE'" , CZ80Core::eREG_ALT_DE},
-        {"HL'" , CZ80Core::eREG_ALT_HL},
-        {"PC" , CZ80Core::eREG_PC},
-        {"SP" , CZ80Core::eREG_SP}
+        {"AF" , CZ80CoreBase::eREG_AF},
+        {"BC" , CZ80CoreBase::eREG_BC},
+        {"DE" , CZ80CoreBase::eREG_DE},
+        {"HL" , CZ80CoreBase::eREG_HL},
+        {"AF'" , CZ80CoreBase::eREG_ALT_AF},
+        {"BC'" , CZ80CoreBase::eREG_ALT_BC},
+        {"DE'" , CZ80CoreBase::eREG_ALT_DE},
+        {"HL'" , CZ80CoreBase::eREG_ALT_HL},
+        {"PC" , CZ80CoreBase::eREG_PC},
+        {"SP" , CZ80CoreBase::eREG_SP}
     };
 }
 
@@ -228,7 +228,7 @@ size_t Debug::numberOfStackEntries()
 void Debug::stackTableUpdate()
 {
     stack_.clear();
-    for (uint32_t i = machine->z80Core.GetRegister(CZ80Core::eREG_SP); i <= 0xfffe; i += 2)
+    for (uint32_t i = machine->z80Core.GetRegister(CZ80CoreBase::eREG_SP); i <= 0xfffe; i += 2)
     {
         uint16_t value = static_cast<uint16_t>(machine->z80Core.Z80CoreDebugMemRead(i + 1, nullptr) << 8);
         value |= machine->z80Core.Z80CoreDebugMemRead(i, nullptr);
@@ -253,7 +253,7 @@ Debug::Stack Debug::stackAddress(uint32_t index)
 
 bool Debug::setRegister(std::string reg, uint8_t value)
 {
-    std::map<std::string, CZ80Core::eZ80BYTEREGISTERS>::iterator byteit;
+    std::map<std::string, CZ80CoreBase::eZ80BYTEREGISTERS>::iterator byteit;
     for (byteit = byteRegisters_.begin(); byteit != byteRegisters_.end(); byteit++)
     {
         if (byteit->first == reg)
@@ -263,7 +263,7 @@ bool Debug::setRegister(std::string reg, uint8_t value)
         }
     }
 
-    std::map<std::string, CZ80Core::eZ80WORDREGISTERS>::iterator wordit;
+    std::map<std::string, CZ80CoreBase::eZ80WORDREGISTERS>::iterator wordit;
     for (wordit = wordRegisters_.begin(); wordit != wordRegisters_.end(); wordit++)
     {
         if (wordit->first == reg)
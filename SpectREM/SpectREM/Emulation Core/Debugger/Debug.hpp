@@ -77,8 +77,8 @@ protected:
     std::vector<DisassembledOpcode>                     disassembly_;
     std::vector<Breakpoint>                             breakpoints_;
     std::vector<Stack>                                  stack_;
-    std::map<std::string, CZ80Core::eZ80BYTEREGISTERS>  byteRegisters_;
-    std::map<std::string, CZ80Core::eZ80WORDREGISTERS>  wordRegisters_;
+    std::map<std::string, CZ80CoreBase::eZ80BYTEREGISTERS>  byteRegisters_;
+    std::map<std::string, CZ80CoreBase::eZ80WORDREGISTERS>  wordRegisters_;
 
 public:
     ZXSpectrum *                machine;
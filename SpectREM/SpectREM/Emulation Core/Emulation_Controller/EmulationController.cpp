@@ -12,6 +12,19 @@
 #include "ZXSpectrum128_2.hpp"
 #include "ZXSpectrum128_2A.hpp"
 
+#include <chrono>
+
+// How far the run loop can fall behind, e.g. while the host is suspended or the debugger holds the machine, before it
+// gives up on catching up and starts pacing again from now
+static const std::chrono::milliseconds cMAX_FRAME_LAG(100);
+
+// Frame period used while there is no machine to take it from
+static const double cDEFAULT_FRAME_PERIOD = 0.02;
+
+// How often a frame is presented while fast forwarding. Frames in between are run without drawing the display or
+// producing audio
+static const std::chrono::milliseconds cFAST_FORWARD_PRESENT_PERIOD(20);
+
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Deconstructor
 // ------------------------------------------------------------------------------------------------------------
@@ -28,6 +41,7 @@ EmulationController::EmulationController()
 EmulationController::~EmulationController()
 {
     std::cout << "EmulationController::Destructor" << "\n";
+    stopEmulation();
     delete tapePlayer_;
     delete debugger_;
 }
@@ -38,6 +52,8 @@ EmulationController::~EmulationController()
 
 void EmulationController::createMachineOfType(int machineType, std::string romPath)
 {
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    
     if (machine_)
     {
         machine_->pause();
@@ -68,6 +84,51 @@ void EmulationController::createMachineOfType(int machineType, std::string romPa
     
     machine_->initialise(romPath);
     debugger_->attachMachine(machine_);
+    audioUpdateTargetLevel();
+    
+    // States from the old machine can't be loaded into the new one
+    rewindBuffer_.clear();
+    rewindPosition_ = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::resetMachine(bool hard)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->resetMachine(hard);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::generateFrame()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->generateFrame();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+size_t EmulationController::getStateSize()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->stateSize();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+size_t EmulationController::saveState(uint8_t *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->saveState(buffer, size);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::loadState(const uint8_t *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->loadState(buffer, size);
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -81,6 +142,8 @@ Tape::FileResponse EmulationController::loadFileWithPath(const std::string path)
         return Tape::FileResponse{ false, errorString };
     }
     
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    
     std::string fileExtension = stringToUpper( getFileExtensionFromPath(path) );
     
     if (fileExtension == "SNA")
@@ -91,7 +154,7 @@ Tape::FileResponse EmulationController::loadFileWithPath(const std::string path)
     {
         return machine_->snapshotZ80LoadWithPath(path);
     }
-    else if (fileExtension == "TAP")
+    else if (fileExtension == "TAP" || fileExtension == "TZX" || fileExtension == "PZX")
     {
         return tapePlayer_->insertTapeWithPath(path);
     }
@@ -103,19 +166,459 @@ Tape::FileResponse EmulationController::loadFileWithPath(const std::string path)
     return Tape::FileResponse{ false, "Unknown file type" };
 }
 
+// ------------------------------------------------------------------------------------------------------------
+
+ZXSpectrum::SnapshotData EmulationController::snapshotCreateZ80()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->snapshotCreateZ80();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+ZXSpectrum::SnapshotData EmulationController::snapshotCreateSNA()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->snapshotCreateSNA();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+int EmulationController::snapshotMachineInSnapshotWithPath(const char * path)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->snapshotMachineInSnapshotWithPath(path);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Keyboard
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::keyboardKeyDown(ZXSpectrum::eZXSpectrumKey key)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->keyboardKeyDown(key);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::keyboardKeyUp(ZXSpectrum::eZXSpectrumKey key)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->keyboardKeyUp(key);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::keyboardFlagsChanged(uint64_t flags, ZXSpectrum::eZXSpectrumKey key)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->keyboardFlagsChanged(flags, key);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Display
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::setHeadless(bool headless, bool keepAudio)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->setHeadless(headless, keepAudio);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+std::vector<uint8_t> EmulationController::getScreenshot()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    const uint8_t *frame = machine_->displayRenderFrame();
+    return std::vector<uint8_t>(frame, frame + machine_->screenBufferSize);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::getDisplayDirtyRects(std::vector<ZXSpectrum::DisplayRect> &rects)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->displayTakeDirtyRects(rects);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::isDisplayFrameUnchanged()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return machine_->displayFrameUnchanged();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::invalidateDisplay()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->displayInvalidate();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Run loop
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::startEmulation()
+{
+    if (emulationRunning_)
+    {
+        return;
+    }
+    
+    emulationRunning_ = true;
+    emulationThread_ = std::thread(&EmulationController::runLoop, this);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::stopEmulation()
+{
+    emulationRunning_ = false;
+    if (emulationThread_.joinable())
+    {
+        emulationThread_.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::setFrameCallback(std::function<void()> frameCallback)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    frameCallback_ = frameCallback;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::runLoop()
+{
+    using Clock = std::chrono::steady_clock;
+    
+    Clock::time_point nextFrameTime = Clock::now();
+    Clock::time_point nextPresentTime = nextFrameTime;
+    
+    while (emulationRunning_)
+    {
+        std::function<void()> frameCallback;
+        double framePeriod = cDEFAULT_FRAME_PERIOD;
+        bool frameGenerated = false;
+        
+        {
+            std::lock_guard<std::mutex> lock(machineMutex_);
+            
+            if (machine_)
+            {
+                framePeriod = static_cast<double>(machine_->machineInfo.tsPerFrame) / machine_->machineInfo.cpuSpeed;
+                
+                if (!machine_->emuPaused)
+                {
+                    // When fast forwarding only enough frames are drawn to keep the display moving and none are heard.
+                    // A loader being flash loaded is run uncapped until it stops
+                    const bool uncapped = emulationUncapped_ || flashLoading_;
+                    const bool fastForward = uncapped || emulationSpeed_ > 1.0;
+                    bool present = true;
+                    
+                    if (fastForward)
+                    {
+                        const Clock::time_point now = Clock::now();
+                        present = now >= nextPresentTime;
+                        if (present)
+                        {
+                            nextPresentTime = now + cFAST_FORWARD_PRESENT_PERIOD;
+                        }
+                    }
+                    
+                    // With run-ahead the frame that counts is only heard, the one presented comes from running ahead
+                    const bool runAhead = runAheadFrames_ > 0 && !fastForward && !tapePlayer_->playing;
+                    
+                    machine_->generateFrame(present && !runAhead, !uncapped && emulationSpeed_ == 1.0);
+                    audioQueueFrame();
+                    rewindPushFrame();
+                    flashLoading_ = machine_->emuTapeLoaderActive && tapePlayer_->playing;
+                    
+                    if (runAhead)
+                    {
+                        runAheadPresentFrame();
+                    }
+                    
+                    if (present)
+                    {
+                        frameCallback = frameCallback_;
+                    }
+                    frameGenerated = true;
+                }
+            }
+        }
+        
+        // Called without the lock so the host is free to use the controller from inside the callback
+        if (frameCallback)
+        {
+            frameCallback();
+        }
+        
+        // A paused machine still waits a frame period so uncapped doesn't turn into a busy loop
+        if ((emulationUncapped_ || flashLoading_) && frameGenerated)
+        {
+            nextFrameTime = Clock::now();
+            continue;
+        }
+        
+        // Deadlines are accumulated rather than measured from when the frame finished, so the time spent generating
+        // each frame doesn't add up into drift
+        nextFrameTime += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(framePeriod / emulationSpeed_));
+        
+        const Clock::time_point now = Clock::now();
+        if (now - nextFrameTime > cMAX_FRAME_LAG)
+        {
+            nextFrameTime = now;
+        }
+        else
+        {
+            std::this_thread::sleep_until(nextFrameTime);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::runAheadPresentFrame()
+{
+    const uint32_t frames = runAheadFrames_;
+    
+    // The buffer is kept from frame to frame and only grows when the state no longer fits, e.g. once the smart card's
+    // SRAM has been switched in
+    size_t size = machine_->saveState(runAheadState_.data(), runAheadState_.size());
+    if (!size)
+    {
+        runAheadState_.resize(machine_->stateSize());
+        size = machine_->saveState(runAheadState_.data(), runAheadState_.size());
+    }
+    
+    // Only the last frame ahead is drawn. Putting the machine back leaves that frame published
+    for (uint32_t i = 1; i <= frames; i++)
+    {
+        machine_->generateFrame(i == frames, false);
+    }
+    
+    // The frame ahead stays published and the rows it changed stay dirty, so the host only redraws those
+    machine_->loadState(runAheadState_.data(), size, true);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::audioQueueFrame()
+{
+    // Away from 1x the audio would either pile up or run dry, so it's dropped and the host plays silence
+    if (emulationUncapped_ || flashLoading_ || emulationSpeed_ != 1.0)
+    {
+        machine_->audioSetRateAdjustment(1.0);
+        return;
+    }
+    
+    // Having run dry, after starting, a pause or a change of speed, the queue is primed with silence so the host has
+    // the full latency to absorb jitter from the first frame
+    if (audioQueue_.bufferUsed() == 0)
+    {
+        audioQueue_.write(audioSilence_.data(), static_cast<uint32_t>(audioSilence_.size()));
+    }
+    
+    audioQueue_.write(machine_->audioBuffer, machine_->getLastAudioBufferIndex());
+    
+    // The run loop paces frames against the system clock while the host plays audio against its own, so the number of
+    // samples generated per frame is steered to keep the queue at the target latency
+    machine_->audioSetRateAdjustment(audioQueue_.rateAdjustment());
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::setAudioSampleRate(double sampleRate)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->audioSetSampleRate(sampleRate);
+    audioUpdateTargetLevel();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::setAudioLatency(double seconds)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    audioLatency_ = seconds;
+    audioUpdateTargetLevel();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::audioUpdateTargetLevel()
+{
+    if (!machine_)
+    {
+        return;
+    }
+    
+    // Target level and priming are both in interleaved stereo samples. The target sits above the priming level by a
+    // frame as the level is measured just after a frame has been written
+    const uint32_t latency = static_cast<uint32_t>(audioLatency_ * machine_->getAudioSampleRate()) * 2;
+    const uint32_t frame = static_cast<uint32_t>(machine_->getAudioSamplesPerFrame() + 1) * 2;
+    audioQueue_.setTargetLevel(latency + frame);
+    audioSilence_.assign(latency, 0);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Rewind
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::setRewindLength(double seconds)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    
+    const double framePeriod = machine_ ? static_cast<double>(machine_->machineInfo.tsPerFrame) / machine_->machineInfo.cpuSpeed : cDEFAULT_FRAME_PERIOD;
+    rewindBuffer_.setCapacity(static_cast<uint32_t>(std::max(seconds, 0.0) / framePeriod));
+    rewindPosition_ = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t EmulationController::getRewindFrameCount()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return rewindBuffer_.frames();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t EmulationController::getRewindPosition()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return rewindPosition_;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::rewindScrub(uint32_t framesBack)
+{
+    return rewindLoad(framesBack, false);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::rewindStepBack(uint32_t frames)
+{
+    return rewindLoad(frames, true);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool EmulationController::rewindLoad(uint32_t frames, bool relative)
+{
+    std::function<void()> frameCallback;
+    
+    {
+        std::lock_guard<std::mutex> lock(machineMutex_);
+        
+        const uint32_t framesBack = relative ? rewindPosition_ + frames : frames;
+        const std::vector<uint8_t> *state = rewindBuffer_.stateAt(framesBack);
+        
+        if (!machine_ || !state || !machine_->loadState(state->data(), state->size()))
+        {
+            return false;
+        }
+        rewindPosition_ = framesBack;
+        
+        // States are saved between frames so they hold no drawn lines. The screen is drawn from memory instead so the
+        // host has something to show while paused
+        if (!machine_->isHeadless())
+        {
+            machine_->displayRenderFrame();
+            frameCallback = frameCallback_;
+        }
+    }
+    
+    if (frameCallback)
+    {
+        frameCallback();
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::rewindPushFrame()
+{
+    if (!rewindBuffer_.getCapacity())
+    {
+        return;
+    }
+    
+    // Carrying on from a scrubbed state replaces the frames that came after it
+    rewindBuffer_.discardNewest(rewindPosition_);
+    rewindPosition_ = 0;
+    
+    rewindState_.resize(machine_->stateSize());
+    const size_t size = machine_->saveState(rewindState_.data(), rewindState_.size());
+    rewindBuffer_.push(rewindState_.data(), size);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Tape player
 // ------------------------------------------------------------------------------------------------------------
 
 void EmulationController::setTapeStatusCallback(std::function<void(int blockIndex, int bytes, int action)> tapeStatusCallback)
 {
+    std::lock_guard<std::mutex> lock(machineMutex_);
     tapePlayer_->setStatusCallback(tapeStatusCallback);
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
+void EmulationController::playTape()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    tapePlayer_->play();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::stopTape()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    tapePlayer_->stop();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::rewindTape()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    tapePlayer_->rewindTape();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void EmulationController::ejectTape()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    tapePlayer_->eject();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+Tape::FileResponse EmulationController::insertTapeWithPath(const std::string path)
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    return tapePlayer_->insertTapeWithPath(path);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
 void EmulationController::setCurrentTapeBlockIndex(int index)
 {
+    std::lock_guard<std::mutex> lock(machineMutex_);
     tapePlayer_->setCurrentBlock(index);
     tapePlayer_->rewindBlock();
     tapePlayer_->stop();
@@ -125,8 +628,17 @@ void EmulationController::setCurrentTapeBlockIndex(int index)
 // - Debugger
 // ------------------------------------------------------------------------------------------------------------
 
+void EmulationController::debugStep()
+{
+    std::lock_guard<std::mutex> lock(machineMutex_);
+    machine_->step();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
 void EmulationController::setDebugCallback(std::function<bool (uint16_t, int)> debugCallback)
 {
+    std::lock_guard<std::mutex> lock(machineMutex_);
     machine_->registerDebugOpCallback(debugCallback);
 }
 
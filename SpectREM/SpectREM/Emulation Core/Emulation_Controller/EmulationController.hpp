@@ -9,9 +9,17 @@
 #ifndef EmulationController_hpp
 #define EmulationController_hpp
 
-#import "ZXSpectrum.hpp"
-#import "Debug.hpp"
-#import "Tape.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "AudioQueue.hpp"
+#include "RewindBuffer.hpp"
+#include "ZXSpectrum.hpp"
+#include "Debug.hpp"
+#include "Tape.hpp"
 
 class EmulationController
 {
@@ -21,6 +29,30 @@ private:
     Tape                        * tapePlayer_   = nullptr;
     Debug                       * debugger_     = nullptr;
 
+    // Run loop. Anything that replaces or rewinds the machine takes machineMutex_ so it can't happen part way through
+    // a frame on the emulation thread
+    std::thread                 emulationThread_;
+    std::atomic<bool>           emulationRunning_{ false };
+    std::atomic<bool>           emulationUncapped_{ false };
+    std::atomic<double>         emulationSpeed_{ 1.0 };
+    bool                        flashLoading_   = false;          // The last frame ran a tape loader forward
+    std::mutex                  machineMutex_;
+    std::function<void()>       frameCallback_;
+
+    // Audio produced on the emulation thread for the host's audio callback
+    AudioQueue                  audioQueue_;
+    double                      audioLatency_   = 0.06;
+    std::vector<int16_t>        audioSilence_;
+    
+    // States of the frames generated by the run loop, and how far back the machine has been scrubbed
+    RewindBuffer                rewindBuffer_;
+    std::vector<uint8_t>        rewindState_;
+    uint32_t                    rewindPosition_ = 0;
+    
+    // Frames run ahead of the machine before each frame is presented
+    std::atomic<uint32_t>       runAheadFrames_{ 0 };
+    std::vector<uint8_t>        runAheadState_;
+
 public:
     EmulationController();
     ~EmulationController();
@@ -29,18 +61,54 @@ public:
     void                        createMachineOfType(int machineType, std::string romPath);
     void                        pauseMachine()                                                          { if (machine_) machine_->pause(); };
     void                        resumeMachine()                                                         { machine_->resume(); };
-    void                        resetMachine(bool hard)                                                 { machine_->resetMachine(hard); };
-    void                        generateFrame()                                                         { machine_->generateFrame(); };
-    ZXSpectrum::SnapshotData    snapshotCreateZ80()                                                     { return machine_->snapshotCreateZ80(); };
-    ZXSpectrum::SnapshotData    snapshotCreateSNA()                                                     { return machine_->snapshotCreateSNA(); };
-    int                         snapshotMachineInSnapshotWithPath(const char * path)                    { return machine_->snapshotMachineInSnapshotWithPath(path); };
+    void                        resetMachine(bool hard);
+    void                        generateFrame();
+    ZXSpectrum::SnapshotData    snapshotCreateZ80();
+    ZXSpectrum::SnapshotData    snapshotCreateSNA();
+    
+    // Savestates of the complete machine into a buffer owned by the caller. See ZXSpectrum::saveState
+    size_t                      getStateSize();
+    size_t                      saveState(uint8_t *buffer, size_t size);
+    bool                        loadState(const uint8_t *buffer, size_t size);
+    
+    // Rewind keeps the state of every frame the run loop generates, going back the given number of seconds, with 0
+    // turning it off. Scrubbing loads the state a number of frames before the newest and draws its screen. The frames
+    // after it are kept so the host can scrub back and forth, and are only dropped once emulation carries on from the
+    // scrubbed state. Stepping back moves further back from wherever the last scrub or step left off
+    void                        setRewindLength(double seconds);
+    uint32_t                    getRewindFrameCount();
+    uint32_t                    getRewindPosition();
+    bool                        rewindScrub(uint32_t framesBack);
+    bool                        rewindStepBack(uint32_t frames = 1);
+    int                         snapshotMachineInSnapshotWithPath(const char * path);
     Tape::FileResponse          loadFileWithPath(const std::string path);
-    void                        keyboardKeyDown(ZXSpectrum::eZXSpectrumKey key)                         { machine_->keyboardKeyDown(key); };
-    void                        keyboardKeyUp(ZXSpectrum::eZXSpectrumKey key)                           { machine_->keyboardKeyUp(key); };
-    void                        keyboardFlagsChanged(uint64_t flags, ZXSpectrum::eZXSpectrumKey key)    { machine_->keyboardFlagsChanged(flags, key); };
+    
+    // Input is applied between frames, so a key can't be lost when run-ahead puts the machine back
+    void                        keyboardKeyDown(ZXSpectrum::eZXSpectrumKey key);
+    void                        keyboardKeyUp(ZXSpectrum::eZXSpectrumKey key);
+    void                        keyboardFlagsChanged(uint64_t flags, ZXSpectrum::eZXSpectrumKey key);
     
     void                      * getDisplayBuffer()                                                      { return machine_->getScreenBuffer(); };
+    // Frames handed to the renderer are triple buffered. An acquired frame is left alone by the emulator until the next
+    // acquire, so release just marks the point after which the renderer must not touch it
+    const uint8_t             * acquireDisplayFrame()                                                   { return machine_->displayAcquireFrame(); };
+    void                        releaseDisplayFrame()                                                   { };
+    // The dirty rows are written by the emulation thread while it draws, so these take the machine lock and must not be
+    // called while it is held. The frame callback runs without it
+    bool                        getDisplayDirtyRects(std::vector<ZXSpectrum::DisplayRect> &rects);
+    bool                        isDisplayFrameUnchanged();
+    void                        invalidateDisplay();
+    
+    // Headless machines skip drawing the display, and audio unless keepAudio is set. A screenshot draws the screen as
+    // it is in memory now and returns a copy of it in the same format as the display buffer
+    void                        setHeadless(bool headless, bool keepAudio = false);
+    bool                        isHeadless()                                                            { return machine_->isHeadless(); };
+    std::vector<uint8_t>        getScreenshot();
     int16_t                   * getAudioBuffer()                                                        { return machine_->audioBuffer; };
+    uint32_t                    getAudioBufferLength()                                                  { return machine_->getLastAudioBufferIndex(); };
+    double                      getAudioSamplesPerFrame()                                               { return machine_->getAudioSamplesPerFrame(); };
+    void                        setAudioSampleRate(double sampleRate);
+    void                        setAudioRateAdjustment(double ratio)                                    { machine_->audioSetRateAdjustment(ratio); };
     const char                * getMachineName()                                                        { return machine_->machineInfo.machineName; };
     int                         getMachineType()                                                        { return machine_->machineInfo.machineType; };
     ZXSpectrum                * getMachine()                                                            { return machine_; };
@@ -49,25 +117,51 @@ public:
     bool                        isMachinePaused()                                                       { return machine_->emuPaused; };
                             
     void                        setInstantTapeLoad(bool instantTapeLoad)                                { machine_->emuTapeInstantLoad = instantTapeLoad; };
+    void                        setFlashTapeLoad(bool flashTapeLoad)                                    { machine_->emuTapeFlashLoad = flashTapeLoad; };
     void                        setUseAySound(bool useAy)                                               { machine_->emuUseAYSound = useAy; };
     void                        setUseSpecDrum(bool useSpecDrum)                                        { machine_->emuUseSpecDRUM = useSpecDrum; };
                                 
     // Debugger
     Debug                     * getDebugger()                                                           { if (debugger_) return debugger_; else return nullptr; };
-    void                        debugStep()                                                             { machine_->step(); };
+    void                        debugStep();
+
+    // Run loop. Once started, frames are generated on a dedicated thread paced against a monotonic clock at the
+    // machine's real frame rate multiplied by the emulation speed, or as fast as possible when uncapped or while a tape
+    // loader is being flash loaded. Audio is only produced at 1x speed, and when fast forwarding only around 50 frames a
+    // second are drawn. The frame callback runs on the emulation thread after every drawn frame, so it should only check
+    // for changes and hand the display off to the host's own thread
+    void                        startEmulation();
+    void                        stopEmulation();
+    bool                        isEmulationRunning()                                                    { return emulationRunning_; };
+    void                        setEmulationSpeed(double speed)                                         { emulationSpeed_ = std::max(speed, 0.01); };
+    double                      getEmulationSpeed()                                                     { return emulationSpeed_; };
+    void                        setUncapped(bool uncapped)                                              { emulationUncapped_ = uncapped; };
+    bool                        isUncapped()                                                            { return emulationUncapped_; };
+    void                        setFrameCallback(std::function<void()> frameCallback);
+    
+    // Run-ahead hides the frames of lag many games have between reading the keyboard and changing the screen. Each frame
+    // is run and heard as normal, then the machine is saved, run on the given number of frames without audio and put
+    // back, so the frame presented is the one that many frames in the future. It is skipped while fast forwarding or
+    // while the tape is playing, and 0 turns it off
+    void                        setRunAheadFrames(uint32_t frames)                                      { runAheadFrames_ = frames; };
+    uint32_t                    getRunAheadFrames()                                                     { return runAheadFrames_; };
+    
+    // Host audio callback. Returns the number of samples read, the rest of the buffer is filled with silence
+    uint32_t                    readAudio(int16_t *buffer, uint32_t count)                              { return audioQueue_.read(buffer, count); };
+    void                        setAudioLatency(double seconds);
 
     // Callbacks
     void                        setTapeStatusCallback(std::function<void(int blockIndex, int bytes, int action)>    tapeStatusCallback);
     void                        setDebugCallback(std::function<bool(uint16_t address, int operationType)>           debugCallback);
     
     // Tape player
-    void                        playTape()                                                              { tapePlayer_->play(); };
-    void                        stopTape()                                                              { tapePlayer_->stop(); };
-    void                        rewindTape()                                                            { tapePlayer_->rewindTape(); };
-    void                        ejectTape()                                                             { tapePlayer_->eject(); };
+    void                        playTape();
+    void                        stopTape();
+    void                        rewindTape();
+    void                        ejectTape();
     void                        setCurrentTapeBlockIndex(int index);
     std::vector<uint8_t>        getTapeData()                                                           { return tapePlayer_->getTapeData(); };
-    Tape::FileResponse          insertTapeWithPath(const std::string path)                              { return tapePlayer_->insertTapeWithPath(path); };
+    Tape::FileResponse          insertTapeWithPath(const std::string path);
     size_t                      getNumberOfTapeBlocks()                                                 { return tapePlayer_->numberOfTapeBlocks(); };
     std::string                 tapeBlockTypeForIndex(int index)                                        { return tapePlayer_->blocks[index]->getBlockName(); };
     std::string                 tapeFilenameForIndex(int index)                                         { return tapePlayer_->blocks[index]->getFilename(); };
@@ -80,6 +174,12 @@ public:
 private:
     std::string                 getFileExtensionFromPath(const std::string &path);
     std::string                 stringToUpper(std::string str);
+    void                        runLoop();
+    void                        audioQueueFrame();
+    void                        audioUpdateTargetLevel();
+    void                        rewindPushFrame();
+    void                        runAheadPresentFrame();
+    bool                        rewindLoad(uint32_t frames, bool relative);
 };
 
 #endif /* EmulationController_hpp */
@@ -0,0 +1,267 @@
+//
+//  RewindBuffer.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "RewindBuffer.hpp"
+#include <algorithm>
+#include <cstring>
+
+// Changed bytes separated by fewer unchanged bytes than this are stored as one run, as a shorter gap costs more in
+// run lengths than it saves
+static const size_t cMIN_UNCHANGED_RUN = 4;
+
+// ------------------------------------------------------------------------------------------------------------
+// - Run lengths
+
+static void writeLength(std::vector<uint8_t> &delta, size_t length)
+{
+    // 7 bits at a time, low bits first, with the top bit set while there is more to come
+    while (length >= 0x80)
+    {
+        delta.push_back(static_cast<uint8_t>(length | 0x80));
+        length >>= 7;
+    }
+    delta.push_back(static_cast<uint8_t>(length));
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+static size_t readLength(const uint8_t *&data)
+{
+    size_t length = 0;
+    uint32_t shift = 0;
+    
+    while (*data & 0x80)
+    {
+        length |= static_cast<size_t>(*data++ & 0x7f) << shift;
+        shift += 7;
+    }
+    return length | ( static_cast<size_t>(*data++) << shift );
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Constructor/Deconstructor
+
+RewindBuffer::RewindBuffer(uint32_t capacity)
+{
+    setCapacity(capacity);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+RewindBuffer::~RewindBuffer()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void RewindBuffer::setCapacity(uint32_t capacity)
+{
+    rewindCapacity = capacity;
+    rewindDeltas.clear();
+    rewindDeltas.resize(capacity);
+    rewindNewest.clear();
+    rewindNewest.shrink_to_fit();
+    rewindWork.clear();
+    rewindWork.shrink_to_fit();
+    clear();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void RewindBuffer::clear()
+{
+    // The deltas keep their memory to be reused as the buffer fills again
+    rewindHead = 0;
+    rewindCount = 0;
+    rewindNewest.clear();
+    rewindWorkFramesBack = 0;
+    rewindWorkValid = false;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - States
+
+void RewindBuffer::push(const uint8_t *state, size_t size)
+{
+    if (!rewindCapacity || !state)
+    {
+        return;
+    }
+    
+    rewindWorkValid = false;
+    
+    // The delta ring holds one less than the capacity as the newest state is held whole
+    if (!rewindNewest.empty() && rewindCapacity > 1)
+    {
+        if (rewindCount == rewindCapacity - 1)
+        {
+            rewindHead = ( rewindHead + 1 ) % rewindCapacity;
+            rewindCount--;
+        }
+        
+        encodeDelta(deltaAt(rewindCount), rewindNewest, state, size);
+        rewindCount++;
+    }
+    
+    rewindNewest.assign(state, state + size);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+const std::vector<uint8_t> * RewindBuffer::stateAt(uint32_t framesBack)
+{
+    if (framesBack >= frames())
+    {
+        return nullptr;
+    }
+    
+    // Deltas only go backwards, so moving forward again starts over from the newest state
+    if (!rewindWorkValid || rewindWorkFramesBack > framesBack)
+    {
+        rewindWork = rewindNewest;
+        rewindWorkFramesBack = 0;
+        rewindWorkValid = true;
+    }
+    
+    while (rewindWorkFramesBack < framesBack)
+    {
+        applyDelta(rewindWork, deltaAt(rewindCount - 1 - rewindWorkFramesBack));
+        rewindWorkFramesBack++;
+    }
+    
+    return &rewindWork;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void RewindBuffer::discardNewest(uint32_t count)
+{
+    if (!count)
+    {
+        return;
+    }
+    
+    if (count >= frames())
+    {
+        clear();
+        return;
+    }
+    
+    stateAt(count);
+    rewindNewest.swap(rewindWork);
+    rewindCount -= count;
+    rewindWorkValid = false;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+size_t RewindBuffer::memoryUsed()
+{
+    size_t used = rewindNewest.capacity() + rewindWork.capacity();
+    for (const std::vector<uint8_t> &delta : rewindDeltas)
+    {
+        used += delta.capacity();
+    }
+    return used;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Deltas
+
+void RewindBuffer::encodeDelta(std::vector<uint8_t> &delta, const std::vector<uint8_t> &state, const uint8_t *next, size_t nextSize)
+{
+    // A delta starts with the size of the state it rebuilds followed by pairs of unchanged and changed run lengths,
+    // each changed run followed by its bytes XOR'd with the next state. States can differ in size, so the next state
+    // is treated as if it carried on with zeros
+    const size_t size = state.size();
+    const size_t common = std::min(size, nextSize);
+    const uint8_t *data = state.data();
+    
+    delta.clear();
+    const uint32_t size32 = static_cast<uint32_t>(size);
+    delta.resize(sizeof(uint32_t));
+    memcpy(delta.data(), &size32, sizeof(uint32_t));
+    
+    size_t i = 0;
+    
+    while (i < size)
+    {
+        // Unchanged bytes are compared 8 at a time until the first difference
+        const size_t unchangedStart = i;
+        
+        while (i + sizeof(uint64_t) <= common)
+        {
+            uint64_t a, b;
+            memcpy(&a, data + i, sizeof(uint64_t));
+            memcpy(&b, next + i, sizeof(uint64_t));
+            if (a != b)
+            {
+                break;
+            }
+            i += sizeof(uint64_t);
+        }
+        
+        while (i < size && data[ i ] == ( i < nextSize ? next[ i ] : 0 ))
+        {
+            i++;
+        }
+        
+        if (i == size)
+        {
+            break;
+        }
+        
+        // The changed run carries on until enough unchanged bytes in a row are found
+        const size_t changedStart = i++;
+        size_t changedEnd = i;
+        
+        while (i < size && i < changedEnd + cMIN_UNCHANGED_RUN)
+        {
+            if (data[ i ] != ( i < nextSize ? next[ i ] : 0 ))
+            {
+                changedEnd = i + 1;
+            }
+            i++;
+        }
+        i = changedEnd;
+        
+        writeLength(delta, changedStart - unchangedStart);
+        writeLength(delta, changedEnd - changedStart);
+        
+        for (size_t j = changedStart; j < changedEnd; j++)
+        {
+            delta.push_back(data[ j ] ^ ( j < nextSize ? next[ j ] : 0 ));
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void RewindBuffer::applyDelta(std::vector<uint8_t> &state, const std::vector<uint8_t> &delta)
+{
+    uint32_t size;
+    memcpy(&size, delta.data(), sizeof(uint32_t));
+    state.resize(size, 0);
+    
+    const uint8_t *data = delta.data() + sizeof(uint32_t);
+    const uint8_t *end = delta.data() + delta.size();
+    uint8_t *destination = state.data();
+    
+    while (data < end)
+    {
+        destination += readLength(data);
+        const size_t changed = readLength(data);
+        
+        for (size_t i = 0; i < changed; i++)
+        {
+            destination[ i ] ^= data[ i ];
+        }
+        destination += changed;
+        data += changed;
+    }
+}
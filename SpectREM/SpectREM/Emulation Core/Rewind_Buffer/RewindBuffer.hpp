@@ -0,0 +1,70 @@
+//
+//  RewindBuffer.hpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#ifndef RewindBuffer_hpp
+#define RewindBuffer_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Ring of machine states, one per frame, going back a fixed number of frames. Only the newest state is kept whole.
+// Every older state is kept as the XOR of it with the state that followed it, with the runs of bytes that didn't change
+// stored as a count. Very little of a machine changes from one frame to the next, so a delta is usually a few KB
+// rather than the full size of a state. Going back walks the deltas from the newest state, so the state n frames back
+// costs n small deltas to rebuild
+class RewindBuffer
+{
+    
+public:
+    // Capacity is in frames including the newest. Zero turns rewinding off
+    RewindBuffer(uint32_t capacity = 0);
+    ~RewindBuffer();
+    
+    void                    setCapacity(uint32_t capacity);
+    uint32_t                getCapacity() { return rewindCapacity; }
+    void                    clear();
+    
+    // Adds a state as the newest, dropping the oldest once the buffer is full
+    void                    push(const uint8_t *state, size_t size);
+    
+    // Number of states held, including the newest
+    uint32_t                frames() { return rewindNewest.empty() ? 0 : rewindCount + 1; }
+    
+    // Rebuilds the state framesBack frames before the newest. The buffer returned belongs to the rewind buffer and is
+    // valid until it is next changed. Returns nullptr if the buffer doesn't go back that far
+    const std::vector<uint8_t> * stateAt(uint32_t framesBack);
+    
+    // Drops the newest count states, so the state that was count frames back becomes the newest
+    void                    discardNewest(uint32_t count);
+    
+    // Bytes held by the deltas and the newest state
+    size_t                  memoryUsed();
+    
+private:
+    static void             encodeDelta(std::vector<uint8_t> &delta, const std::vector<uint8_t> &state, const uint8_t *next, size_t nextSize);
+    static void             applyDelta(std::vector<uint8_t> &state, const std::vector<uint8_t> &delta);
+    
+    std::vector<uint8_t>  & deltaAt(uint32_t index) { return rewindDeltas[ ( rewindHead + index ) % rewindCapacity ]; }
+    
+private:
+    // Ring of deltas, oldest first. Delta i turns state i + 1 back into state i, where the newest state is rewindCount
+    std::vector<std::vector<uint8_t>>   rewindDeltas;
+    uint32_t                            rewindCapacity;
+    uint32_t                            rewindHead;
+    uint32_t                            rewindCount;
+    std::vector<uint8_t>                rewindNewest;
+    
+    // Last state rebuilt, so scrubbing further back carries on from it rather than starting again from the newest
+    std::vector<uint8_t>                rewindWork;
+    uint32_t                            rewindWorkFramesBack;
+    bool                                rewindWorkValid;
+    
+};
+
+#endif /* RewindBuffer_hpp */
@@ -0,0 +1,145 @@
+//
+//  MappedFile.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "MappedFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ------------------------------------------------------------------------------------------------------------
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string &path)
+{
+    close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        errorMessage = "Unable to open file";
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        errorMessage = "File is empty";
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        errorMessage = "Unable to map file";
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    fileData = static_cast<const uint8_t *>(view);
+    fileSize = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void MappedFile::close()
+{
+    if (fileData)
+    {
+        UnmapViewOfFile(fileData);
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+    }
+
+    fileData = nullptr;
+    fileSize = 0;
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const std::string &path)
+{
+    close();
+
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        errorMessage = strerror(errno);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(file, &info) != 0)
+    {
+        errorMessage = strerror(errno);
+        ::close(file);
+        return false;
+    }
+
+    if (info.st_size == 0)
+    {
+        errorMessage = "File is empty";
+        ::close(file);
+        return false;
+    }
+
+    // The mapping holds its own reference to the file, so the descriptor isn't needed once it exists
+    void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (view == MAP_FAILED)
+    {
+        errorMessage = strerror(errno);
+        return false;
+    }
+
+    fileData = static_cast<const uint8_t *>(view);
+    fileSize = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void MappedFile::close()
+{
+    if (fileData)
+    {
+        munmap(const_cast<uint8_t *>(fileData), fileSize);
+    }
+
+    fileData = nullptr;
+    fileSize = 0;
+}
+
+#endif
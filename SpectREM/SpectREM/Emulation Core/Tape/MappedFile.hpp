@@ -0,0 +1,49 @@
+//
+//  MappedFile.hpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#ifndef MappedFile_hpp
+#define MappedFile_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A read only view of a whole file mapped into memory. Anything pointing into the file stays valid for as long as the
+// MappedFile does
+class MappedFile
+{
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+    // Returns false and sets errorMessage if the file can't be opened or mapped
+    bool                    open(const std::string &path);
+    void                    close();
+
+    const uint8_t         * data() const { return fileData; }
+    size_t                  size() const { return fileSize; }
+
+public:
+    std::string             errorMessage;
+
+private:
+    const uint8_t         * fileData = nullptr;
+    size_t                  fileSize = 0;
+#ifdef _WIN32
+    void                  * fileHandle = nullptr;
+    void                  * mappingHandle = nullptr;
+#endif
+
+};
+
+#endif /* MappedFile_hpp */
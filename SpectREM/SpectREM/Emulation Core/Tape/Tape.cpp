@@ -9,6 +9,8 @@
 #include "Tape.hpp"
 #include "../ZX_Spectrum_Core/ZXSpectrum.hpp"
 
+#include <algorithm>
+
 // ------------------------------------------------------------------------------------------------------------
 // - Constants
 
@@ -21,6 +23,8 @@ static const int cFIRST_SYNC_PULSE_TSTATE_DELAY = 667;
 static const int cSECOND_SYNC_PULSE_TSTATE_DELAY = 735;
 static const int cDATA_BIT_ZERO_PULSE_TSTATE_DELAY = 855;
 static const int cDATA_BIT_ONE_PULSE_TSTATE_DELAY = 1710;
+static const int cBLOCK_PAUSE_MS = 1000;
+static const int cTSTATES_PER_MS = 3500;
 
 static const int cHEADER_FLAG_OFFSET = 0;
 static const int cHEADER_DATA_TYPE_OFFSET = 1;
@@ -49,6 +53,35 @@ static const int cHEADER_FILENAME_LENGTH = 10;
 
 static const int cHEADER_BLOCK_LENGTH = 19;
 
+static const char cTZX_SIGNATURE[] = "ZXTape!\x1a";
+static const size_t cTZX_HEADER_LENGTH = 10;
+static const char cPZX_SIGNATURE[] = "PZXT";
+
+// PZX block tags, as read little endian from the start of each block
+static const uint32_t cPZX_PULSES = 0x534c5550;     // PULS
+static const uint32_t cPZX_DATA = 0x41544144;       // DATA
+static const uint32_t cPZX_PAUSE = 0x53554150;      // PAUS
+static const uint32_t cPZX_BROWSE = 0x53575242;     // BRWS
+static const uint32_t cPZX_STOP = 0x504f5453;       // STOP
+
+// ------------------------------------------------------------------------------------------------------------
+// - Little endian reads from tape files
+
+static inline uint32_t read16(const uint8_t *p)
+{
+   return static_cast<uint32_t>(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t read24(const uint8_t *p)
+{
+   return static_cast<uint32_t>(p[0] | (p[1] << 8) | (p[2] << 16));
+}
+
+static inline uint32_t read32(const uint8_t *p)
+{
+   return static_cast<uint32_t>(p[0] | (p[1] << 8) | (p[2] << 16)) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
 
 // ------------------------------------------------------------------------------------------------------------
 // - TapeBlock
@@ -56,7 +89,10 @@ static const int cHEADER_BLOCK_LENGTH = 19;
 
 TapeBlock::~TapeBlock()
 {
-   delete blockData;
+   if (blockDataOwned)
+   {
+       delete[] blockData;
+   }
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -122,7 +158,7 @@ std::string ProgramHeader::getBlockName()
 
 uint16_t ProgramHeader::getAutoStartLine()
 {
-    uint16_t lineNumber (reinterpret_cast<uint16_t*>(&blockData[ cPROGRAM_HEADER_AUTOSTART_LINE_OFFSET ])[0]);
+    uint16_t lineNumber (reinterpret_cast<const uint16_t*>(&blockData[ cPROGRAM_HEADER_AUTOSTART_LINE_OFFSET ])[0]);
     return (lineNumber == 32768) ? 0 : lineNumber;
 }
 
@@ -130,7 +166,7 @@ uint16_t ProgramHeader::getAutoStartLine()
 
 uint16_t ProgramHeader::getProgramLength()
 {
-   return (reinterpret_cast<uint16_t*>(&blockData[ cPROGRAM_HEADER_PROGRAM_LENGTH_OFFSET ])[0]);
+   return (reinterpret_cast<const uint16_t*>(&blockData[ cPROGRAM_HEADER_PROGRAM_LENGTH_OFFSET ])[0]);
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -175,7 +211,7 @@ std::string ByteHeader::getBlockName()
 
 uint16_t ByteHeader::getStartAddress()
 {
-   return (reinterpret_cast<uint16_t*>(&blockData[ cBYTE_HEADER_START_ADDRESS_OFFSET ])[0]);
+   return (reinterpret_cast<const uint16_t*>(&blockData[ cBYTE_HEADER_START_ADDRESS_OFFSET ])[0]);
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -216,6 +252,49 @@ uint8_t DataBlock::getChecksum()
    return blockData[ blockLength - 1 ];
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Signal Block
+
+SignalBlock::SignalBlock(const std::string &name) : blockName(name)
+{
+   blockType = Tape::E_SIGNAL_BLOCK;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t SignalBlock::getFlag()
+{
+   return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t SignalBlock::getDataType()
+{
+   return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t SignalBlock::getChecksum()
+{
+   return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+std::string SignalBlock::getBlockName()
+{
+   return blockName;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+std::string SignalBlock::getFilename()
+{
+   return "";
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - TAP Processing
 
@@ -235,7 +314,10 @@ Tape::Tape(std::function<void(int blockIndex, int bytes, int action)> callback)
 
 Tape::~Tape()
 {
-    // CONSTRUCTOR !
+    for (TapeBlock *block : blocks)
+    {
+        delete block;
+    }
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -258,23 +340,22 @@ void Tape::setStatusCallback(std::function<void (int blockIndex, int bytes, int
 
 void Tape::resetAndClearBlocks(bool clearBlocks)
 {
-   inputBit = 0;
-   currentBytePtr = 0;
-   currentDataBit = 0;
-   pilotPulseTStates = 0;
-   pilotPulses = 0;
-   dataPulseTStates = 0;
-   flipTapeBit = true;
    playing = false;
-   newBlock = true;
-   currentBytePtr = 0;
    currentBlockIndex = 0;
 
    if (clearBlocks)
    {
+       for (TapeBlock *block : blocks)
+       {
+           delete block;
+       }
        blocks.clear();
+       timeline.clear();
+       tapeFile.reset();
    }
 
+   seek(0);
+
    if (updateStatusCallback)
    {
        updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_RESET);
@@ -287,34 +368,73 @@ Tape::FileResponse Tape::insertTapeWithPath(const std::string path)
 {
     bool success = false;
 
-    std::ifstream stream(path, std::ios::binary | std::ios::ate);
-    if (stream.good())
+    std::unique_ptr<MappedFile> file(new MappedFile());
+    if (!file->open(path))
+    {
+        std::cout << "ERROR LOADING TAPE: " << file->errorMessage << "\n";
+        return Tape::FileResponse{false, file->errorMessage};
+    }
+
+    resetAndClearBlocks(true);
+    tapeFile = std::move(file);
+
+    const uint8_t *fileBytes = tapeFile->data();
+    const size_t size = tapeFile->size();
+
+    if (size >= cTZX_HEADER_LENGTH && memcmp(fileBytes, cTZX_SIGNATURE, sizeof(cTZX_SIGNATURE) - 1) == 0)
     {
-        std::vector<uint8_t> snapshotData(static_cast<size_t>(stream.tellg()));
-        stream.seekg(0, std::ios::beg);
-        stream.read(reinterpret_cast<char*>(snapshotData.data()), snapshotData.size());
-
-        resetAndClearBlocks(true);
-        if (processData(snapshotData.data(), static_cast<unsigned int>(snapshotData.size())))
-        {
-            success = true;
-        }
+        success = processTZX(fileBytes, size);
+    }
+    else if (size >= 8 && memcmp(fileBytes, cPZX_SIGNATURE, sizeof(cPZX_SIGNATURE) - 1) == 0)
+    {
+        success = processPZX(fileBytes, size);
     }
     else
     {
-        char* errorstring = strerror(errno);
-        std::cout << "ERROR LOADING TAPE: " << errorstring << "\n";
-        return Tape::FileResponse{false, errorstring};
+        success = processData(fileBytes, size);
     }
+
+    seek(0);
+
     loaded = success;
+    if (!success)
+    {
+        return Tape::FileResponse{false, "Invalid tape file"};
+    }
     return Tape::FileResponse{true, "Loaded successfully"};
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::updateWithTs(uint32_t tStates)
+void Tape::advance(uint32_t tStates)
 {
-   if (currentBlockIndex > static_cast<uint32_t>(blocks.size() - 1))
+   position += tStates;
+
+   // A stop block halts the tape where it is, ready to carry on from there when play is pressed again
+   const bool stopBlock = (position >= nextStop);
+   if (stopBlock)
+   {
+       position = nextStop;
+   }
+
+   while (nextEdge <= position)
+   {
+       inputBit = timelineCursor.level;
+
+       const uint32_t block = timeline.blockOf(timelineCursor);
+       if (block != currentBlockIndex)
+       {
+           currentBlockIndex = block;
+           if (updateStatusCallback)
+           {
+               updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_NEW_BLOCK);
+           }
+       }
+
+       nextEdge = timeline.nextEdge(timelineCursor);
+   }
+
+   if (position >= timeline.length())
    {
        std::cout << "TAPE STOPPED" << "\n";
        playing = false;
@@ -325,358 +445,584 @@ void Tape::updateWithTs(uint32_t tStates)
        {
            updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_TAPE_STOP);
        }
-
-       return;
    }
-
-   if (newBlock)
+   else if (stopBlock)
    {
+       playing = false;
+       inputBit = 0;
+       nextStop = timeline.nextStopAfter(position);
+
        if (updateStatusCallback)
        {
-           updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_NEW_BLOCK);
+           updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_TAPE_STOP);
        }
+   }
+}
 
-       newBlock = false;
+// ------------------------------------------------------------------------------------------------------------
 
-       tapeCurrentBlock = blocks[ currentBlockIndex ];
+uint32_t Tape::tsToNextEdge() const
+{
+   // The end of the tape and stop blocks count as edges so playback stops on time
+   const uint64_t next = std::min(std::min(nextEdge, nextStop), timeline.length());
+   return (next > position) ? static_cast<uint32_t>(std::min<uint64_t>(next - position, UINT32_MAX)) : 0;
+}
 
-       if (tapeCurrentBlock->blockType == E_PROGRAM_HEADER ||
-           tapeCurrentBlock->blockType == E_NUMERIC_DATA_HEADER ||
-           tapeCurrentBlock->blockType == E_ALPHANUMERIC_DATA_HEADER ||
-           tapeCurrentBlock->blockType == E_BYTE_HEADER)
-       {
-           processingState = E_HEADER_PILOT;
-           nextProcessingState = E_HEADER_DATA_STREAM;
-       }
-       else if (tapeCurrentBlock->blockType == E_DATA_PILOT)
-       {
-           processingState = E_DATA_PILOT;
-           nextProcessingState = E_DATA_STREAM;
-       }
+// ------------------------------------------------------------------------------------------------------------
 
-       currentBytePtr = 0;
-       currentDataBit = 0;
-       pilotPulseTStates = 0;
-       pilotPulses = 0;
-       dataPulseTStates = 0;
-       flipTapeBit = true;
+int Tape::levelIn(uint32_t tStates) const
+{
+   if (!playing || position + tStates < nextEdge)
+   {
+       return inputBit;
    }
 
-   switch (processingState)
+   // The IN lands past the next edge, so a copy of the cursor is stepped on over the edges in between
+   const uint64_t ts = position + tStates;
+   TapeTimeline::Cursor cursor = timelineCursor;
+   uint64_t edge = nextEdge;
+   int level = inputBit;
+   while (edge <= ts)
    {
-       case E_HEADER_PILOT:
-           generateHeaderPilotWithTs(tStates);
-           break;
-       case E_SYNC1:
-           generateSync1WithTs(tStates);
-           break;
-       case E_SYNC2:
-           generateSync2WithTs(tStates);
-           break;
-       case E_DATA_PILOT:
-           generateDataPilotWithTs(tStates);
-           break;
-       case E_DATA_STREAM:
-           tapeGenerateDataStreamWithTs(tStates);
-           break;
-       case E_HEADER_DATA_STREAM:
-           generateHeaderDataStreamWithTs(tStates);
-           break;
-       case E_DATA_BIT:
-           generateDataBitWithTs(tStates);
-           break;
-       case E_BLOCK_PAUSE:
-           tapeBlockPauseWithTs(tStates);
-           break;
+       level = cursor.level;
+       edge = timeline.nextEdge(cursor);
    }
+   return level;
+}
+
+// ------------------------------------------------------------------------------------------------------------
 
+void Tape::seek(uint64_t newPosition)
+{
+   position = newPosition;
+   timeline.seek(timelineCursor, position);
+   inputBit = playing ? timelineCursor.level : 0;
+   nextEdge = timeline.nextEdge(timelineCursor);
+   nextStop = timeline.nextStopAfter(position);
 }
 
 // ------------------------------------------------------------------------------------------------------------
+// - Process Tape Data
 
-void Tape::generateHeaderPilotWithTs(uint32_t tStates)
+bool Tape::processData(const uint8_t *dataBytes, size_t size)
 {
-   if (pilotPulses < cPILOT_HEADER_PULSES)
+   size_t currentBytePtr = 0;
+
+   while (currentBytePtr + 2 <= size)
    {
-       if (flipTapeBit)
-       {
-           inputBit ^= 1;
-           flipTapeBit = false;
-       }
+       uint32_t blockLength = read16(&dataBytes[ currentBytePtr ]);
 
-       if (pilotPulseTStates >= cPILOT_PULSE_TSTATE_LENGTH)
+       // Move the byte pointer to the top of the actual TAP block
+       currentBytePtr += 2;
+
+       if (blockLength > size - currentBytePtr)
        {
-           pilotPulses += 1;
-           pilotPulseTStates = 0;
-           flipTapeBit = true;
+           std::cout << "TRUNCATED BLOCK FOUND PROCESSING TAP" << "\n";
+           return false;
        }
-   }
-   else
-   {
-       syncPulseTStates = 0;
-       processingState = E_SYNC1;
+
+       addBlock(createDataBlock(&dataBytes[ currentBytePtr ], blockLength));
+
+       currentBytePtr += blockLength;
    }
 
-   pilotPulseTStates += tStates;
+   return true;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::generateDataPilotWithTs(uint32_t tStates)
+bool Tape::processTZX(const uint8_t *dataBytes, size_t size)
 {
-   if (pilotPulses < cPILOT_DATA_PULSES)
+   size_t currentBytePtr = cTZX_HEADER_LENGTH;
+   uint32_t loopStartBlock = 0;
+   uint32_t loopCount = 0;
+
+   while (currentBytePtr < size)
    {
-       if (flipTapeBit)
+       const uint8_t blockID = dataBytes[ currentBytePtr++ ];
+       const uint8_t *header = &dataBytes[ currentBytePtr ];
+       const size_t available = size - currentBytePtr;
+
+       // Each block is a header and, for the blocks that carry them, data bytes. Only the size of the header is fixed,
+       // so enough of it has to be there before any length inside it can be read
+       size_t headerLength = 0;
+       size_t fixedLength = 0;
+       uint32_t dataLength = 0;
+
+       switch (blockID)
        {
-           inputBit ^= 1;
-           flipTapeBit = false;
+           case E_TZX_STANDARD_SPEED:      fixedLength = 4; break;
+           case E_TZX_TURBO_SPEED:         fixedLength = 18; break;
+           case E_TZX_PURE_TONE:           fixedLength = 4; break;
+           case E_TZX_PULSE_SEQUENCE:      fixedLength = 1; break;
+           case E_TZX_PURE_DATA:           fixedLength = 10; break;
+           case E_TZX_DIRECT_RECORDING:    fixedLength = 8; break;
+           case E_TZX_PAUSE:               fixedLength = 2; break;
+           case E_TZX_GROUP_START:         fixedLength = 1; break;
+           case E_TZX_GROUP_END:           fixedLength = 0; break;
+           case E_TZX_JUMP:                fixedLength = 2; break;
+           case E_TZX_LOOP_START:          fixedLength = 2; break;
+           case E_TZX_LOOP_END:            fixedLength = 0; break;
+           case E_TZX_CALL_SEQUENCE:       fixedLength = 2; break;
+           case E_TZX_RETURN:              fixedLength = 0; break;
+           case E_TZX_SELECT:              fixedLength = 2; break;
+           case E_TZX_TEXT:                fixedLength = 1; break;
+           case E_TZX_MESSAGE:             fixedLength = 2; break;
+           case E_TZX_ARCHIVE_INFO:        fixedLength = 2; break;
+           case E_TZX_HARDWARE_TYPE:       fixedLength = 1; break;
+           case E_TZX_CUSTOM_INFO:         fixedLength = 20; break;
+           case E_TZX_GLUE:                fixedLength = 9; break;
+           default:                        fixedLength = 4; break;     // Every other block starts with its length
        }
 
-       if (pilotPulseTStates >= cPILOT_PULSE_TSTATE_LENGTH)
+       if (available < fixedLength)
        {
-           pilotPulses += 1;
-           pilotPulseTStates = 0;
-           flipTapeBit = true;;
+           std::cout << "TRUNCATED BLOCK FOUND PROCESSING TZX" << "\n";
+           return false;
        }
-   }
-   else
-   {
-       syncPulseTStates = 0;
-       processingState = E_SYNC1;
-   }
 
-   pilotPulseTStates += tStates;
-}
+       switch (blockID)
+       {
+           case E_TZX_STANDARD_SPEED:      headerLength = 4; dataLength = read16(&header[ 2 ]); break;
+           case E_TZX_TURBO_SPEED:         headerLength = 18; dataLength = read24(&header[ 15 ]); break;
+           case E_TZX_PULSE_SEQUENCE:      headerLength = 1 + header[ 0 ] * 2u; break;
+           case E_TZX_PURE_DATA:           headerLength = 10; dataLength = read24(&header[ 7 ]); break;
+           case E_TZX_DIRECT_RECORDING:    headerLength = 8; dataLength = read24(&header[ 5 ]); break;
+           case E_TZX_GROUP_START:         headerLength = 1 + header[ 0 ]; break;
+           case E_TZX_CALL_SEQUENCE:       headerLength = 2 + read16(header) * 2u; break;
+           case E_TZX_SELECT:              headerLength = 2 + read16(header); break;
+           case E_TZX_TEXT:                headerLength = 1 + header[ 0 ]; break;
+           case E_TZX_MESSAGE:             headerLength = 2 + header[ 1 ]; break;
+           case E_TZX_ARCHIVE_INFO:        headerLength = 2 + read16(header); break;
+           case E_TZX_HARDWARE_TYPE:       headerLength = 1 + header[ 0 ] * 3u; break;
+           case E_TZX_CUSTOM_INFO:         headerLength = 20 + static_cast<size_t>(read32(&header[ 16 ])); break;
+           case E_TZX_PURE_TONE:
+           case E_TZX_PAUSE:
+           case E_TZX_GROUP_END:
+           case E_TZX_JUMP:
+           case E_TZX_LOOP_START:
+           case E_TZX_LOOP_END:
+           case E_TZX_RETURN:
+           case E_TZX_GLUE:                headerLength = fixedLength; break;
+           default:                        headerLength = 4 + static_cast<size_t>(read32(header)); break;
+       }
 
-// ------------------------------------------------------------------------------------------------------------
+       if (headerLength > available || dataLength > available - headerLength)
+       {
+           std::cout << "TRUNCATED BLOCK FOUND PROCESSING TZX" << "\n";
+           return false;
+       }
 
-void Tape::generateSync1WithTs(uint32_t tStates)
-{
-   if (flipTapeBit)
-   {
-       inputBit ^= 1;
-       flipTapeBit = false;
-   }
+       const uint8_t *data = header + headerLength;
+       TapeBlock *newTapeBlock = nullptr;
 
-   if (syncPulseTStates >= cFIRST_SYNC_PULSE_TSTATE_DELAY)
-   {
-       syncPulseTStates = 0;
-       flipTapeBit = true;
-       processingState = E_SYNC2;
-   }
-   else
-   {
-       syncPulseTStates += tStates;
-   }
-}
+       switch (blockID)
+       {
+           case E_TZX_STANDARD_SPEED:
+           case E_TZX_TURBO_SPEED:
+               newTapeBlock = createDataBlock(data, dataLength);
+               break;
+           case E_TZX_PURE_TONE:
+               newTapeBlock = new SignalBlock("Pure Tone");
+               break;
+           case E_TZX_PULSE_SEQUENCE:
+               newTapeBlock = new SignalBlock("Pulse Sequence");
+               break;
+           case E_TZX_PURE_DATA:
+               newTapeBlock = new SignalBlock("Pure Data");
+               break;
+           case E_TZX_DIRECT_RECORDING:
+               newTapeBlock = new SignalBlock("Direct Recording");
+               break;
+           case E_TZX_CSW_RECORDING:
+               newTapeBlock = new SignalBlock("CSW Recording (Not Supported)");
+               break;
+           case E_TZX_GENERALIZED_DATA:
+               newTapeBlock = new SignalBlock("Generalized Data (Not Supported)");
+               break;
+           case E_TZX_PAUSE:
+               newTapeBlock = new SignalBlock(read16(header) ? "Pause" : "Stop The Tape");
+               break;
+           case E_TZX_GROUP_START:
+               newTapeBlock = new SignalBlock("Group: " + std::string(&header[ 1 ], &header[ 1 ] + header[ 0 ]));
+               break;
+           case E_TZX_GROUP_END:
+               newTapeBlock = new SignalBlock("Group End");
+               break;
+           case E_TZX_LOOP_START:
+               newTapeBlock = new SignalBlock("Loop Start");
+               break;
+           case E_TZX_LOOP_END:
+               newTapeBlock = new SignalBlock("Loop End");
+               break;
+           default:
+               // Jumps, calls and information blocks play nothing and don't appear on the tape
+               break;
+       }
 
-// ------------------------------------------------------------------------------------------------------------
+       if (newTapeBlock)
+       {
+           newTapeBlock->blockID = blockID;
+           newTapeBlock->blockHeader = header;
+           newTapeBlock->blockHeaderLength = static_cast<uint32_t>(headerLength);
+           if (newTapeBlock->blockType == E_SIGNAL_BLOCK && dataLength)
+           {
+               newTapeBlock->blockData = data;
+               newTapeBlock->blockLength = dataLength;
+           }
+           addBlock(newTapeBlock);
+       }
 
-void Tape::generateSync2WithTs(uint32_t tStates)
-{
-   if (flipTapeBit)
-   {
-       inputBit ^= 1;
-       flipTapeBit = false;
-   }
+       // A loop is unrolled by compiling the blocks inside it again, so playing it needs nothing special
+       if (blockID == E_TZX_LOOP_START)
+       {
+           loopStartBlock = static_cast<uint32_t>(blocks.size());
+           loopCount = read16(header);
+       }
+       else if (blockID == E_TZX_LOOP_END && loopCount)
+       {
+           const uint32_t loopEndBlock = static_cast<uint32_t>(blocks.size()) - 1;
+           for (uint32_t repeat = 1; repeat < loopCount; repeat++)
+           {
+               for (uint32_t i = loopStartBlock; i < loopEndBlock; i++)
+               {
+                   compileBlock(i);
+               }
+           }
+           loopCount = 0;
+       }
 
-   if (syncPulseTStates >= cSECOND_SYNC_PULSE_TSTATE_DELAY)
-   {
-       syncPulseTStates = 0;
-       currentBytePtr = 0;
-       flipTapeBit = true;
-       processingState = nextProcessingState;
-   }
-   else
-   {
-       syncPulseTStates += tStates;
+       currentBytePtr += headerLength + dataLength;
    }
+
+   return true;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::tapeGenerateDataStreamWithTs(uint32_t)
+bool Tape::processPZX(const uint8_t *dataBytes, size_t size)
 {
-   size_t currentBlockLength = blocks[ currentBlockIndex ]->getDataLength();
-   uint8_t byte = blocks[ currentBlockIndex ]->blockData[ currentBytePtr ];
-   uint8_t bit = (byte << currentDataBit) & 128;
+   size_t currentBytePtr = 0;
 
-   currentDataBit += 1;
-   if (currentDataBit > 7)
+   while (currentBytePtr + 8 <= size)
    {
-       currentDataBit = 0;
-       currentBytePtr += 1;
-       if (currentBytePtr > currentBlockLength)
+       const uint32_t tag = read32(&dataBytes[ currentBytePtr ]);
+       const uint32_t length = read32(&dataBytes[ currentBytePtr + 4 ]);
+       currentBytePtr += 8;
+
+       if (length > size - currentBytePtr)
        {
-           processingState = E_BLOCK_PAUSE;
-           blockPauseTStates = 0;
-           return;
+           std::cout << "TRUNCATED BLOCK FOUND PROCESSING PZX" << "\n";
+           return false;
        }
-   }
 
-   if (bit)
-   {
-       dataPulseTStates = cDATA_BIT_ONE_PULSE_TSTATE_DELAY;
-   }
-   else
-   {
-       dataPulseTStates = cDATA_BIT_ZERO_PULSE_TSTATE_DELAY;
+       const uint8_t *header = &dataBytes[ currentBytePtr ];
+       TapeBlock *newTapeBlock = nullptr;
+
+       if (tag == cPZX_PULSES)
+       {
+           newTapeBlock = new SignalBlock("Pulse Sequence");
+       }
+       else if (tag == cPZX_DATA)
+       {
+           // The bit count and pulse sequences come before the data bytes
+           if (length < 8 || 8u + (header[ 6 ] + header[ 7 ]) * 2u > length)
+           {
+               std::cout << "INVALID DATA BLOCK FOUND PROCESSING PZX" << "\n";
+               return false;
+           }
+
+           const uint32_t headerLength = 8u + (header[ 6 ] + header[ 7 ]) * 2u;
+           const uint32_t dataLength = ((read32(header) & 0x7fffffff) + 7) / 8;
+           if (dataLength > length - headerLength)
+           {
+               std::cout << "INVALID DATA BLOCK FOUND PROCESSING PZX" << "\n";
+               return false;
+           }
+
+           newTapeBlock = createDataBlock(&header[ headerLength ], dataLength);
+       }
+       else if (tag == cPZX_PAUSE && length >= 4)
+       {
+           newTapeBlock = new SignalBlock("Pause");
+       }
+       else if (tag == cPZX_STOP)
+       {
+           newTapeBlock = new SignalBlock("Stop The Tape");
+       }
+       else if (tag == cPZX_BROWSE)
+       {
+           newTapeBlock = new SignalBlock(std::string(header, header + length));
+       }
+
+       if (newTapeBlock)
+       {
+           newTapeBlock->blockID = tag;
+           newTapeBlock->blockHeader = header;
+           newTapeBlock->blockHeaderLength = length;
+           addBlock(newTapeBlock);
+       }
+
+       currentBytePtr += length;
    }
-   flipTapeBit = true;
-   dataBitTStates = 0;
-   dataPulseCount = 0;
-   processingState = E_DATA_BIT;
+
+   return true;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::generateHeaderDataStreamWithTs(uint32_t)
+TapeBlock *Tape::createDataBlock(const uint8_t *data, uint32_t length)
 {
-   size_t currentBlockLength = cHEADER_BLOCK_LENGTH;
-   uint8_t byte = blocks[ currentBlockIndex ]->blockData[ currentBytePtr ];
-   uint8_t bit = (byte << currentDataBit) & 128;
+   TapeBlock *newTapeBlock;
+
+   const uint8_t flag = (length > cHEADER_FLAG_OFFSET) ? data[ cHEADER_FLAG_OFFSET ] : 0xff;
+   const uint8_t dataType = (length > cHEADER_DATA_TYPE_OFFSET) ? data[ cHEADER_DATA_TYPE_OFFSET ] : 0xff;
 
-   currentDataBit += 1;
-   if (currentDataBit > 7)
+   if (dataType == E_PROGRAM_HEADER && flag != 0xff)
    {
-       currentDataBit = 0;
-       currentBytePtr += 1;
-       tapeCurrentBlock->currentByte += 1;
-       if (currentBytePtr > currentBlockLength)
-       {
-           processingState = E_BLOCK_PAUSE;
-           blockPauseTStates = 0;
-           return;
-       }
+       newTapeBlock = new ProgramHeader;
+       newTapeBlock->blockType = E_PROGRAM_HEADER;
    }
-
-   if (bit)
+   else if (dataType == E_NUMERIC_DATA_HEADER && flag != 0xff)
+   {
+       newTapeBlock = new NumericDataHeader;
+       newTapeBlock->blockType = E_NUMERIC_DATA_HEADER;
+   }
+   else if (dataType == E_ALPHANUMERIC_DATA_HEADER && flag != 0xff)
+   {
+       newTapeBlock = new AlphanumericDataHeader;
+       newTapeBlock->blockType = E_ALPHANUMERIC_DATA_HEADER;
+   }
+   else if (dataType == E_BYTE_HEADER && flag != 0xff)
    {
-       dataPulseTStates = cDATA_BIT_ONE_PULSE_TSTATE_DELAY;
+       newTapeBlock = new ByteHeader;
+       newTapeBlock->blockType = E_BYTE_HEADER;
    }
    else
    {
-       dataPulseTStates = cDATA_BIT_ZERO_PULSE_TSTATE_DELAY;
+       newTapeBlock = new DataBlock;
+       newTapeBlock->blockType = E_DATA_BLOCK;
    }
-   flipTapeBit = true;
-   dataBitTStates = 0;
-   dataPulseCount = 0;
-   processingState = E_DATA_BIT;
+
+   newTapeBlock->blockLength = length;
+   newTapeBlock->blockData = data;
+
+   return newTapeBlock;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::generateDataBitWithTs(uint32_t tStates)
+void Tape::addBlock(TapeBlock *block)
 {
-   if (flipTapeBit)
-   {
-       inputBit ^= 1;
-       flipTapeBit = false;
-   }
+   blocks.push_back(block);
+   compileBlock(static_cast<uint32_t>(blocks.size() - 1));
+}
 
-   if (dataBitTStates >= dataPulseTStates)
+// ------------------------------------------------------------------------------------------------------------
+// - Compile Tape Blocks
+
+// Every block becomes pulses on the timeline here, once, so playing a tape treats all blocks the same way
+void Tape::compileBlock(uint32_t blockIndex)
+{
+   TapeBlock *block = blocks[ blockIndex ];
+   const uint8_t *header = block->blockHeader;
+
+   timeline.beginBlock(blockIndex);
+
+   switch (block->blockID)
    {
-       dataPulseCount += 1;
-       if (dataPulseCount < 2)
+       case E_TZX_STANDARD_SPEED:
        {
-           flipTapeBit = true;
-           dataBitTStates = 0;
+           const uint32_t pilotPulses = (block->blockLength && block->blockData[ cHEADER_FLAG_OFFSET ] < 0x80) ? cPILOT_HEADER_PULSES : cPILOT_DATA_PULSES;
+           compileData(block, cPILOT_PULSE_TSTATE_LENGTH, cFIRST_SYNC_PULSE_TSTATE_DELAY, cSECOND_SYNC_PULSE_TSTATE_DELAY,
+                       cDATA_BIT_ZERO_PULSE_TSTATE_DELAY, cDATA_BIT_ONE_PULSE_TSTATE_DELAY, pilotPulses, 8,
+                       header ? read16(header) : cBLOCK_PAUSE_MS);
+           break;
        }
-       else
+       case E_TZX_TURBO_SPEED:
+           compileData(block, read16(&header[ 0 ]), read16(&header[ 2 ]), read16(&header[ 4 ]), read16(&header[ 6 ]),
+                       read16(&header[ 8 ]), read16(&header[ 10 ]), header[ 12 ], read16(&header[ 13 ]));
+           break;
+       case E_TZX_PURE_TONE:
+           timeline.addTone(read16(&header[ 0 ]), read16(&header[ 2 ]));
+           break;
+       case E_TZX_PULSE_SEQUENCE:
        {
-           processingState = nextProcessingState;
+           std::vector<uint32_t> pulses(header[ 0 ]);
+           for (size_t i = 0; i < pulses.size(); i++)
+           {
+               pulses[ i ] = read16(&header[ 1 + i * 2 ]);
+           }
+           timeline.addPulses(pulses.data(), static_cast<uint32_t>(pulses.size()));
+           break;
        }
-   }
-   else
-   {
-       dataBitTStates += tStates;
+       case E_TZX_PURE_DATA:
+           compileData(block, 0, 0, 0, read16(&header[ 0 ]), read16(&header[ 2 ]), 0, header[ 4 ], read16(&header[ 5 ]));
+           break;
+       case E_TZX_DIRECT_RECORDING:
+           compileDirectRecording(block);
+           break;
+       case E_TZX_PAUSE:
+           if (read16(header))
+           {
+               timeline.addPause(read16(header) * cTSTATES_PER_MS);
+           }
+           else
+           {
+               timeline.addStop();
+           }
+           break;
+       case cPZX_PULSES:
+           compilePZXPulses(block);
+           break;
+       case cPZX_DATA:
+           compilePZXData(block);
+           break;
+       case cPZX_PAUSE:
+           timeline.addTone(read32(header) & 0x7fffffff, 1, read32(header) >> 31);
+           break;
+       case cPZX_STOP:
+           timeline.addStop();
+           break;
+       default:
+           break;
    }
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void Tape::tapeBlockPauseWithTs(uint32_t tStates)
+// A pilot tone, two sync pulses and the data two pulses to a bit, followed by a pause. Any part with no pulses is left out
+void Tape::compileData(TapeBlock *block, uint32_t pilotPulseLength, uint32_t sync1PulseLength, uint32_t sync2PulseLength,
+                       uint32_t zeroPulseLength, uint32_t onePulseLength, uint32_t pilotPulses, uint32_t usedBits,
+                       uint32_t pauseMs)
 {
-   blockPauseTStates += tStates;
-   if (blockPauseTStates > 3500000 * 3)
+   const uint32_t syncPulses[] = { sync1PulseLength, sync2PulseLength };
+   const uint32_t zeroPulses[] = { zeroPulseLength, zeroPulseLength };
+   const uint32_t onePulses[] = { onePulseLength, onePulseLength };
+
+   timeline.addTone(pilotPulseLength, pilotPulses);
+   if (sync1PulseLength || sync2PulseLength)
    {
-       currentBlockIndex += 1;
-       newBlock = true;
+       timeline.addPulses(syncPulses, 2);
    }
 
-   // Introduce a random crackle in between blocks to produce a similar experience as loading from a real tape
-   // on a ZX Spectrum.
-   if (std::rand() == 1)
+   if (block->blockLength)
    {
-       inputBit ^= 1;
+       const uint32_t lastByteBits = (usedBits >= 1 && usedBits <= 8) ? usedBits : 8;
+       timeline.addData(block->blockData, (block->blockLength - 1) * 8 + lastByteBits, zeroPulses, 2, onePulses, 2);
    }
+
+   timeline.addPause(pauseMs * cTSTATES_PER_MS);
 }
 
 // ------------------------------------------------------------------------------------------------------------
-// - Process Tape Data
 
-bool Tape::processData(uint8_t *dataBytes, uint32_t size)
+// Each bit of a direct recording is a sample of the level, so runs of equal samples become pulses
+void Tape::compileDirectRecording(TapeBlock *block)
 {
-   uint16_t blockLength = 0;
-   uint8_t flag = 0;
-   uint8_t dataType = 0;
-   currentBytePtr = 0;
+   const uint8_t *header = block->blockHeader;
+   const uint32_t tStatesPerSample = read16(&header[ 0 ]);
+   const uint32_t pauseMs = read16(&header[ 2 ]);
+   const uint32_t usedBits = (header[ 4 ] >= 1 && header[ 4 ] <= 8) ? header[ 4 ] : 8;
 
-   while (currentBytePtr < size)
+   if (block->blockLength == 0)
    {
-       blockLength = (reinterpret_cast<uint16_t*>(&dataBytes[ currentBytePtr ])[0]);
-
-       // Move the byte pointer to the top of the actual TAP block
-       currentBytePtr += 2;
-
-       flag = dataBytes[ currentBytePtr  + cHEADER_FLAG_OFFSET ];
-       dataType = dataBytes[ currentBytePtr + cHEADER_DATA_TYPE_OFFSET ];
+       timeline.addPause(pauseMs * cTSTATES_PER_MS);
+       return;
+   }
 
-       TapeBlock *newTapeBlock;
+   const uint32_t samples = (block->blockLength - 1) * 8 + usedBits;
+   auto sample = [block](uint32_t i) { return (block->blockData[ i >> 3 ] >> (7 - (i & 7))) & 1; };
 
-       if (dataType == E_PROGRAM_HEADER && flag != 0xff)
-       {
-           newTapeBlock = new ProgramHeader;
-           newTapeBlock->blockType = E_PROGRAM_HEADER;
-       }
-       else if (dataType == E_NUMERIC_DATA_HEADER && flag != 0xff)
-       {
-           newTapeBlock = new NumericDataHeader;
-           newTapeBlock->blockType = E_NUMERIC_DATA_HEADER;
-       }
-       else if (dataType == E_ALPHANUMERIC_DATA_HEADER && flag != 0xff)
+   std::vector<uint32_t> pulses;
+   uint32_t run = 0;
+   for (uint32_t i = 0; i < samples; i++)
+   {
+       if (i && sample(i) != sample(i - 1))
        {
-           newTapeBlock = new AlphanumericDataHeader;
-           newTapeBlock->blockType = E_ALPHANUMERIC_DATA_HEADER;
+           pulses.push_back(run * tStatesPerSample);
+           run = 0;
        }
-       else if (dataType == E_BYTE_HEADER && flag != 0xff)
+       run++;
+   }
+   pulses.push_back(run * tStatesPerSample);
+
+   timeline.addPulses(pulses.data(), static_cast<uint32_t>(pulses.size()), sample(0));
+   timeline.addPause(pauseMs * cTSTATES_PER_MS);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+// Each entry is a pulse length, optionally repeated, and lengths over 32767 T-states take two words. The block starts
+// low, and pulses with no length flip the level, which is how a block starts high
+void Tape::compilePZXPulses(TapeBlock *block)
+{
+   const uint8_t *header = block->blockHeader;
+   const uint8_t *end = header + block->blockHeaderLength;
+   int level = 0;
+
+   while (header + 2 <= end)
+   {
+       uint32_t count = 1;
+       uint32_t duration = read16(header);
+       header += 2;
+
+       if (duration > 0x8000)
        {
-           newTapeBlock = new ByteHeader;
-           newTapeBlock->blockType = E_BYTE_HEADER;
+           if (header + 2 > end)
+           {
+               break;
+           }
+           count = duration & 0x7fff;
+           duration = read16(header);
+           header += 2;
        }
-       else
+
+       if (duration >= 0x8000)
        {
-           newTapeBlock = new DataBlock;
-           newTapeBlock->blockType = E_DATA_BLOCK;
+           if (header + 2 > end)
+           {
+               break;
+           }
+           duration = ((duration & 0x7fff) << 16) | read16(header);
+           header += 2;
        }
 
-       if (!newTapeBlock)
+       if (duration == 0 && level >= 0)
        {
-           std::cout << "INVALID FLAG FOUND PROCESSING TAP" << "\n";
-           return false;
+           level ^= count & 1;
+           continue;
        }
 
-       newTapeBlock->blockLength = blockLength;
-       newTapeBlock->blockData = new uint8_t[blockLength];
-       memcpy(newTapeBlock->blockData, &dataBytes[ currentBytePtr ], blockLength);
+       timeline.addTone(duration, count, level);
+       level = -1;
+   }
+}
 
-       blocks.push_back(newTapeBlock);
+// ------------------------------------------------------------------------------------------------------------
 
-       currentBytePtr += blockLength;
-       
+// A PZX data block gives the pulses of a zero and a one bit, the level the data starts at and a tail pulse at the end
+void Tape::compilePZXData(TapeBlock *block)
+{
+   const uint8_t *header = block->blockHeader;
+   const uint32_t bitCount = read32(&header[ 0 ]) & 0x7fffffff;
+   const int level = static_cast<int>(read32(&header[ 0 ]) >> 31);
+   const uint32_t tailLength = read16(&header[ 4 ]);
+
+   std::vector<uint32_t> zeroPulses(header[ 6 ]);
+   std::vector<uint32_t> onePulses(header[ 7 ]);
+   for (size_t i = 0; i < zeroPulses.size(); i++)
+   {
+       zeroPulses[ i ] = read16(&header[ 8 + i * 2 ]);
+   }
+   for (size_t i = 0; i < onePulses.size(); i++)
+   {
+       onePulses[ i ] = read16(&header[ 8 + (zeroPulses.size() + i) * 2 ]);
    }
 
-   return true;
+   timeline.addData(block->blockData, bitCount, zeroPulses.data(), static_cast<uint32_t>(zeroPulses.size()),
+                    onePulses.data(), static_cast<uint32_t>(onePulses.size()), level);
+   timeline.addTone(tailLength, 1);
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -686,27 +1032,50 @@ void Tape::loadBlockWithMachine(void *m)
 {
    ZXSpectrum *machine = static_cast<ZXSpectrum *>(m);
 
+   // Only blocks holding data can be loaded by the ROM, so anything else on a TZX or PZX tape is passed over
+   while (currentBlockIndex < blocks.size() && blocks[ currentBlockIndex ]->blockType == E_SIGNAL_BLOCK)
+   {
+       currentBlockIndex++;
+   }
+
    // Stops us trying to read past the avaiable blocks. This is a hack and should be fixed properly at source
    if (currentBlockIndex >= blocks.size())
    {
        currentBlockIndex = 0;
+       while (currentBlockIndex < blocks.size() && blocks[ currentBlockIndex ]->blockType == E_SIGNAL_BLOCK)
+       {
+           currentBlockIndex++;
+       }
+
+       if (currentBlockIndex >= blocks.size())
+       {
+           currentBlockIndex = 0;
+           machine->z80Core.SetRegister(CZ80CoreBase::eREG_F, (machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & ~CZ80CoreBase::FLAG_C));
+           machine->z80Core.SetRegister(CZ80CoreBase::eREG_PC, 0x05e2);
+           return;
+       }
    }
 
-   uint32_t expectedBlockType = machine->z80Core.GetRegister(CZ80Core::eREG_ALT_A);
-   uint16_t startAddress = machine->z80Core.GetRegister(CZ80Core::eREG_IX);
+   uint32_t expectedBlockType = machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_A);
+   uint16_t startAddress = machine->z80Core.GetRegister(CZ80CoreBase::eREG_IX);
 
    // Some TAP files have blocks which are shorter than what is expected in DE (Chuckie Egg 2)
-   // so just take the smallest value
-   uint32_t blockLength = machine->z80Core.GetRegister(CZ80Core::eREG_DE);
-   uint32_t tapBlockLength = blocks[ currentBlockIndex ]->getDataLength();
-   blockLength = (blockLength < tapBlockLength) ? blockLength : tapBlockLength;
+   // so just take the smallest value. The flag is the first byte of the block, so no more than the bytes after it can
+   // be loaded, and the checksum is the last byte of the block whatever type the block is
+   const uint32_t tapBlockLength = blocks[ currentBlockIndex ]->blockLength;
+   uint32_t blockLength = machine->z80Core.GetRegister(CZ80CoreBase::eREG_DE);
+   blockLength = (tapBlockLength == 0) ? 0 : std::min(blockLength, tapBlockLength - 1);
    uint32_t success = 1;
 
-   if (blocks[ currentBlockIndex ]->getFlag() == expectedBlockType)
+   if (tapBlockLength == 0)
    {
-       if (machine->z80Core.GetRegister(CZ80Core::eREG_ALT_F) & CZ80Core::FLAG_C)
+       success = 0;
+   }
+   else if (blocks[ currentBlockIndex ]->getFlag() == expectedBlockType)
+   {
+       if (machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_F) & CZ80CoreBase::FLAG_C)
        {
-           currentBytePtr = cHEADER_DATA_TYPE_OFFSET;
+           uint32_t currentBytePtr = cHEADER_DATA_TYPE_OFFSET;
            uint32_t checksum = expectedBlockType;
 
            for (uint16_t i = 0; i < blockLength; i++)
@@ -717,7 +1086,7 @@ void Tape::loadBlockWithMachine(void *m)
                currentBytePtr++;
            }
 
-           size_t expectedChecksum = blocks[ currentBlockIndex ]->getChecksum();
+           const uint8_t expectedChecksum = blocks[ currentBlockIndex ]->blockData[ tapBlockLength - 1 ];
            if (expectedChecksum != checksum)
            {
                success = 0;
@@ -731,15 +1100,16 @@ void Tape::loadBlockWithMachine(void *m)
 
    if (success)
    {
-       machine->z80Core.SetRegister(CZ80Core::eREG_F, (machine->z80Core.GetRegister(CZ80Core::eREG_F) | CZ80Core::FLAG_C));
+       machine->z80Core.SetRegister(CZ80CoreBase::eREG_F, (machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) | CZ80CoreBase::FLAG_C));
    }
    else
    {
-       machine->z80Core.SetRegister(CZ80Core::eREG_F, (machine->z80Core.GetRegister(CZ80Core::eREG_F) & ~CZ80Core::FLAG_C));
+       machine->z80Core.SetRegister(CZ80CoreBase::eREG_F, (machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & ~CZ80CoreBase::FLAG_C));
    }
 
    currentBlockIndex++;
-   machine->z80Core.SetRegister(CZ80Core::eREG_PC, 0x05e2);
+   seek(timeline.blockStart(currentBlockIndex));
+   machine->z80Core.SetRegister(CZ80CoreBase::eREG_PC, 0x05e2);
 
    if (updateStatusCallback)
    {
@@ -755,41 +1125,38 @@ void Tape::saveBlockWithMachine(void *m)
    ZXSpectrum *machine = static_cast<ZXSpectrum *>(m);
 
    uint8_t parity = 0;
-   uint16_t length = machine->z80Core.GetRegister(CZ80Core::eREG_DE) + 2;
-   uint16_t dataIndex = 0;
+   uint32_t length = machine->z80Core.GetRegister(CZ80CoreBase::eREG_DE) + 2;
+   uint32_t dataIndex = 0;
    loaded = true;
 
    uint8_t *pData = new uint8_t[ length ];
 
    if (pData != nullptr)
    {
-       pData[dataIndex++] = length & 255;
-       pData[dataIndex++] = length >> 8;
-
-       parity = machine->z80Core.GetRegister(CZ80Core::eREG_A);
+       parity = machine->z80Core.GetRegister(CZ80CoreBase::eREG_A);
 
        pData[dataIndex++] = parity;
 
-       for (uint16_t i = 0; i < machine->z80Core.GetRegister(CZ80Core::eREG_DE); i++)
+       for (uint16_t i = 0; i < machine->z80Core.GetRegister(CZ80CoreBase::eREG_DE); i++)
        {
            // Read memory using the debug read from the core which takes into account any paging
            // on the 128k Spectrum
-           uint8_t byte = static_cast<uint8_t>(machine->z80Core.Z80CoreDebugMemRead(machine->z80Core.GetRegister(CZ80Core::eREG_IX) + i, nullptr));
+           uint8_t byte = static_cast<uint8_t>(machine->z80Core.Z80CoreDebugMemRead(machine->z80Core.GetRegister(CZ80CoreBase::eREG_IX) + i, nullptr));
            parity ^= byte;
            pData[dataIndex++] = byte;
        }
 
        pData[dataIndex++] = parity;
 
-       processData(pData, length);
+       // The new block keeps the bytes it was saved with, there being no file behind it
+       TapeBlock *newTapeBlock = createDataBlock(pData, length);
+       newTapeBlock->blockDataOwned = true;
+       addBlock(newTapeBlock);
+       seek(position);
 
        // Once a block has been saved this is the RET address
-       machine->z80Core.SetRegister(CZ80Core::eREG_PC, 0x053e);
-
-       delete[] pData;
+       machine->z80Core.SetRegister(CZ80CoreBase::eREG_PC, 0x053e);
    }
-
-   newBlock = true;
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -800,6 +1167,7 @@ void Tape::play()
    if (loaded)
    {
        playing = true;
+       seek(position);
        if (updateStatusCallback)
        {
            updateStatusCallback(static_cast<int>(currentBlockIndex), 0, TAPEACTION::E_TAPE_PLAY);
@@ -842,13 +1210,7 @@ void Tape::rewindBlock()
 {
    if (loaded)
    {
-       inputBit = 0;
-       currentBytePtr = 0;
-       currentDataBit = 0;
-       pilotPulseTStates = 0;
-       pilotPulses = 0;
-       dataPulseTStates = 0;
-       flipTapeBit = true;
+       seek(timeline.blockStart(currentBlockIndex));
        
        if (updateStatusCallback)
        {
@@ -878,6 +1240,12 @@ std::vector<uint8_t> Tape::getTapeData()
    std::vector<uint8_t> tapeData;
    for (size_t i = 0; i < blocks.size(); i++)
    {    
+       // Only blocks holding data can be written to a TAP file
+       if (blocks[ i ]->blockType == E_SIGNAL_BLOCK)
+       {
+           continue;
+       }
+
        uint16_t blockLength = blocks[ i ]->getDataLength();
        tapeData.push_back(blockLength & 0xff);
        tapeData.push_back(blockLength >> 8);
@@ -902,6 +1270,7 @@ size_t Tape::numberOfTapeBlocks()
 void  Tape::setCurrentBlock(uint32_t blockIndex)
 {
    currentBlockIndex = blockIndex;
+   seek(timeline.blockStart(currentBlockIndex));
 }
 
 
@@ -918,3 +1287,25 @@ void  Tape::setCurrentBlock(uint32_t blockIndex)
 
 
 
+
+// ------------------------------------------------------------------------------------------------------------
+// - Playback State
+
+void Tape::getPlaybackState(PlaybackState &state) const
+{
+   state.playing = playing;
+   state.inputBit = inputBit;
+   state.currentBlockIndex = currentBlockIndex;
+   state.position = position;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void Tape::setPlaybackState(const PlaybackState &state)
+{
+   // Playback picks up again from its position on the timeline, as long as a tape long enough is still inserted
+   playing = state.playing && loaded && state.position < timeline.length();
+   seek(std::min(state.position, timeline.length()));
+   currentBlockIndex = state.currentBlockIndex;
+   inputBit = state.inputBit;
+}
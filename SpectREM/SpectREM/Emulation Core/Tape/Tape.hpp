@@ -12,6 +12,11 @@
 #include <vector>
 #include <iostream>
 #include <fstream>
+#include <functional>
+#include <memory>
+
+#include "MappedFile.hpp"
+#include "TapeTimeline.hpp"
 
 
 // - Tape Block
@@ -33,10 +38,17 @@ public:
     virtual std::string     getFilename();
 
 public:
-    uint16_t                blockLength = 0;
-    uint8_t               * blockData = nullptr;
+    uint32_t                blockLength = 0;
+    const uint8_t         * blockData = nullptr;            // Points into the tape file, unless the block owns it
+    bool                    blockDataOwned = false;
     int                     blockType = 0;
     int                     currentByte = 0;
+
+    // How the block is played. The id is the TZX block id or PZX tag the block was read from, with TAP blocks and
+    // blocks saved by the ROM played as TZX standard speed blocks. The header is the rest of the block in the file
+    uint32_t                blockID = 0x10;
+    const uint8_t         * blockHeader = nullptr;
+    uint32_t                blockHeaderLength = 0;
 };
 
 
@@ -99,11 +111,34 @@ public:
 };
 
 
+// - Tape Signal Block
+
+
+// Blocks from TZX and PZX files that play pulses without holding data the ROM could load, or mark a place on the tape
+class SignalBlock : public TapeBlock
+{
+public:
+    SignalBlock(const std::string &name);
+
+public:
+    virtual uint8_t         getFlag();
+    virtual uint8_t         getDataType();
+    virtual uint8_t         getChecksum();
+    virtual std::string     getBlockName();
+    virtual std::string     getFilename();
+
+public:
+    std::string             blockName;
+};
+
+
 // - Main Tape Processing Class
 
 
 class Tape
 {
+    friend class SignalBlock;
+
     // TAPE block types
     enum
     {
@@ -113,21 +148,38 @@ class Tape
         E_BYTE_HEADER,
         E_DATA_BLOCK,
         E_FRAGMENTED_DATA_BLOCK,
+        E_SIGNAL_BLOCK,
         E_UNKNOWN_BLOCK = 99
     };
 
-    // TAP Processing states
+    // TZX block ids
     enum
     {
-        E_NO_TAPE = 0,
-        E_HEADER_PILOT,
-        E_SYNC1,
-        E_SYNC2,
-        E_DATA_PILOT,
-        E_BLOCK_PAUSE,
-        E_DATA_STREAM,
-        E_HEADER_DATA_STREAM,
-        E_DATA_BIT
+        E_TZX_STANDARD_SPEED = 0x10,
+        E_TZX_TURBO_SPEED = 0x11,
+        E_TZX_PURE_TONE = 0x12,
+        E_TZX_PULSE_SEQUENCE = 0x13,
+        E_TZX_PURE_DATA = 0x14,
+        E_TZX_DIRECT_RECORDING = 0x15,
+        E_TZX_CSW_RECORDING = 0x18,
+        E_TZX_GENERALIZED_DATA = 0x19,
+        E_TZX_PAUSE = 0x20,
+        E_TZX_GROUP_START = 0x21,
+        E_TZX_GROUP_END = 0x22,
+        E_TZX_JUMP = 0x23,
+        E_TZX_LOOP_START = 0x24,
+        E_TZX_LOOP_END = 0x25,
+        E_TZX_CALL_SEQUENCE = 0x26,
+        E_TZX_RETURN = 0x27,
+        E_TZX_SELECT = 0x28,
+        E_TZX_STOP_48K = 0x2a,
+        E_TZX_SET_LEVEL = 0x2b,
+        E_TZX_TEXT = 0x30,
+        E_TZX_MESSAGE = 0x31,
+        E_TZX_ARCHIVE_INFO = 0x32,
+        E_TZX_HARDWARE_TYPE = 0x33,
+        E_TZX_CUSTOM_INFO = 0x35,
+        E_TZX_GLUE = 0x5a
     };
 
     // Tape player actions
@@ -151,6 +203,14 @@ public:
         std::string responseMsg;
     };
     
+    // Where playback has got to, saved along with a machine's state. The blocks on the tape are not included
+    struct PlaybackState {
+        bool        playing;
+        int         inputBit;
+        uint32_t    currentBlockIndex;
+        uint64_t    position;
+    };
+    
 public:
     Tape(std::function<void(int blockIndex, int bytes, int action)> callback);
     virtual ~Tape();
@@ -166,8 +226,12 @@ public:
     void                    loadBlockWithMachine(void *m);
     void                    saveBlockWithMachine(void *m);
 
-    // Updates the tape to generate the tape output. Tstates passed in should be the tStates used in each opcode executed
-    void                    updateWithTs(uint32_t tStates);
+    // Moves playback on by the given number of T-states, applying every edge passed on the way. The time to the next
+    // edge tells the machine when it next needs to call this, so the cost of playing the tape is per edge rather than
+    // per instruction
+    void                    advance(uint32_t tStates);
+    uint32_t                tsToNextEdge() const;
+    int                     levelIn(uint32_t tStates) const;
 
     // Functions used to control the state of the currently loaded tape
     void                    play();
@@ -184,40 +248,44 @@ public:
     // Returns a vector that contains the current tape data ready to write to disk
     std::vector<uint8_t>    getTapeData();
 
+    void                    getPlaybackState(PlaybackState &state) const;
+    void                    setPlaybackState(const PlaybackState &state);
+
 private:
     void                    resetAndClearBlocks(bool clearBlocks);
-    bool                    processData(uint8_t *fileBytes, uint32_t size);
-    void                    generateHeaderPilotWithTs(uint32_t tStates);
-    void                    generateSync1WithTs(uint32_t tStates);
-    void                    generateSync2WithTs(uint32_t tStates);
-    void                    generateDataPilotWithTs(uint32_t tStates);
-    void                    tapeGenerateDataStreamWithTs(uint32_t tStates);
-    void                    generateHeaderDataStreamWithTs(uint32_t tStates);
-    void                    generateDataBitWithTs(uint32_t tStates);
-    void                    tapeBlockPauseWithTs(uint32_t tStates);
+
+    // Parse a tape file into blocks, compiling each onto the timeline as it is added. Blocks point into the file rather
+    // than copying it
+    bool                    processData(const uint8_t *fileBytes, size_t size);
+    bool                    processTZX(const uint8_t *fileBytes, size_t size);
+    bool                    processPZX(const uint8_t *fileBytes, size_t size);
+    TapeBlock             * createDataBlock(const uint8_t *data, uint32_t length);
+    void                    addBlock(TapeBlock *block);
+
+    void                    compileBlock(uint32_t blockIndex);
+    void                    compileData(TapeBlock *block, uint32_t pilotPulseLength, uint32_t sync1PulseLength,
+                                        uint32_t sync2PulseLength, uint32_t zeroPulseLength, uint32_t onePulseLength,
+                                        uint32_t pilotPulses, uint32_t usedBits, uint32_t pauseMs);
+    void                    compileDirectRecording(TapeBlock *block);
+    void                    compilePZXPulses(TapeBlock *block);
+    void                    compilePZXData(TapeBlock *block);
+
+    void                    seek(uint64_t position);
 
 public:
     bool                    loaded = false;
     bool                    playing = false;
     uint32_t                currentBlockIndex = 0;
-    bool                    newBlock = false;
     std::vector<TapeBlock *> blocks;
     int                     inputBit = 0;
 
 private:
-    uint32_t                currentBytePtr      = 0;
-    uint32_t                pilotPulseTStates   = 0;          // How many Ts have passed since the start of the pilot pulses
-    uint32_t                pilotPulses         = 0;          // How many pilot pulses have been generated
-    uint32_t                syncPulseTStates    = 0;          // Sync pulse tStates
-    uint32_t                dataPulseTStates    = 0;          // How many Ts have passed since the start of the data pulse
-    bool                    flipTapeBit         = false;      // Should the tape bit be flipped
-    uint32_t                processingState     = 0;          // Current processing state e.g. generating pilot, streaming data
-    uint32_t                nextProcessingState = 0;          // Next processing state to be used
-    uint32_t                currentDataBit      = 0;          // Which bit of the current byte in the data stream is being processed
-    uint32_t                blockPauseTStates   = 0;          // How many tStates have passed since starting the pause between data blocks
-    uint32_t                dataBitTStates      = 0;          // How many tStates to pause when processing data bit pulses
-    uint32_t                dataPulseCount      = 0;          // How many pulses have been generated for the current data bit;
-    TapeBlock               *tapeCurrentBlock   = nullptr;    // Current tape block object
+    std::unique_ptr<MappedFile> tapeFile;                     // File the blocks were read from
+    TapeTimeline            timeline;                         // Pulses of every block on the tape
+    TapeTimeline::Cursor    timelineCursor;                   // Next edge to be played
+    uint64_t                position            = 0;          // T-states played from the start of the tape
+    uint64_t                nextEdge            = TapeTimeline::cNO_EDGE;
+    uint64_t                nextStop            = TapeTimeline::cNO_EDGE;
 
     // Function called whenever the status of the tape changes e.g. new block, rewind, stop etc
     std::function<void(int blockIndex, int bytes, int action)> updateStatusCallback = nullptr;
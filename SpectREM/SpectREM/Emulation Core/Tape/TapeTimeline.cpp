@@ -0,0 +1,465 @@
+//
+//  TapeTimeline.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "TapeTimeline.hpp"
+
+#include <algorithm>
+
+// ------------------------------------------------------------------------------------------------------------
+// - Constants
+
+static const uint32_t cPAUSE_EDGE_TSTATE_LENGTH = 3500;     // 1ms the level is held for after the edge that starts a pause
+
+// ------------------------------------------------------------------------------------------------------------
+
+static uint32_t bitsSet(uint8_t byte)
+{
+    uint32_t count = 0;
+    for (; byte; byte &= byte - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Building
+
+void TapeTimeline::clear()
+{
+    timelineSegments.clear();
+    timelinePulseLengths.clear();
+    blockFirstSegment.clear();
+    timelineStops.clear();
+    timelineBlock = 0;
+    timelineLength = 0;
+    timelineEndLevel = 0;
+    timelinePendingFlip = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::beginBlock(uint32_t block)
+{
+    // A block repeated by a loop keeps the offset it was first given
+    if (block >= blockFirstSegment.size())
+    {
+        blockFirstSegment.resize(block + 1, static_cast<uint32_t>(timelineSegments.size()));
+    }
+    timelineBlock = block;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addTone(uint32_t pulseLength, uint32_t count, int level)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Pulses that take no time still flip the level, which the next segment picks up
+    if (pulseLength == 0)
+    {
+        timelinePendingFlip ^= count & 1;
+        return;
+    }
+
+    Segment segment{};
+    segment.type = E_TONE;
+    segment.pulseLength = pulseLength;
+    segment.count = count;
+    segment.duration = static_cast<uint64_t>(pulseLength) * count;
+    addSegment(segment, level, count);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addPulses(const uint32_t *pulseLengths, uint32_t count, int level)
+{
+    // Split the list wherever a pulse takes no time so every pulse in a segment has a length
+    uint32_t runStart = 0;
+    for (uint32_t i = 0; i <= count; i++)
+    {
+        if (i < count && pulseLengths[ i ] != 0)
+        {
+            continue;
+        }
+
+        if (i > runStart)
+        {
+            Segment segment{};
+            segment.type = E_PULSES;
+            segment.first = static_cast<uint32_t>(timelinePulseLengths.size());
+            segment.count = i - runStart;
+            for (uint32_t p = runStart; p < i; p++)
+            {
+                timelinePulseLengths.push_back(pulseLengths[ p ]);
+                segment.duration += pulseLengths[ p ];
+            }
+            addSegment(segment, level, segment.count);
+            level = -1;
+        }
+
+        if (i < count)
+        {
+            timelinePendingFlip ^= 1;
+        }
+        runStart = i + 1;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addData(const uint8_t *data, uint32_t bitCount, const uint32_t *zeroPulses, uint32_t zeroCount,
+                           const uint32_t *onePulses, uint32_t oneCount, int level)
+{
+    if (bitCount == 0 || zeroCount == 0 || oneCount == 0)
+    {
+        return;
+    }
+
+    Segment segment{};
+    segment.type = E_DATA;
+    segment.data = data;
+    segment.count = bitCount;
+    segment.zeroCount = zeroCount;
+    segment.oneCount = oneCount;
+
+    segment.first = static_cast<uint32_t>(timelinePulseLengths.size());
+    for (uint32_t i = 0; i < zeroCount; i++)
+    {
+        timelinePulseLengths.push_back(zeroPulses[ i ]);
+        segment.zeroLength += zeroPulses[ i ];
+    }
+
+    segment.oneFirst = static_cast<uint32_t>(timelinePulseLengths.size());
+    for (uint32_t i = 0; i < oneCount; i++)
+    {
+        timelinePulseLengths.push_back(onePulses[ i ]);
+        segment.oneLength += onePulses[ i ];
+    }
+
+    if (segment.zeroLength == 0 || segment.oneLength == 0)
+    {
+        return;
+    }
+
+    uint64_t ones = 0;
+    for (uint32_t i = 0; i < bitCount / 8; i++)
+    {
+        ones += bitsSet(data[ i ]);
+    }
+    if (bitCount & 7)
+    {
+        ones += bitsSet(data[ bitCount / 8 ] & static_cast<uint8_t>(0xff00 >> (bitCount & 7)));
+    }
+
+    const uint64_t zeros = bitCount - ones;
+    segment.duration = ones * segment.oneLength + zeros * segment.zeroLength;
+    addSegment(segment, level, ones * oneCount + zeros * zeroCount);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addPause(uint32_t tStates)
+{
+    if (tStates == 0)
+    {
+        return;
+    }
+
+    addTone(std::min(tStates, cPAUSE_EDGE_TSTATE_LENGTH), 1);
+    if (tStates > cPAUSE_EDGE_TSTATE_LENGTH)
+    {
+        addTone(tStates - cPAUSE_EDGE_TSTATE_LENGTH, 1, 0);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addStop()
+{
+    if (timelineStops.empty() || timelineStops.back() != timelineLength)
+    {
+        timelineStops.push_back(timelineLength);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void TapeTimeline::addSegment(Segment &segment, int level, uint64_t pulseCount)
+{
+    if (blockFirstSegment.empty())
+    {
+        beginBlock(0);
+    }
+
+    segment.block = timelineBlock;
+    segment.start = timelineLength;
+    segment.startLevel = (level < 0) ? (timelineEndLevel ^ 1 ^ timelinePendingFlip) : static_cast<uint8_t>(level & 1);
+    segment.edgeAtStart = segment.startLevel != timelineEndLevel;
+
+    timelineSegments.push_back(segment);
+    timelineLength += segment.duration;
+    timelineEndLevel = segment.startLevel ^ ((pulseCount - 1) & 1);
+    timelinePendingFlip = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Queries
+
+uint64_t TapeTimeline::blockStart(uint32_t block) const
+{
+    if (block >= blockFirstSegment.size() || blockFirstSegment[ block ] >= timelineSegments.size())
+    {
+        return timelineLength;
+    }
+    return timelineSegments[ blockFirstSegment[ block ] ].start;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t TapeTimeline::blockAt(uint64_t ts) const
+{
+    if (timelineSegments.empty())
+    {
+        return 0;
+    }
+
+    const uint32_t segment = segmentAt(ts);
+    if (segment >= timelineSegments.size())
+    {
+        return timelineSegments.back().block;
+    }
+    return timelineSegments[ segment ].block;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t TapeTimeline::levelAt(uint64_t ts) const
+{
+    Cursor cursor;
+    seek(cursor, ts);
+    return cursor.level;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint64_t TapeTimeline::nextEdgeAfter(uint64_t ts) const
+{
+    Cursor cursor;
+    seek(cursor, ts);
+    return nextEdge(cursor);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint64_t TapeTimeline::nextStopAfter(uint64_t ts) const
+{
+    auto it = std::upper_bound(timelineStops.begin(), timelineStops.end(), ts);
+    return (it != timelineStops.end()) ? *it : cNO_EDGE;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t TapeTimeline::segmentAt(uint64_t ts) const
+{
+    if (ts >= timelineLength)
+    {
+        return static_cast<uint32_t>(timelineSegments.size());
+    }
+
+    auto it = std::upper_bound(timelineSegments.begin(), timelineSegments.end(), ts, [](uint64_t t, const Segment &s) {
+        return t < s.start;
+    });
+    return static_cast<uint32_t>(it - timelineSegments.begin()) - 1;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Playback
+
+void TapeTimeline::seek(Cursor &cursor, uint64_t ts) const
+{
+    cursor = Cursor();
+    cursor.segment = segmentAt(ts);
+
+    if (cursor.segment >= timelineSegments.size())
+    {
+        cursor.pulseStart = timelineLength;
+        cursor.level = timelineEndLevel;
+        return;
+    }
+
+    const Segment &segment = timelineSegments[ cursor.segment ];
+    uint64_t offset = ts - segment.start;
+    uint64_t pulses = 0;
+    cursor.pulseStart = segment.start;
+
+    switch (segment.type)
+    {
+        case E_TONE:
+            pulses = offset / segment.pulseLength;
+            cursor.pulse = static_cast<uint32_t>(pulses);
+            cursor.pulseStart += pulses * segment.pulseLength;
+            break;
+
+        case E_PULSES:
+            while (offset >= timelinePulseLengths[ segment.first + cursor.pulse ])
+            {
+                offset -= timelinePulseLengths[ segment.first + cursor.pulse ];
+                cursor.pulseStart += timelinePulseLengths[ segment.first + cursor.pulse ];
+                cursor.pulse++;
+            }
+            pulses = cursor.pulse;
+            break;
+
+        case E_DATA:
+        {
+            // Whole bytes first, then bits, then the pulses of the bit
+            for (uint32_t byte = 0; cursor.bit + 8 <= segment.count; byte++)
+            {
+                const uint32_t ones = bitsSet(segment.data[ byte ]);
+                const uint64_t byteLength = ones * segment.oneLength + (8 - ones) * segment.zeroLength;
+                if (offset < byteLength)
+                {
+                    break;
+                }
+                offset -= byteLength;
+                cursor.pulseStart += byteLength;
+                pulses += ones * segment.oneCount + (8 - ones) * segment.zeroCount;
+                cursor.bit += 8;
+            }
+
+            for (;;)
+            {
+                const bool one = dataBit(segment, cursor.bit);
+                const uint32_t bitLength = one ? segment.oneLength : segment.zeroLength;
+                if (offset < bitLength)
+                {
+                    break;
+                }
+                offset -= bitLength;
+                cursor.pulseStart += bitLength;
+                pulses += one ? segment.oneCount : segment.zeroCount;
+                cursor.bit++;
+            }
+
+            const uint32_t first = dataBit(segment, cursor.bit) ? segment.oneFirst : segment.first;
+            while (offset >= timelinePulseLengths[ first + cursor.pulse ])
+            {
+                offset -= timelinePulseLengths[ first + cursor.pulse ];
+                cursor.pulseStart += timelinePulseLengths[ first + cursor.pulse ];
+                cursor.pulse++;
+            }
+            pulses += cursor.pulse;
+            break;
+        }
+    }
+
+    cursor.level = segment.startLevel ^ (pulses & 1);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint64_t TapeTimeline::nextEdge(Cursor &cursor) const
+{
+    while (stepPulse(cursor))
+    {
+        if (cursor.pulse != 0 || cursor.bit != 0 || timelineSegments[ cursor.segment ].edgeAtStart)
+        {
+            return cursor.pulseStart;
+        }
+    }
+    return cNO_EDGE;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t TapeTimeline::blockOf(const Cursor &cursor) const
+{
+    if (cursor.segment >= timelineSegments.size())
+    {
+        return timelineSegments.empty() ? 0 : timelineSegments.back().block;
+    }
+    return timelineSegments[ cursor.segment ].block;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool TapeTimeline::stepPulse(Cursor &cursor) const
+{
+    if (cursor.segment >= timelineSegments.size())
+    {
+        return false;
+    }
+
+    const Segment &segment = timelineSegments[ cursor.segment ];
+    cursor.pulseStart += pulseLength(segment, cursor);
+    cursor.pulse++;
+
+    if (segment.type == E_DATA)
+    {
+        if (cursor.pulse < (dataBit(segment, cursor.bit) ? segment.oneCount : segment.zeroCount))
+        {
+            cursor.level ^= 1;
+            return true;
+        }
+
+        cursor.pulse = 0;
+        cursor.bit++;
+        if (cursor.bit < segment.count)
+        {
+            cursor.level ^= 1;
+            return true;
+        }
+    }
+    else if (cursor.pulse < segment.count)
+    {
+        cursor.level ^= 1;
+        return true;
+    }
+
+    cursor.segment++;
+    cursor.pulse = 0;
+    cursor.bit = 0;
+
+    if (cursor.segment >= timelineSegments.size())
+    {
+        cursor.level = timelineEndLevel;
+        return false;
+    }
+
+    cursor.level = timelineSegments[ cursor.segment ].startLevel;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t TapeTimeline::pulseLength(const Segment &segment, const Cursor &cursor) const
+{
+    switch (segment.type)
+    {
+        case E_TONE:
+            return segment.pulseLength;
+
+        case E_PULSES:
+            return timelinePulseLengths[ segment.first + cursor.pulse ];
+
+        case E_DATA:
+            return timelinePulseLengths[ (dataBit(segment, cursor.bit) ? segment.oneFirst : segment.first) + cursor.pulse ];
+    }
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool TapeTimeline::dataBit(const Segment &segment, uint32_t bit) const
+{
+    return (segment.data[ bit >> 3 ] << (bit & 7)) & 0x80;
+}
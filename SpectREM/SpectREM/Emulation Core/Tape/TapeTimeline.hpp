@@ -0,0 +1,118 @@
+//
+//  TapeTimeline.hpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#ifndef TapeTimeline_hpp
+#define TapeTimeline_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// The pulses a tape plays, compiled once from its blocks. Time is in T-states from the start of the tape. The timeline
+// is a list of segments, each a tone of identical pulses, a list of pulse lengths or a run of data bits read straight
+// from the block that holds them, so a data byte costs nothing more than the byte itself. The level of the tape flips
+// at the start of every pulse, apart from the first pulse of a segment with a fixed level, which starts at that level.
+// Every segment knows when it starts and the level it starts at, so the level at any time, or the next edge after it,
+// can be found without playing the tape up to that point
+class TapeTimeline
+{
+
+public:
+    static const uint64_t   cNO_EDGE = UINT64_MAX;
+
+    // Where a player has got to. Points at the pulse being played
+    struct Cursor
+    {
+        uint32_t            segment = 0;
+        uint32_t            pulse = 0;              // Pulse within the segment, or within the bit for data
+        uint32_t            bit = 0;                // Bit within a data segment
+        uint64_t            pulseStart = 0;
+        uint8_t             level = 0;
+    };
+
+public:
+    void                    clear();
+
+    // Blocks are built by starting a block then adding its segments in order. A block can be started again to repeat
+    // it. Pulse lengths are copied, data is not, so it must stay where it is for as long as the timeline is used. A
+    // level of -1 flips the level at the start of the segment, 0 or 1 fixes it. Pulses of zero length take no time
+    // but still flip the level
+    void                    beginBlock(uint32_t block);
+    void                    addTone(uint32_t pulseLength, uint32_t count, int level = -1);
+    void                    addPulses(const uint32_t *pulseLengths, uint32_t count, int level = -1);
+    void                    addData(const uint8_t *data, uint32_t bitCount, const uint32_t *zeroPulses, uint32_t zeroCount,
+                                    const uint32_t *onePulses, uint32_t oneCount, int level = -1);
+
+    // A pause starts with the edge that ends the last pulse before it, held for 1ms, then stays low
+    void                    addPause(uint32_t tStates);
+
+    // A point where the tape stops itself. Playing it again carries on from there
+    void                    addStop();
+    uint64_t                nextStopAfter(uint64_t ts) const;
+
+    uint64_t                length() const { return timelineLength; }
+    uint32_t                blockCount() const { return static_cast<uint32_t>(blockFirstSegment.size()); }
+    uint64_t                blockStart(uint32_t block) const;
+    uint32_t                blockAt(uint64_t ts) const;
+
+    // Level at a time, and the time of the first edge after it or cNO_EDGE if there are no more edges
+    uint8_t                 levelAt(uint64_t ts) const;
+    uint64_t                nextEdgeAfter(uint64_t ts) const;
+
+    // Sequential playback. Seek points the cursor at the pulse playing at a time, nextEdge moves it on to the next pulse
+    // that starts with an edge and returns when that is, or cNO_EDGE at the end of the tape
+    void                    seek(Cursor &cursor, uint64_t ts) const;
+    uint64_t                nextEdge(Cursor &cursor) const;
+    uint32_t                blockOf(const Cursor &cursor) const;
+
+private:
+    enum SegmentType : uint8_t
+    {
+        E_TONE,
+        E_PULSES,
+        E_DATA
+    };
+
+    struct Segment
+    {
+        SegmentType         type;
+        bool                edgeAtStart;
+        uint8_t             startLevel;
+        uint32_t            block;
+        uint64_t            start;
+        uint64_t            duration;
+        uint32_t            pulseLength;            // Tone
+        uint32_t            count;                  // Pulses in a tone or pulse list, bits of data
+        uint32_t            first;                  // First pulse length of a list, or of a zero bit
+        uint32_t            oneFirst;               // First pulse length of a one bit
+        uint32_t            zeroCount;              // Pulses in a zero bit
+        uint32_t            oneCount;               // Pulses in a one bit
+        uint32_t            zeroLength;             // T-states taken by a zero bit
+        uint32_t            oneLength;              // T-states taken by a one bit
+        const uint8_t     * data;
+    };
+
+    void                    addSegment(Segment &segment, int level, uint64_t pulseCount);
+    uint32_t                segmentAt(uint64_t ts) const;
+    uint32_t                pulseLength(const Segment &segment, const Cursor &cursor) const;
+    bool                    dataBit(const Segment &segment, uint32_t bit) const;
+    bool                    stepPulse(Cursor &cursor) const;
+
+private:
+    std::vector<Segment>    timelineSegments;
+    std::vector<uint32_t>   timelinePulseLengths;
+    std::vector<uint32_t>   blockFirstSegment;
+    std::vector<uint64_t>   timelineStops;
+    uint32_t                timelineBlock = 0;
+    uint64_t                timelineLength = 0;
+    uint8_t                 timelineEndLevel = 0;
+    uint8_t                 timelinePendingFlip = 0;    // Flips from pulses that took no time, applied to the next segment
+
+};
+
+#endif /* TapeTimeline_hpp */
@@ -3,17 +3,45 @@
 
 //-----------------------------------------------------------------------------------------
 
-#include "Z80CoreOpcodeTables.h"
+#include "Z80CoreImpl.h"
 
 //-----------------------------------------------------------------------------------------
 
-CZ80Core::CZ80Core()
+#define Z80CORE_FORMAT_OP(table, code, function, flags, format) format,
+#define Z80CORE_FORMAT_NO(table, code)                          nullptr,
+
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::Main_OpcodeFormats = { { Z80CORE_OPCODES_Main(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::CB_OpcodeFormats = { { Z80CORE_OPCODES_CB(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::DD_OpcodeFormats = { { Z80CORE_OPCODES_DD(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::ED_OpcodeFormats = { { Z80CORE_OPCODES_ED(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::FD_OpcodeFormats = { { Z80CORE_OPCODES_FD(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::DDCB_OpcodeFormats = { { Z80CORE_OPCODES_DDCB(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+const CZ80CoreBase::Z80OpcodeFormatTable CZ80CoreBase::FDCB_OpcodeFormats = { { Z80CORE_OPCODES_FDCB(Z80CORE_FORMAT_OP, Z80CORE_FORMAT_NO) } };
+
+#undef Z80CORE_FORMAT_OP
+#undef Z80CORE_FORMAT_NO
+
+//-----------------------------------------------------------------------------------------
+
+template class CZ80Core<CZ80CoreCallbackBus>;
+
+void CZ80CoreCallback::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write, Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *param)
 {
-    m_MemRead = nullptr;
-    m_MemWrite = nullptr;
-    m_IORead = nullptr;
-    m_IOWrite = nullptr;
-    m_MemContentionHandling = nullptr;
+    m_Bus.m_Param = param;
+    m_Bus.m_MemRead = mem_read;
+    m_Bus.m_MemWrite = mem_write;
+    m_Bus.m_IORead = io_read;
+    m_Bus.m_IOWrite = io_write;
+    m_Bus.m_MemContentionHandling = mem_contention_handling;
+
+    CZ80CoreBase::Initialise(debug_read_handler, debug_write_handler, param);
+}
+
+//-----------------------------------------------------------------------------------------
+
+CZ80CoreBase::CZ80CoreBase()
+{
+    m_Param = nullptr;
     m_DebugRead = nullptr;
     m_OpcodeCallback = nullptr;
     m_DebugCallback = nullptr;
@@ -25,21 +53,16 @@ CZ80Core::CZ80Core()
 
 //-----------------------------------------------------------------------------------------
 
-CZ80Core::~CZ80Core()
+CZ80CoreBase::~CZ80CoreBase()
 {
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write, Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *param)
+void CZ80CoreBase::Initialise(Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler, void *param)
 {
     // Store our settings
     m_Param = param;
-    m_MemRead = mem_read;
-    m_MemWrite = mem_write;
-    m_IORead = io_read;
-    m_IOWrite = io_write;
-    m_MemContentionHandling = mem_contention_handling;
     m_DebugRead = debug_read_handler;
     m_Debugwrite = debug_write_handler;
 
@@ -64,7 +87,7 @@ void CZ80Core::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreR
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RegisterOpcodeCallback(Z80OpcodeCallback callback)
+void CZ80CoreBase::RegisterOpcodeCallback(Z80OpcodeCallback callback)
 {
     // Set the callback
     m_OpcodeCallback = callback;
@@ -72,7 +95,7 @@ void CZ80Core::RegisterOpcodeCallback(Z80OpcodeCallback callback)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RegisterDebugCallback(Z80DebugCallback callback)
+void CZ80CoreBase::RegisterDebugCallback(Z80DebugCallback callback)
 {
     // Set the callback
     m_DebugCallback = callback;
@@ -80,70 +103,7 @@ void CZ80Core::RegisterDebugCallback(Z80DebugCallback callback)
 
 //-----------------------------------------------------------------------------------------
 
-uint8_t CZ80Core::Z80CoreMemRead(uint16_t address, uint32_t tstates)
-{
-    // First handle the contention
-    Z80CoreMemoryContention(address, tstates);
-
-    if (m_MemRead != nullptr)
-    {
-        return m_MemRead(address, m_Param);
-    }
-
-    return 0;
-}
-
-
-//-----------------------------------------------------------------------------------------
-
-void CZ80Core::Z80CoreMemWrite(uint16_t address, uint8_t data, uint32_t tstates)
-{
-    // First handle the contention
-    Z80CoreMemoryContention(address, tstates);
-
-    if (m_MemWrite != nullptr)
-    {
-        m_MemWrite(address, data, m_Param);
-    }
-}
-
-//-----------------------------------------------------------------------------------------
-
-uint8_t CZ80Core::Z80CoreIORead(uint16_t address)
-{
-    if (m_IORead != nullptr)
-    {
-        return m_IORead(address, m_Param);
-    }
-
-    return 0;
-}
-
-//-----------------------------------------------------------------------------------------
-
-void CZ80Core::Z80CoreIOWrite(uint16_t address, uint8_t data)
-{
-    if (m_IOWrite != nullptr)
-    {
-        m_IOWrite(address, data, m_Param);
-    }
-}
-
-//-----------------------------------------------------------------------------------------
-
-void CZ80Core::Z80CoreMemoryContention(uint16_t address, uint32_t t_states)
-{
-    if (m_MemContentionHandling != nullptr)
-    {
-        m_MemContentionHandling(address, t_states, m_Param);
-    }
-
-    m_CPURegisters.TStates += t_states;
-}
-
-//-----------------------------------------------------------------------------------------
-
-uint8_t CZ80Core::Z80CoreDebugMemRead(uint16_t address, void *data)
+uint8_t CZ80CoreBase::Z80CoreDebugMemRead(uint16_t address, void *data)
 {
     if (m_DebugRead != nullptr)
     {
@@ -154,7 +114,7 @@ uint8_t CZ80Core::Z80CoreDebugMemRead(uint16_t address, void *data)
 }
 
 //-----------------------------------------------------------------------------------------
-void CZ80Core::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
+void CZ80CoreBase::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
 {
     if (m_Debugwrite != nullptr)
     {
@@ -165,239 +125,36 @@ void CZ80Core::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
+void CZ80CoreBase::SignalInterrupt()
 {
-    uint32_t tstates = m_CPURegisters.TStates;
-
-    do
-    {
-        // Check if an NMI has been requested
-        if (m_CPURegisters.NMIReq)
-        {
-            m_CPURegisters.NMIReq = false;
-            m_CPURegisters.IFF1 = 0;
-            if (!m_CPURegisters.IntReq)
-            {
-                m_CPURegisters.IFF2 = 0;
-            }
-            Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
-            Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
-
-            if ( m_CPURegisters.Halted )
-            {
-                m_CPURegisters.Halted = false;
-            }
-
-            m_CPURegisters.regPC = 0x0066;
-
-        }
-        else if (m_CPURegisters.IntReq)
-        {
-            if (m_CPURegisters.EIHandled == false &&
-                m_CPURegisters.DDFDmultiByte == false &&
-                m_CPURegisters.IFF1 != 0 &&
-                m_CPURegisters.TStates < int_t_states )
-            {
-                /* We just executed LD A,I or LD A,R, causing IFF2 to be copied to the
-                 parity flag.  This occured whilst accepting an interrupt.  For NMOS
-                 Z80s only, clear the parity flag to reflect the fact that IFF2 would
-                 have actually been cleared before its value was transferred by LD A,I
-                 or LD A,R.  We cannot do this when emulating LD itself as we cannot
-                 tell whether the next instruction will be interrupted. */
-                if ( m_Iff2_read && m_CPUType == eCPUTYPE_NMOS)
-                {
-                    m_CPURegisters.regs.regF &= ~FLAG_V;
-                }
-
-                // First see if we are halted?
-                if ( m_CPURegisters.Halted )
-                {
-                    m_CPURegisters.Halted = false;
-                    m_CPURegisters.regPC++;
-                }
-
-                // Process the interrupt based on its type
-                m_CPURegisters.IFF1 = 0;
-                m_CPURegisters.IFF2 = 0;
-                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-
-                switch (m_CPURegisters.IM)
-                {
-                    case 0:
-                    case 1:
-                    default:
-                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
-                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
-
-                        m_CPURegisters.regPC = 0x0038;
-                        m_MEMPTR = m_CPURegisters.regPC;
-                        m_CPURegisters.TStates += 7;
-                        break;
-
-                    case 2:
-                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
-                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
-
-                        // Hardware would normally put a value on the bus to be used with regI when working out
-                        // the address for the IM 2 jump table. With no hardware connected this is defaulted to
-                        // 0xff
-                        uint16_t address = (m_CPURegisters.regI << 8) | 0xff;
-                        m_CPURegisters.regPC = Z80CoreMemRead(address + 0);
-                        m_CPURegisters.regPC |= Z80CoreMemRead(address + 1) << 8;
-
-                        m_MEMPTR = m_CPURegisters.regPC;
-                        m_CPURegisters.TStates += 7;
-                        break;
-                }
-            }
-        }
-        else if (m_CPURegisters.TStates > int_t_states)
-        {
-            m_CPURegisters.IntReq = false;
-        }
-
-        // Clear the EIHandle flag
-        m_CPURegisters.EIHandled = false;
-
-        // Clear the multibyte flags in case the next instruction is not part of a multibyte instruction
-        m_CPURegisters.DDFDmultiByte = false;
-
-        // Clear the iff2 read flag before the opcode is run. If LD A, I or LD A, R is the next opcode and is followed by
-        // an interrupt, then the parity flag needs to be reset. This only effects NMOS chips and not CMOS
-        m_Iff2_read = false;
-
-        Z80OpcodeTable *table = &Main_Opcodes;
-
-        // Read the opcode
-        uint8_t opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
-
-        m_CPURegisters.regPC++;
-        m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-
-        // Handle the main bits
-        switch (opcode)
-        {
-            case 0xcb:
-                table = &CB_Opcodes;
-
-                // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
-                m_CPURegisters.regPC++;
-                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-                break;
-
-            case 0xdd:
-
-                // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
-                m_CPURegisters.regPC++;
-                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-
-                if ( opcode == 0xcb )
-                {
-                    table = &DDCB_Opcodes;
-
-                    // Read the offset
-                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
-                    m_CPURegisters.regPC++;
-                    m_MEMPTR = m_CPURegisters.reg_pairs.regIX + offset;
-
-                    // Get the next byte
-                    opcode = Z80CoreMemRead(m_CPURegisters.regPC);
-                    m_CPURegisters.regPC++;
-                }
-                else
-                {
-                    table = &DD_Opcodes;
-                }
-                break;
-
-            case 0xed:
-                table = &ED_Opcodes;
-
-                // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
-                m_CPURegisters.regPC++;
-                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-                break;
-
-            case 0xfd:
-
-                // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
-                m_CPURegisters.regPC++;
-                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
-
-                if (opcode == 0xcb)
-                {
-                    table = &FDCB_Opcodes;
-
-                    // Read the offset
-                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
-                    m_CPURegisters.regPC++;
-                    m_MEMPTR = m_CPURegisters.reg_pairs.regIY + offset;
-
-                    // Get the next byte
-                    opcode = Z80CoreMemRead(m_CPURegisters.regPC);
-                    m_CPURegisters.regPC++;
-                }
-                else
-                {
-                    table = &FD_Opcodes;
-                }
-                break;
-        }
-
-        // Handle if the callback wants to skip over this instruction
-        bool skip_instruction = false;
-
-        // Handle a callback if needed
-        if (m_OpcodeCallback != nullptr)
-        {
-            // Callback before doing the opcode
-            skip_instruction = m_OpcodeCallback(opcode, m_CPURegisters.regPC - 1, m_Param);
-        }
-
-        if ( !skip_instruction )
-        {
-            // We can now execute the instruction
-            if (table->entries[opcode].function != nullptr)
-            {
-                // Execute the opcode
-                (this->*table->entries[opcode].function)(opcode);
-
-                // Remember the details of if we updated flags
-                m_PrevOpcodeFlags = table->entries[opcode].flags;
-            }
-            else
-            {
-                // If no function has been found for the second opcode of a DD/FD multibyte instruction
-                // then use it as a prefix. Drop the PC back 1 and carry on processing the next opcode and set
-                // the chaining flag so we can stop interrupts until the chain has finished
-
-                // TODO: This could be run if an undocumented opcode is found which would break!!!
-                m_CPURegisters.DDFDmultiByte = true;
-                m_CPURegisters.regPC--;
-                m_CPURegisters.regR--;
-                m_CPURegisters.TStates -= 4;
-            }
-        }
+    m_CPURegisters.IntReq = true;
+}
 
-    } while (m_CPURegisters.TStates - tstates < num_tstates);
+//-----------------------------------------------------------------------------------------
 
-    return m_CPURegisters.TStates - tstates;
+void CZ80CoreBase::GetState(Z80SavedState &state) const
+{
+    state.registers = m_CPURegisters;
+    state.memptr = m_MEMPTR;
+    state.prevOpcodeFlags = m_PrevOpcodeFlags;
+    state.iff2Read = m_Iff2_read;
+    state.ldIA = m_LD_I_A;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SignalInterrupt()
+void CZ80CoreBase::SetState(const Z80SavedState &state)
 {
-    m_CPURegisters.IntReq = true;
+    m_CPURegisters = state.registers;
+    m_MEMPTR = state.memptr;
+    m_PrevOpcodeFlags = state.prevOpcodeFlags;
+    m_Iff2_read = state.iff2Read;
+    m_LD_I_A = state.ldIA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Reset(bool hardReset)
+void CZ80CoreBase::Reset(bool hardReset)
 {
     // Reset the cpu
     m_CPURegisters.regPC = 0x0000;
@@ -431,7 +188,7 @@ void CZ80Core::Reset(bool hardReset)
 
 //-----------------------------------------------------------------------------------------
 
-uint8_t CZ80Core::GetRegister(eZ80BYTEREGISTERS reg) const
+uint8_t CZ80CoreBase::GetRegister(eZ80BYTEREGISTERS reg) const
 {
     uint8_t data = 0;
 
@@ -462,7 +219,7 @@ uint8_t CZ80Core::GetRegister(eZ80BYTEREGISTERS reg) const
 
 //-----------------------------------------------------------------------------------------
 
-uint16_t CZ80Core::GetRegister(eZ80WORDREGISTERS reg) const
+uint16_t CZ80CoreBase::GetRegister(eZ80WORDREGISTERS reg) const
 {
     uint16_t data = 0;
 
@@ -487,7 +244,7 @@ uint16_t CZ80Core::GetRegister(eZ80WORDREGISTERS reg) const
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
+void CZ80CoreBase::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
 {
     switch (reg)
     {
@@ -514,7 +271,7 @@ void CZ80Core::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
+void CZ80CoreBase::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
 {
     switch (reg)
     {
@@ -535,7 +292,7 @@ void CZ80Core::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t address, bool hexFormat, void *data)
+uint32_t CZ80CoreBase::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t address, bool hexFormat, void *data)
 {
     // Why would you do this! ;)
     if (pStr == nullptr)
@@ -606,7 +363,7 @@ uint32_t CZ80Core::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t addre
 
 //-----------------------------------------------------------------------------------------
 
-char *CZ80Core::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data)
+char *CZ80CoreBase::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data)
 {
     // Get the number
     uint16_t num = 0;
@@ -678,7 +435,7 @@ char *CZ80Core::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &Str
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Debug_GetOpcodeLength(uint16_t address, void *data)
+uint32_t CZ80CoreBase::Debug_GetOpcodeLength(uint16_t address, void *data)
 {
     // Remember the start
     uint32_t start_address = address;
@@ -691,7 +448,7 @@ uint32_t CZ80Core::Debug_GetOpcodeLength(uint16_t address, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-bool CZ80Core::Debug_HasValidOpcode(uint16_t address, void *data)
+bool CZ80CoreBase::Debug_HasValidOpcode(uint16_t address, void *data)
 {
     if (Debug_GetOpcodeDetails(address, data) == nullptr)
     {
@@ -703,9 +460,9 @@ bool CZ80Core::Debug_HasValidOpcode(uint16_t address, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
+const char *CZ80CoreBase::Debug_GetOpcodeDetails(uint16_t &address, void *data)
 {
-    Z80OpcodeTable *table = &Main_Opcodes;
+    const Z80OpcodeFormatTable *table = &Main_OpcodeFormats;
 
     // Read the opcode
     uint16_t opcode_length = 0;
@@ -716,7 +473,7 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
     switch (opcode)
     {
     case 0xcb:
-        table = &CB_Opcodes;
+        table = &CB_OpcodeFormats;
         opcode = Z80CoreDebugMemRead(address + opcode_length, data);
         opcode_length++;
         break;
@@ -727,7 +484,7 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
 
         if (opcode == 0xcb)
         {
-            table = &DDCB_Opcodes;
+            table = &DDCB_OpcodeFormats;
 
             // Get the next byte
             opcode = Z80CoreDebugMemRead(address + opcode_length + 1, data);
@@ -735,12 +492,12 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
         }
         else
         {
-            table = &DD_Opcodes;
+            table = &DD_OpcodeFormats;
         }
         break;
 
     case 0xed:
-        table = &ED_Opcodes;
+        table = &ED_OpcodeFormats;
         opcode = Z80CoreDebugMemRead(address + opcode_length, data);
         opcode_length++;
         break;
@@ -751,7 +508,7 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
 
         if (opcode == 0xcb)
         {
-            table = &FDCB_Opcodes;
+            table = &FDCB_OpcodeFormats;
 
             // Get the next byte
             opcode = Z80CoreDebugMemRead(address + opcode_length + 1, data);
@@ -759,19 +516,19 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
         }
         else
         {
-            table = &FD_Opcodes;
+            table = &FD_OpcodeFormats;
         }
         break;
     }
 
     // If this is invalid - return 0
-    if (table->entries[opcode].function == nullptr)
+    if (table->format[opcode] == nullptr)
     {
         return nullptr;
     }
 
     // Now we need to scan the string for any extra bytes needed
-    const char *pDisassembleString = table->entries[opcode].format;
+    const char *pDisassembleString = table->format[opcode];
 
     while (*pDisassembleString != '\0')
     {
@@ -805,12 +562,12 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
     address += opcode_length;
 
     // Return the string
-    return table->entries[opcode].format;
+    return table->format[opcode];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Inc(uint8_t &r)
+void CZ80CoreBase::Inc(uint8_t &r)
 {
     // Increase the register
     r++;
@@ -824,7 +581,7 @@ void CZ80Core::Inc(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Dec(uint8_t &r)
+void CZ80CoreBase::Dec(uint8_t &r)
 {
     // Sort the initial flags
     m_CPURegisters.regs.regF = m_CPURegisters.regs.regF & FLAG_C;
@@ -841,7 +598,7 @@ void CZ80Core::Dec(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Add8(uint8_t &r)
+void CZ80CoreBase::Add8(uint8_t &r)
 {
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
@@ -863,7 +620,7 @@ void CZ80Core::Add8(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Adc8(uint8_t &r)
+void CZ80CoreBase::Adc8(uint8_t &r)
 {
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
@@ -886,7 +643,7 @@ void CZ80Core::Adc8(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sub8(uint8_t &r)
+void CZ80CoreBase::Sub8(uint8_t &r)
 {
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
@@ -908,7 +665,7 @@ void CZ80Core::Sub8(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sbc8(uint8_t &r)
+void CZ80CoreBase::Sbc8(uint8_t &r)
 {
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
@@ -931,7 +688,7 @@ void CZ80Core::Sbc8(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Add16(uint16_t &r1, uint16_t &r2)
+void CZ80CoreBase::Add16(uint16_t &r1, uint16_t &r2)
 {
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
 
@@ -955,7 +712,7 @@ void CZ80Core::Add16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Adc16(uint16_t &r1, uint16_t &r2)
+void CZ80CoreBase::Adc16(uint16_t &r1, uint16_t &r2)
 {
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
@@ -983,7 +740,7 @@ void CZ80Core::Adc16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sbc16(uint16_t &r1, uint16_t &r2)
+void CZ80CoreBase::Sbc16(uint16_t &r1, uint16_t &r2)
 {
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
@@ -1011,7 +768,7 @@ void CZ80Core::Sbc16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::And(uint8_t &r)
+void CZ80CoreBase::And(uint8_t &r)
 {
     m_CPURegisters.regs.regA &= r;
     m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
@@ -1020,7 +777,7 @@ void CZ80Core::And(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Or(uint8_t &r)
+void CZ80CoreBase::Or(uint8_t &r)
 {
     m_CPURegisters.regs.regA |= r;
     m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
@@ -1029,7 +786,7 @@ void CZ80Core::Or(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Xor(uint8_t &r)
+void CZ80CoreBase::Xor(uint8_t &r)
 {
     m_CPURegisters.regs.regA ^= r;
     m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
@@ -1038,7 +795,7 @@ void CZ80Core::Xor(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Cp(uint8_t &r)
+void CZ80CoreBase::Cp(uint8_t &r)
 {
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
@@ -1059,7 +816,7 @@ void CZ80Core::Cp(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC(uint8_t &r)
+void CZ80CoreBase::RLC(uint8_t &r)
 {
     r = (r << 1) | (r >> 7);
     m_CPURegisters.regs.regF = m_ParityTable[r];
@@ -1069,7 +826,7 @@ void CZ80Core::RLC(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC(uint8_t &r)
+void CZ80CoreBase::RRC(uint8_t &r)
 {
     r = (r >> 1) | (r << 7);
     m_CPURegisters.regs.regF = m_ParityTable[r];
@@ -1079,7 +836,7 @@ void CZ80Core::RRC(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL(uint8_t &r)
+void CZ80CoreBase::RL(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r << 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x01 : 0x00);
@@ -1090,7 +847,7 @@ void CZ80Core::RL(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR(uint8_t &r)
+void CZ80CoreBase::RR(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r >> 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x80 : 0x00);
@@ -1101,7 +858,7 @@ void CZ80Core::RR(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA(uint8_t &r)
+void CZ80CoreBase::SLA(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r << 1);
@@ -1112,7 +869,7 @@ void CZ80Core::SLA(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA(uint8_t &r)
+void CZ80CoreBase::SRA(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r & 0x80) | (r >> 1);
@@ -1123,7 +880,7 @@ void CZ80Core::SRA(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL(uint8_t &r)
+void CZ80CoreBase::SRL(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r >> 1);
@@ -1134,7 +891,7 @@ void CZ80Core::SRL(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL(uint8_t &r)
+void CZ80CoreBase::SLL(uint8_t &r)
 {
     uint8_t old_r = r;
     r = (r << 1) | 0x01;
@@ -1145,7 +902,7 @@ void CZ80Core::SLL(uint8_t &r)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Bit(uint8_t &r, uint8_t b)
+void CZ80CoreBase::Bit(uint8_t &r, uint8_t b)
 {
     m_CPURegisters.regs.regF &= FLAG_C;
     m_CPURegisters.regs.regF |= FLAG_H;
@@ -1156,7 +913,7 @@ void CZ80Core::Bit(uint8_t &r, uint8_t b)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BitWithMemptr(uint8_t &r, uint8_t b)
+void CZ80CoreBase::BitWithMemptr(uint8_t &r, uint8_t b)
 {
     m_CPURegisters.regs.regF &= FLAG_C;
     m_CPURegisters.regs.regF |= FLAG_H;
@@ -1167,14 +924,14 @@ void CZ80Core::BitWithMemptr(uint8_t &r, uint8_t b)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Set(uint8_t &r, uint8_t b)
+void CZ80CoreBase::Set(uint8_t &r, uint8_t b)
 {
     r |= (1 << b);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Res(uint8_t &r, uint8_t b)
+void CZ80CoreBase::Res(uint8_t &r, uint8_t b)
 {
     r &= ~(1 << b);
 }
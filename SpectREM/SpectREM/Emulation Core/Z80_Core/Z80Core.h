@@ -17,6 +17,24 @@
 #endif
 #endif
 
+//-----------------------------------------------------------------------------------------
+// Opcode dispatch used by CZ80Core::Execute. Computed goto is used when the compiler supports
+// labels as values (GCC/Clang), otherwise a switch over the opcode tables. The original member
+// function pointer tables can be selected by defining Z80CORE_DISPATCH as Z80CORE_DISPATCH_TABLE.
+//-----------------------------------------------------------------------------------------
+
+#define Z80CORE_DISPATCH_TABLE      0
+#define Z80CORE_DISPATCH_SWITCH     1
+#define Z80CORE_DISPATCH_GOTO       2
+
+#ifndef Z80CORE_DISPATCH
+#if defined(__GNUC__) || defined(__clang__)
+#define Z80CORE_DISPATCH            Z80CORE_DISPATCH_GOTO
+#else
+#define Z80CORE_DISPATCH            Z80CORE_DISPATCH_SWITCH
+#endif
+#endif
+
 //-----------------------------------------------------------------------------------------
 
 typedef uint8_t (*Z80CoreRead)(uint16_t address, void *param);
@@ -29,7 +47,7 @@ typedef char *(*Z80DebugCallback)(char *buffer, uint32_t variableType, uint16_t
 
 //-----------------------------------------------------------------------------------------
 
-class CZ80Core
+class CZ80CoreBase
 {
 public:
     typedef enum
@@ -104,7 +122,7 @@ public:
     static const uint8_t FLAG_Z = 0x40;
     static const uint8_t FLAG_S = 0x80;
 
-private:
+protected:
 
     static const uint32_t OPCODEFLAG_AltersFlags = (1 << 0);
 
@@ -176,33 +194,49 @@ private:
         uint32_t	TStates;
     } Z80State;
 
+    typedef enum
+    {
+        eOPCODETABLE_Main,
+        eOPCODETABLE_CB,
+        eOPCODETABLE_DD,
+        eOPCODETABLE_ED,
+        eOPCODETABLE_FD,
+        eOPCODETABLE_DDCB,
+        eOPCODETABLE_FDCB,
+        eOPCODETABLE_Count
+    } eOPCODETABLE;
+
     typedef struct
     {
-        void (CZ80Core::*function)(uint8_t opcode);
-        uint32_t flags;
-        const char* format;
-    } Z80Opcode;
+        const char *format[256];
+    } Z80OpcodeFormatTable;
 
+public:
+    // Everything that affects how the CPU carries on from here, as plain data so savestates can copy it as a block
     typedef struct
     {
-        Z80Opcode entries[256];
-    } Z80OpcodeTable;
+        Z80State    registers;
+        uint16_t    memptr;
+        uint32_t    prevOpcodeFlags;
+        bool        iff2Read;
+        bool        ldIA;
+    } Z80SavedState;
 
 
 public:
-    CZ80Core();
-    ~CZ80Core();
+    CZ80CoreBase();
+    ~CZ80CoreBase();
 
 public:
-    void					Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write,Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *member_class);
+    void					Initialise(Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler, void *member_class);
 
     void					Reset(bool hardReset = true);
     uint32_t			    Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t address, bool hexFormat, void *data);
     uint32_t			    Debug_GetOpcodeLength(uint16_t address, void *data);
     bool					Debug_HasValidOpcode(uint16_t address, void *data);
-    uint32_t 			    Execute(uint32_t num_tstates = 0, uint32_t int_t_states = 32);
 
     void					RegisterOpcodeCallback(Z80OpcodeCallback callback);
+    Z80OpcodeCallback       getOpcodeCallback() const { return m_OpcodeCallback; };
     void					RegisterDebugCallback(Z80DebugCallback callback);
 
     void					SignalInterrupt();
@@ -237,22 +271,12 @@ public:
     void					ResetTStates() { m_CPURegisters.TStates = 0; }
     void					ResetTStates(uint32_t tstates_per_frame) { m_CPURegisters.TStates -= tstates_per_frame; }
 
-    uint8_t	                Z80CoreMemRead(uint16_t address, uint32_t tstates = 3);
-    void					Z80CoreMemWrite(uint16_t address, uint8_t data, uint32_t tstates = 3);
-    uint8_t			        Z80CoreIORead(uint16_t address);
-    void					Z80CoreIOWrite(uint16_t address, uint8_t data);
-    void					Z80CoreMemoryContention(uint16_t address, uint32_t t_states);
-    void					Z80CoreIOContention(uint16_t address, uint32_t t_states);
+    void                    GetState(Z80SavedState &state) const;
+    void                    SetState(const Z80SavedState &state);
+
     uint8_t			        Z80CoreDebugMemRead(uint16_t address, void *data);
     void                    Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data);
 protected:
-    #include "Z80Core_MainOpcodes.h"
-    #include "Z80Core_CBOpcodes.h"
-    #include "Z80Core_DDOpcodes.h"
-    #include "Z80Core_EDOpcodes.h"
-    #include "Z80Core_FDOpcodes.h"
-    #include "Z80Core_DDCB_FDCBOpcodes.h"
-
     void					Inc(uint8_t &r);
     void					Dec(uint8_t &r);
     void					Add8(uint8_t &r);
@@ -283,13 +307,14 @@ protected:
     char				*	Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data);
 
 protected:
-    static Z80OpcodeTable	Main_Opcodes;
-    static Z80OpcodeTable	CB_Opcodes;
-    static Z80OpcodeTable	DD_Opcodes;
-    static Z80OpcodeTable	ED_Opcodes;
-    static Z80OpcodeTable	FD_Opcodes;
-    static Z80OpcodeTable	DDCB_Opcodes;
-    static Z80OpcodeTable	FDCB_Opcodes;
+    // Disassembler only, kept apart from the dispatch data
+    static const Z80OpcodeFormatTable	Main_OpcodeFormats;
+    static const Z80OpcodeFormatTable	CB_OpcodeFormats;
+    static const Z80OpcodeFormatTable	DD_OpcodeFormats;
+    static const Z80OpcodeFormatTable	ED_OpcodeFormats;
+    static const Z80OpcodeFormatTable	FD_OpcodeFormats;
+    static const Z80OpcodeFormatTable	DDCB_OpcodeFormats;
+    static const Z80OpcodeFormatTable	FDCB_OpcodeFormats;
 
     Z80State				m_CPURegisters;
     uint8_t			        m_ParityTable[256];
@@ -304,11 +329,6 @@ protected:
     bool                    paused = false;
 
     void *                  m_Param;
-    Z80CoreRead				m_MemRead;
-    Z80CoreWrite			m_MemWrite;
-    Z80CoreRead				m_IORead;
-    Z80CoreWrite			m_IOWrite;
-    Z80CoreContention		m_MemContentionHandling;
     Z80CoreDebugRead		m_DebugRead;
     Z80CoreDebugWrite       m_Debugwrite;
 
@@ -316,6 +336,116 @@ protected:
     Z80DebugCallback		m_DebugCallback;
 };
 
+//-----------------------------------------------------------------------------------------
+// The executing core is templated on a bus type so memory and IO accesses can be inlined into
+// the opcodes. A bus provides:
+//
+//   uint8_t Read(uint16_t address)
+//   void    Write(uint16_t address, uint8_t data)
+//   uint8_t IORead(uint16_t address)
+//   void    IOWrite(uint16_t address, uint8_t data)
+//   void    Contention(uint16_t address, uint32_t tstates)
+//
+// The member definitions live in Z80CoreImpl.h which must be included by the translation unit
+// that instantiates the core for a given bus.
+//-----------------------------------------------------------------------------------------
+
+template <typename Bus>
+class CZ80Core : public CZ80CoreBase
+{
+public:
+    CZ80Core(const Bus &bus = Bus()) : m_Bus(bus) {}
+
+public:
+    uint32_t 			    Execute(uint32_t num_tstates = 0, uint32_t int_t_states = 32);
+
+    Bus                   & GetBus() { return m_Bus; }
+
+    uint8_t	                Z80CoreMemRead(uint16_t address, uint32_t tstates = 3)
+    {
+        // First handle the contention
+        Z80CoreMemoryContention(address, tstates);
+        return m_Bus.Read(address);
+    }
+
+    void					Z80CoreMemWrite(uint16_t address, uint8_t data, uint32_t tstates = 3)
+    {
+        // First handle the contention
+        Z80CoreMemoryContention(address, tstates);
+        m_Bus.Write(address, data);
+    }
+
+    uint8_t			        Z80CoreIORead(uint16_t address) { return m_Bus.IORead(address); }
+    void					Z80CoreIOWrite(uint16_t address, uint8_t data) { m_Bus.IOWrite(address, data); }
+
+    void					Z80CoreMemoryContention(uint16_t address, uint32_t t_states)
+    {
+        m_Bus.Contention(address, t_states);
+        m_CPURegisters.TStates += t_states;
+    }
+
+protected:
+    #include "Z80Core_MainOpcodes.h"
+    #include "Z80Core_CBOpcodes.h"
+    #include "Z80Core_DDOpcodes.h"
+    #include "Z80Core_EDOpcodes.h"
+    #include "Z80Core_FDOpcodes.h"
+    #include "Z80Core_DDCB_FDCBOpcodes.h"
+
+#if Z80CORE_DISPATCH == Z80CORE_DISPATCH_TABLE
+    typedef struct
+    {
+        void (CZ80Core::*function)(uint8_t opcode);
+        uint32_t flags;
+    } Z80Opcode;
+
+    typedef struct
+    {
+        Z80Opcode entries[256];
+    } Z80OpcodeTable;
+
+    static Z80OpcodeTable	Main_Opcodes;
+    static Z80OpcodeTable	CB_Opcodes;
+    static Z80OpcodeTable	DD_Opcodes;
+    static Z80OpcodeTable	ED_Opcodes;
+    static Z80OpcodeTable	FD_Opcodes;
+    static Z80OpcodeTable	DDCB_Opcodes;
+    static Z80OpcodeTable	FDCB_Opcodes;
+#endif
+
+    Bus                     m_Bus;
+};
+
+//-----------------------------------------------------------------------------------------
+// Bus adapter for the original callback interface. Accesses go through the registered C
+// function pointers, as they did before the core was templated.
+//-----------------------------------------------------------------------------------------
+
+class CZ80CoreCallbackBus
+{
+public:
+    uint8_t                 Read(uint16_t address) { return (m_MemRead != nullptr) ? m_MemRead(address, m_Param) : 0; }
+    void                    Write(uint16_t address, uint8_t data) { if (m_MemWrite != nullptr) m_MemWrite(address, data, m_Param); }
+    uint8_t                 IORead(uint16_t address) { return (m_IORead != nullptr) ? m_IORead(address, m_Param) : 0; }
+    void                    IOWrite(uint16_t address, uint8_t data) { if (m_IOWrite != nullptr) m_IOWrite(address, data, m_Param); }
+    void                    Contention(uint16_t address, uint32_t tstates) { if (m_MemContentionHandling != nullptr) m_MemContentionHandling(address, tstates, m_Param); }
+
+    void *                  m_Param = nullptr;
+    Z80CoreRead				m_MemRead = nullptr;
+    Z80CoreWrite			m_MemWrite = nullptr;
+    Z80CoreRead				m_IORead = nullptr;
+    Z80CoreWrite			m_IOWrite = nullptr;
+    Z80CoreContention		m_MemContentionHandling = nullptr;
+};
+
+class CZ80CoreCallback : public CZ80Core<CZ80CoreCallbackBus>
+{
+public:
+    void					Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write,Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *member_class);
+};
+
+extern template class CZ80Core<CZ80CoreCallbackBus>;
+
 
 //-----------------------------------------------------------------------------------------
 
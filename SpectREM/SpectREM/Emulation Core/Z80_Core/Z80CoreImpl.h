@@ -0,0 +1,376 @@
+//
+// TZT ZX Spectrum Emulator
+//
+// Definitions for the templated core. Include this from the one translation unit that
+// instantiates CZ80Core for a bus, after the bus type has been fully defined.
+//
+
+#ifndef Z80COREIMPL_H
+#define Z80COREIMPL_H
+
+#include "Z80Core.h"
+#include "Z80CoreOpcodeTables.h"
+
+//-----------------------------------------------------------------------------------------
+
+#if Z80CORE_DISPATCH == Z80CORE_DISPATCH_TABLE
+
+#define Z80CORE_TABLE_OP(table, code, function, flags, format)  { &CZ80Core::function, flags },
+#define Z80CORE_TABLE_NO(table, code)                           { nullptr, 0 },
+
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::Main_Opcodes = { { Z80CORE_OPCODES_Main(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::CB_Opcodes = { { Z80CORE_OPCODES_CB(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::DD_Opcodes = { { Z80CORE_OPCODES_DD(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::ED_Opcodes = { { Z80CORE_OPCODES_ED(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::FD_Opcodes = { { Z80CORE_OPCODES_FD(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::DDCB_Opcodes = { { Z80CORE_OPCODES_DDCB(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+template <typename Bus>
+typename CZ80Core<Bus>::Z80OpcodeTable CZ80Core<Bus>::FDCB_Opcodes = { { Z80CORE_OPCODES_FDCB(Z80CORE_TABLE_OP, Z80CORE_TABLE_NO) } };
+
+#undef Z80CORE_TABLE_OP
+#undef Z80CORE_TABLE_NO
+
+#endif
+
+//-----------------------------------------------------------------------------------------
+
+template <typename Bus>
+uint32_t CZ80Core<Bus>::Execute(uint32_t num_tstates, uint32_t int_t_states)
+{
+    uint32_t tstates = m_CPURegisters.TStates;
+
+    do
+    {
+        // Check if an NMI has been requested
+        if (m_CPURegisters.NMIReq)
+        {
+            m_CPURegisters.NMIReq = false;
+            m_CPURegisters.IFF1 = 0;
+            if (!m_CPURegisters.IntReq)
+            {
+                m_CPURegisters.IFF2 = 0;
+            }
+            Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
+            Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
+
+            if ( m_CPURegisters.Halted )
+            {
+                m_CPURegisters.Halted = false;
+            }
+
+            m_CPURegisters.regPC = 0x0066;
+
+        }
+        else if (m_CPURegisters.IntReq)
+        {
+            if (m_CPURegisters.EIHandled == false &&
+                m_CPURegisters.DDFDmultiByte == false &&
+                m_CPURegisters.IFF1 != 0 &&
+                m_CPURegisters.TStates < int_t_states )
+            {
+                /* We just executed LD A,I or LD A,R, causing IFF2 to be copied to the
+                 parity flag.  This occured whilst accepting an interrupt.  For NMOS
+                 Z80s only, clear the parity flag to reflect the fact that IFF2 would
+                 have actually been cleared before its value was transferred by LD A,I
+                 or LD A,R.  We cannot do this when emulating LD itself as we cannot
+                 tell whether the next instruction will be interrupted. */
+                if ( m_Iff2_read && m_CPUType == eCPUTYPE_NMOS)
+                {
+                    m_CPURegisters.regs.regF &= ~FLAG_V;
+                }
+
+                // First see if we are halted?
+                if ( m_CPURegisters.Halted )
+                {
+                    m_CPURegisters.Halted = false;
+                    m_CPURegisters.regPC++;
+                }
+
+                // Process the interrupt based on its type
+                m_CPURegisters.IFF1 = 0;
+                m_CPURegisters.IFF2 = 0;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+
+                switch (m_CPURegisters.IM)
+                {
+                    case 0:
+                    case 1:
+                    default:
+                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
+                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
+
+                        m_CPURegisters.regPC = 0x0038;
+                        m_MEMPTR = m_CPURegisters.regPC;
+                        m_CPURegisters.TStates += 7;
+                        break;
+
+                    case 2:
+                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
+                        Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 0) & 0xff);
+
+                        // Hardware would normally put a value on the bus to be used with regI when working out
+                        // the address for the IM 2 jump table. With no hardware connected this is defaulted to
+                        // 0xff
+                        uint16_t address = (m_CPURegisters.regI << 8) | 0xff;
+                        m_CPURegisters.regPC = Z80CoreMemRead(address + 0);
+                        m_CPURegisters.regPC |= Z80CoreMemRead(address + 1) << 8;
+
+                        m_MEMPTR = m_CPURegisters.regPC;
+                        m_CPURegisters.TStates += 7;
+                        break;
+                }
+            }
+        }
+        else if (m_CPURegisters.TStates > int_t_states)
+        {
+            m_CPURegisters.IntReq = false;
+        }
+
+        // Clear the EIHandle flag
+        m_CPURegisters.EIHandled = false;
+
+        // Clear the multibyte flags in case the next instruction is not part of a multibyte instruction
+        m_CPURegisters.DDFDmultiByte = false;
+
+        // Clear the iff2 read flag before the opcode is run. If LD A, I or LD A, R is the next opcode and is followed by
+        // an interrupt, then the parity flag needs to be reset. This only effects NMOS chips and not CMOS
+        m_Iff2_read = false;
+
+        eOPCODETABLE table = eOPCODETABLE_Main;
+
+        // Read the opcode
+        uint8_t opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+
+        m_CPURegisters.regPC++;
+        m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+
+        // Handle the main bits
+        switch (opcode)
+        {
+            case 0xcb:
+                table = eOPCODETABLE_CB;
+
+                // Get the next byte
+                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                m_CPURegisters.regPC++;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+                break;
+
+            case 0xdd:
+
+                // Get the next byte
+                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                m_CPURegisters.regPC++;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+
+                if ( opcode == 0xcb )
+                {
+                    table = eOPCODETABLE_DDCB;
+
+                    // Read the offset
+                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
+                    m_CPURegisters.regPC++;
+                    m_MEMPTR = m_CPURegisters.reg_pairs.regIX + offset;
+
+                    // Get the next byte
+                    opcode = Z80CoreMemRead(m_CPURegisters.regPC);
+                    m_CPURegisters.regPC++;
+                }
+                else
+                {
+                    table = eOPCODETABLE_DD;
+                }
+                break;
+
+            case 0xed:
+                table = eOPCODETABLE_ED;
+
+                // Get the next byte
+                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                m_CPURegisters.regPC++;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+                break;
+
+            case 0xfd:
+
+                // Get the next byte
+                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                m_CPURegisters.regPC++;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+
+                if (opcode == 0xcb)
+                {
+                    table = eOPCODETABLE_FDCB;
+
+                    // Read the offset
+                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
+                    m_CPURegisters.regPC++;
+                    m_MEMPTR = m_CPURegisters.reg_pairs.regIY + offset;
+
+                    // Get the next byte
+                    opcode = Z80CoreMemRead(m_CPURegisters.regPC);
+                    m_CPURegisters.regPC++;
+                }
+                else
+                {
+                    table = eOPCODETABLE_FD;
+                }
+                break;
+        }
+
+        // Handle if the callback wants to skip over this instruction
+        bool skip_instruction = false;
+
+        // Handle a callback if needed
+        if (m_OpcodeCallback != nullptr)
+        {
+            // Callback before doing the opcode
+            skip_instruction = m_OpcodeCallback(opcode, m_CPURegisters.regPC - 1, m_Param);
+
+            // An instruction taken over by the callback (e.g. a tape trap) ends this call so the caller
+            // can act on it before anything else runs
+            if (skip_instruction)
+            {
+                break;
+            }
+        }
+
+        if ( !skip_instruction )
+        {
+            // We can now execute the instruction
+#if Z80CORE_DISPATCH == Z80CORE_DISPATCH_GOTO
+
+            // One label per opcode, built from the same lists as the opcode tables. Opcodes without a
+            // handler jump straight to the DD/FD prefix handling
+            #define Z80CORE_LABEL_OP(table, code, function, flags, format)  &&table##_##code,
+            #define Z80CORE_LABEL_NO(table, code)                           &&opcode_prefix,
+            #define Z80CORE_GOTO_OP(table, code, function, flags, format)   table##_##code: function(opcode); m_PrevOpcodeFlags = flags; goto opcode_done;
+            #define Z80CORE_GOTO_NO(table, code)
+
+            static const void * const dispatch[eOPCODETABLE_Count][256] =
+            {
+                { Z80CORE_OPCODES_Main(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_CB(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_DD(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_ED(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_FD(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_DDCB(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+                { Z80CORE_OPCODES_FDCB(Z80CORE_LABEL_OP, Z80CORE_LABEL_NO) },
+            };
+
+            goto *dispatch[table][opcode];
+
+            Z80CORE_OPCODES_Main(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_CB(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_DD(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_ED(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_FD(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_DDCB(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+            Z80CORE_OPCODES_FDCB(Z80CORE_GOTO_OP, Z80CORE_GOTO_NO)
+
+            #undef Z80CORE_LABEL_OP
+            #undef Z80CORE_LABEL_NO
+            #undef Z80CORE_GOTO_OP
+            #undef Z80CORE_GOTO_NO
+
+#elif Z80CORE_DISPATCH == Z80CORE_DISPATCH_SWITCH
+
+            #define Z80CORE_CASE_OP(table, code, function, flags, format)   case code: function(opcode); m_PrevOpcodeFlags = flags; goto opcode_done;
+            #define Z80CORE_CASE_NO(table, code)                            case code: goto opcode_prefix;
+
+            switch (table)
+            {
+                case eOPCODETABLE_Main:
+                    switch (opcode) { Z80CORE_OPCODES_Main(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_CB:
+                    switch (opcode) { Z80CORE_OPCODES_CB(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_DD:
+                    switch (opcode) { Z80CORE_OPCODES_DD(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_ED:
+                    switch (opcode) { Z80CORE_OPCODES_ED(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_FD:
+                    switch (opcode) { Z80CORE_OPCODES_FD(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_DDCB:
+                    switch (opcode) { Z80CORE_OPCODES_DDCB(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                case eOPCODETABLE_FDCB:
+                    switch (opcode) { Z80CORE_OPCODES_FDCB(Z80CORE_CASE_OP, Z80CORE_CASE_NO) }
+                    break;
+
+                default:
+                    break;
+            }
+
+            #undef Z80CORE_CASE_OP
+            #undef Z80CORE_CASE_NO
+
+            goto opcode_done;
+
+#else
+
+            static Z80OpcodeTable * const tables[eOPCODETABLE_Count] =
+            {
+                &Main_Opcodes, &CB_Opcodes, &DD_Opcodes, &ED_Opcodes, &FD_Opcodes, &DDCB_Opcodes, &FDCB_Opcodes
+            };
+
+            if (tables[table]->entries[opcode].function != nullptr)
+            {
+                // Execute the opcode
+                (this->*tables[table]->entries[opcode].function)(opcode);
+
+                // Remember the details of if we updated flags
+                m_PrevOpcodeFlags = tables[table]->entries[opcode].flags;
+                goto opcode_done;
+            }
+
+#endif
+
+        opcode_prefix:
+            // If no function has been found for the second opcode of a DD/FD multibyte instruction
+            // then use it as a prefix. Drop the PC back 1 and carry on processing the next opcode and set
+            // the chaining flag so we can stop interrupts until the chain has finished
+
+            // TODO: This could be run if an undocumented opcode is found which would break!!!
+            m_CPURegisters.DDFDmultiByte = true;
+            m_CPURegisters.regPC--;
+            m_CPURegisters.regR--;
+            m_CPURegisters.TStates -= 4;
+
+        opcode_done:
+            ;
+        }
+
+    } while (m_CPURegisters.TStates - tstates < num_tstates);
+
+    return m_CPURegisters.TStates - tstates;
+}
+
+//-----------------------------------------------------------------------------------------
+
+#include "Z80Core_MainOpcodes.inl"
+#include "Z80Core_CBOpcodes.inl"
+#include "Z80Core_DDOpcodes.inl"
+#include "Z80Core_EDOpcodes.inl"
+#include "Z80Core_FDOpcodes.inl"
+#include "Z80Core_DDCB_FDCBOpcodes.inl"
+
+//-----------------------------------------------------------------------------------------
+
+#endif
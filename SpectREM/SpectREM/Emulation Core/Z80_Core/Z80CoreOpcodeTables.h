@@ -1,1827 +1,1836 @@
-#include "Z80Core.h"
+#ifndef Z80COREOPCODETABLES_H
+#define Z80COREOPCODETABLES_H
 
-CZ80Core::Z80OpcodeTable CZ80Core::FDCB_Opcodes = {
-{
-	{ &CZ80Core::LD_B_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RLC (IY + %O)" },
-	{ &CZ80Core::LD_C_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RLC (IY + %O)" },
-	{ &CZ80Core::LD_D_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RLC (IY + %O)" },
-	{ &CZ80Core::LD_E_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RLC (IY + %O)" },
-	{ &CZ80Core::LD_H_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RLC (IY + %O)" },
-	{ &CZ80Core::LD_L_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RLC (IY + %O)" },
-	{ &CZ80Core::RLC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"RLC (IY + %O)"	  },
-	{ &CZ80Core::LD_A_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A,RLC (IY + %O)" },
-	{ &CZ80Core::LD_B_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RRC (IY + %O)" },
-	{ &CZ80Core::LD_C_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RRC (IY + %O)" },
-	{ &CZ80Core::LD_D_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RRC (IY + %O)" },
-	{ &CZ80Core::LD_E_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RRC (IY + %O)" },
-	{ &CZ80Core::LD_H_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RRC (IY + %O)" },
-	{ &CZ80Core::LD_L_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RRC (IY + %O)" },
-	{ &CZ80Core::RRC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"RRC  (IY + %O)"	  },
-	{ &CZ80Core::LD_A_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RRC (IY + %O)" },
-	{ &CZ80Core::LD_B_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RL (IY + %O)"  },
-	{ &CZ80Core::LD_C_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RL (IY + %O)"  },
-	{ &CZ80Core::LD_D_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RL (IY + %O)"  },
-	{ &CZ80Core::LD_E_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RL (IY + %O)"  },
-	{ &CZ80Core::LD_H_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RL (IY + %O)"  },
-	{ &CZ80Core::LD_L_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RL (IY + %O)"  },
-	{ &CZ80Core::RL_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,	"RL  (IY + %O)"       },
-	{ &CZ80Core::LD_A_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RL (IY + %O)"  },
-	{ &CZ80Core::LD_B_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RR (IY + %O)"  },
-	{ &CZ80Core::LD_C_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RR (IY + %O)"  },
-	{ &CZ80Core::LD_D_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RR (IY + %O)"  },
-	{ &CZ80Core::LD_E_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RR (IY + %O)"  },
-	{ &CZ80Core::LD_H_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RR (IY + %O)"  },
-	{ &CZ80Core::LD_L_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RR (IY + %O)"  },
-	{ &CZ80Core::RR_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,	"RR  (IY + %O)"       },
-	{ &CZ80Core::LD_A_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RR (IY + %O)"  },
-	{ &CZ80Core::LD_B_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SLA (IY + %O)" },
-	{ &CZ80Core::LD_C_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SLA (IY + %O)" },
-	{ &CZ80Core::LD_D_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SLA (IY + %O)" },
-	{ &CZ80Core::LD_E_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SLA (IY + %O)" },
-	{ &CZ80Core::LD_H_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SLA (IY + %O)" },
-	{ &CZ80Core::LD_L_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SLA (IY + %O)" },
-	{ &CZ80Core::SLA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SLA  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SLA (IY + %O)" },
-	{ &CZ80Core::LD_B_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SRA (IY + %O)" },
-	{ &CZ80Core::LD_C_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SRA (IY + %O)" },
-	{ &CZ80Core::LD_D_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SRA (IY + %O)" },
-	{ &CZ80Core::LD_E_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SRA (IY + %O)" },
-	{ &CZ80Core::LD_H_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SRA (IY + %O)" },
-	{ &CZ80Core::LD_L_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SRA (IY + %O)" },
-	{ &CZ80Core::SRA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SRA  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SRA (IY + %O)" },
-	{ &CZ80Core::LD_B_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_C_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_D_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_E_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_H_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_L_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SLL  (IY + %O)" },
-	{ &CZ80Core::SLL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SLL  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_B_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SRL (IY + %O)" },
-	{ &CZ80Core::LD_C_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SRL (IY + %O)" },
-	{ &CZ80Core::LD_D_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SRL (IY + %O)" },
-	{ &CZ80Core::LD_E_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SRL (IY + %O)" },
-	{ &CZ80Core::LD_H_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SRL (IY + %O)" },
-	{ &CZ80Core::LD_L_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SRL (IY + %O)" },
-	{ &CZ80Core::SRL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SRL  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SRL (IY + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::LD_B_RES_0_off_IX_IY_d , 0,								"LD   B,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_0_off_IX_IY_d , 0,								"LD   C,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_0_off_IX_IY_d , 0,								"LD   D,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_0_off_IX_IY_d , 0,								"LD   E,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_0_off_IX_IY_d , 0,								"LD   H,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_0_off_IX_IY_d , 0,								"LD   L,RES  0, (IY + %O)" },
-	{ &CZ80Core::RES_0_off_IX_IY_d      , 0,								"RES  0,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_0_off_IX_IY_d , 0,								"LD   A,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_1_off_IX_IY_d , 0,								"LD   B,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_1_off_IX_IY_d , 0,								"LD   C,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_1_off_IX_IY_d , 0,								"LD   D,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_1_off_IX_IY_d , 0,								"LD   E,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_1_off_IX_IY_d , 0,								"LD   H,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_1_off_IX_IY_d , 0,								"LD   L,RES  1, (IY + %O)" },
-	{ &CZ80Core::RES_1_off_IX_IY_d      , 0,								"RES  1,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_1_off_IX_IY_d , 0,								"LD   A,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_2_off_IX_IY_d , 0,								"LD   B,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_2_off_IX_IY_d , 0,								"LD   C,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_2_off_IX_IY_d , 0,								"LD   D,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_2_off_IX_IY_d , 0,								"LD   E,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_2_off_IX_IY_d , 0,								"LD   H,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_2_off_IX_IY_d , 0,								"LD   L,RES  2, (IY + %O)" },
-	{ &CZ80Core::RES_2_off_IX_IY_d      , 0,								"RES  2,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_2_off_IX_IY_d , 0,								"LD   A,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_3_off_IX_IY_d , 0,								"LD   B,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_3_off_IX_IY_d , 0,								"LD   C,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_3_off_IX_IY_d , 0,								"LD   D,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_3_off_IX_IY_d , 0,								"LD   E,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_3_off_IX_IY_d , 0,								"LD   H,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_3_off_IX_IY_d , 0,								"LD   L,RES  3, (IY + %O)" },
-	{ &CZ80Core::RES_3_off_IX_IY_d      , 0,								"RES  3,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_3_off_IX_IY_d , 0,								"LD   A,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_4_off_IX_IY_d , 0,								"LD   B,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_4_off_IX_IY_d , 0,								"LD   C,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_4_off_IX_IY_d , 0,								"LD   D,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_4_off_IX_IY_d , 0,								"LD   E,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_4_off_IX_IY_d , 0,								"LD   H,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_4_off_IX_IY_d , 0,								"LD   L,RES  4, (IY + %O)" },
-	{ &CZ80Core::RES_4_off_IX_IY_d      , 0,								"RES  4,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_4_off_IX_IY_d , 0,								"LD   A,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_5_off_IX_IY_d , 0,								"LD   B,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_5_off_IX_IY_d , 0,								"LD   C,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_5_off_IX_IY_d , 0,								"LD   D,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_5_off_IX_IY_d , 0,								"LD   E,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_5_off_IX_IY_d , 0,								"LD   H,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_5_off_IX_IY_d , 0,								"LD   L,RES 5,( IY + %O)" },
-	{ &CZ80Core::RES_5_off_IX_IY_d      , 0,								"RES  5,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_5_off_IX_IY_d , 0,								"LD   A,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_6_off_IX_IY_d , 0,								"LD   B,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_6_off_IX_IY_d , 0,								"LD   C,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_6_off_IX_IY_d , 0,								"LD   D,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_6_off_IX_IY_d , 0,								"LD   E,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_6_off_IX_IY_d , 0,								"LD   H,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_6_off_IX_IY_d , 0,								"LD   L,RES 6, (IY + %O)" },
-	{ &CZ80Core::RES_6_off_IX_IY_d      , 0,								"RES  6,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_6_off_IX_IY_d , 0,								"LD   A,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_7_off_IX_IY_d , 0,								"LD   B,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_7_off_IX_IY_d , 0,								"LD   C,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_7_off_IX_IY_d , 0,								"LD   D,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_7_off_IX_IY_d , 0,								"LD   E,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_7_off_IX_IY_d , 0,								"LD   H,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_7_off_IX_IY_d , 0,								"LD   L,RES 7, (IY + %O)" },
-	{ &CZ80Core::RES_7_off_IX_IY_d      , 0,								"RES  7,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_7_off_IX_IY_d , 0,								"LD   A,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_0_off_IX_IY_d , 0,								"LD   B,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_0_off_IX_IY_d , 0,								"LD   C,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_0_off_IX_IY_d , 0,								"LD   D,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_0_off_IX_IY_d , 0,								"LD   E,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_0_off_IX_IY_d , 0,								"LD   H,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_0_off_IX_IY_d , 0,								"LD   L,SET 0, (IY + %O)" },
-	{ &CZ80Core::SET_0_off_IX_IY_d      , 0,								"SET  0,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_0_off_IX_IY_d , 0,								"LD   A,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_1_off_IX_IY_d , 0,								"LD   B,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_1_off_IX_IY_d , 0,								"LD   C,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_1_off_IX_IY_d , 0,								"LD   D,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_1_off_IX_IY_d , 0,								"LD   E,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_1_off_IX_IY_d , 0,								"LD   H,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_1_off_IX_IY_d , 0,								"LD   L,SET 1, (IY + %O)" },
-	{ &CZ80Core::SET_1_off_IX_IY_d      , 0,								"SET 1,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_1_off_IX_IY_d , 0,								"LD   A,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_2_off_IX_IY_d , 0,								"LD   B,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_2_off_IX_IY_d , 0,								"LD   C,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_2_off_IX_IY_d , 0,								"LD   D,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_2_off_IX_IY_d , 0,								"LD   E,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_2_off_IX_IY_d , 0,								"LD   H,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_2_off_IX_IY_d , 0,								"LD   L,SET 2, (IY + %O)" },
-	{ &CZ80Core::SET_2_off_IX_IY_d      , 0,								"SET  2,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_2_off_IX_IY_d , 0,								"LD   A,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_3_off_IX_IY_d , 0,								"LD   B,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_3_off_IX_IY_d , 0,								"LD   C,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_3_off_IX_IY_d , 0,								"LD   D,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_3_off_IX_IY_d , 0,								"LD   E,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_3_off_IX_IY_d , 0,								"LD   H,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_3_off_IX_IY_d , 0,								"LD   L,SET 3, (IY + %O)" },
-	{ &CZ80Core::SET_3_off_IX_IY_d      , 0,								"SET  3,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_3_off_IX_IY_d , 0,								"LD   A,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_4_off_IX_IY_d , 0,								"LD   B,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_4_off_IX_IY_d , 0,								"LD   C,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_4_off_IX_IY_d , 0,								"LD   D,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_4_off_IX_IY_d , 0,								"LD   E,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_4_off_IX_IY_d , 0,								"LD   H,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_4_off_IX_IY_d , 0,								"LD   L,SET 4, (IY + %O)" },
-	{ &CZ80Core::SET_4_off_IX_IY_d      , 0,								"SET  4,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_4_off_IX_IY_d , 0,								"LD   A,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_5_off_IX_IY_d , 0,								"LD   B,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_5_off_IX_IY_d , 0,								"LD   C,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_5_off_IX_IY_d , 0,								"LD   D,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_5_off_IX_IY_d , 0,								"LD   E,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_5_off_IX_IY_d , 0,								"LD   H,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_5_off_IX_IY_d , 0,								"LD   L,SET 5, (IY + %O)" },
-	{ &CZ80Core::SET_5_off_IX_IY_d      , 0,								"SET  5,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_5_off_IX_IY_d , 0,								"LD   A,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_6_off_IX_IY_d , 0,								"LD   B,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_6_off_IX_IY_d , 0,								"LD   C,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_6_off_IX_IY_d , 0,								"LD   D,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_6_off_IX_IY_d , 0,								"LD   E,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_6_off_IX_IY_d , 0,								"LD   H,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_6_off_IX_IY_d , 0,								"LD   L,SET 6, (IY + %O)" },
-	{ &CZ80Core::SET_6_off_IX_IY_d      , 0,								"SET  6,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_6_off_IX_IY_d , 0,								"LD   A,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_7_off_IX_IY_d , 0,								"LD   B,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_7_off_IX_IY_d , 0,								"LD   C,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_7_off_IX_IY_d , 0,								"LD   D,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_7_off_IX_IY_d , 0,								"LD   E,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_7_off_IX_IY_d , 0,								"LD   H,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_7_off_IX_IY_d , 0,								"LD   L,SET 7, (IY + %O)" },
-	{ &CZ80Core::SET_7_off_IX_IY_d      , 0,								"SET  7,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_7_off_IX_IY_d , 0,								"LD   A,SET 7, (IY + %O)" }
-} };
+//-----------------------------------------------------------------------------------------
+// Each opcode table is described once as an X-macro list so the dispatcher in CZ80Core::Execute
+// and the disassembler can be built from the same data. Entries take one of two forms:
+//
+//   OP(table, code, function, flags, format)  - opcode handled by CZ80Core::function
+//   NO(table, code)                           - no handler, the byte is treated as a DD/FD prefix
+//
+// The handler and flags are the hot data used while executing (see Z80CoreImpl.h). The format
+// strings are only needed by the disassembler and are kept in their own tables in Z80Core.cpp.
+//-----------------------------------------------------------------------------------------
 
-CZ80Core::Z80OpcodeTable CZ80Core::CB_Opcodes = {
-{
-	{ &CZ80Core::RLC_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  B"             },
-	{ &CZ80Core::RLC_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  C"             },
-	{ &CZ80Core::RLC_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  D"             },
-	{ &CZ80Core::RLC_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  E"             },
-	{ &CZ80Core::RLC_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  H"             },
-	{ &CZ80Core::RLC_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  L"             },
-	{ &CZ80Core::RLC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  (HL)"          },
-	{ &CZ80Core::RLC_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  A"             },
-	{ &CZ80Core::RRC_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  B"             },
-	{ &CZ80Core::RRC_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  C"             },
-	{ &CZ80Core::RRC_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  D"             },
-	{ &CZ80Core::RRC_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  E"             },
-	{ &CZ80Core::RRC_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  H"             },
-	{ &CZ80Core::RRC_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  L"             },
-	{ &CZ80Core::RRC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  (HL)"          },
-	{ &CZ80Core::RRC_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  A"             },
-	{ &CZ80Core::RL_B                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   B"              },
-	{ &CZ80Core::RL_C                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   C"              },
-	{ &CZ80Core::RL_D                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   D"              },
-	{ &CZ80Core::RL_E                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   E"              },
-	{ &CZ80Core::RL_H                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   H"              },
-	{ &CZ80Core::RL_L                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   L"              },
-	{ &CZ80Core::RL_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   (HL)"           },
-	{ &CZ80Core::RL_A                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   A"              },
-	{ &CZ80Core::RR_B                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   B"              },
-	{ &CZ80Core::RR_C                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   C"              },
-	{ &CZ80Core::RR_D                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   D"              },
-	{ &CZ80Core::RR_E                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   E"              },
-	{ &CZ80Core::RR_H                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   H"              },
-	{ &CZ80Core::RR_L                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   L"              },
-	{ &CZ80Core::RR_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   (HL)"           },
-	{ &CZ80Core::RR_A                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   A"              },
-	{ &CZ80Core::SLA_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  B"             },
-	{ &CZ80Core::SLA_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  C"             },
-	{ &CZ80Core::SLA_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  D"             },
-	{ &CZ80Core::SLA_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  E"             },
-	{ &CZ80Core::SLA_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  H"             },
-	{ &CZ80Core::SLA_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  L"             },
-	{ &CZ80Core::SLA_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  (HL)"          },
-	{ &CZ80Core::SLA_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  A"             },
-	{ &CZ80Core::SRA_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  B"             },
-	{ &CZ80Core::SRA_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  C"             },
-	{ &CZ80Core::SRA_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  D"             },
-	{ &CZ80Core::SRA_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  E"             },
-	{ &CZ80Core::SRA_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  H"             },
-	{ &CZ80Core::SRA_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  L"             },
-	{ &CZ80Core::SRA_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  (HL)"          },
-	{ &CZ80Core::SRA_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  A"             },
-	{ &CZ80Core::SLL_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  B"             },
-	{ &CZ80Core::SLL_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  C"             },
-	{ &CZ80Core::SLL_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  D"             },
-	{ &CZ80Core::SLL_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  E"             },
-	{ &CZ80Core::SLL_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  H"             },
-	{ &CZ80Core::SLL_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  L"             },
-	{ &CZ80Core::SLL_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  (HL)"          },
-	{ &CZ80Core::SLL_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  A"             },
-	{ &CZ80Core::SRL_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  B"             },
-	{ &CZ80Core::SRL_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  C"             },
-	{ &CZ80Core::SRL_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  D"             },
-	{ &CZ80Core::SRL_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  E"             },
-	{ &CZ80Core::SRL_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  H"             },
-	{ &CZ80Core::SRL_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  L"             },
-	{ &CZ80Core::SRL_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  (HL)"          },
-	{ &CZ80Core::SRL_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  A"             },
-	{ &CZ80Core::BIT_0_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, B"           },
-	{ &CZ80Core::BIT_0_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, C"           },
-	{ &CZ80Core::BIT_0_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, D"           },
-	{ &CZ80Core::BIT_0_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, E"           },
-	{ &CZ80Core::BIT_0_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, H"           },
-	{ &CZ80Core::BIT_0_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, L"           },
-	{ &CZ80Core::BIT_0_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (HL)"        },
-	{ &CZ80Core::BIT_0_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, A"           },
-	{ &CZ80Core::BIT_1_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, B"           },
-	{ &CZ80Core::BIT_1_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, C"           },
-	{ &CZ80Core::BIT_1_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, D"           },
-	{ &CZ80Core::BIT_1_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, E"           },
-	{ &CZ80Core::BIT_1_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, H"           },
-	{ &CZ80Core::BIT_1_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, L"           },
-	{ &CZ80Core::BIT_1_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (HL)"        },
-	{ &CZ80Core::BIT_1_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, A"           },
-	{ &CZ80Core::BIT_2_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, B"           },
-	{ &CZ80Core::BIT_2_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, C"           },
-	{ &CZ80Core::BIT_2_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, D"           },
-	{ &CZ80Core::BIT_2_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, E"           },
-	{ &CZ80Core::BIT_2_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, H"           },
-	{ &CZ80Core::BIT_2_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, L"           },
-	{ &CZ80Core::BIT_2_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (HL)"        },
-	{ &CZ80Core::BIT_2_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, A"           },
-	{ &CZ80Core::BIT_3_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, B"           },
-	{ &CZ80Core::BIT_3_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, C"           },
-	{ &CZ80Core::BIT_3_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, D"           },
-	{ &CZ80Core::BIT_3_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, E"           },
-	{ &CZ80Core::BIT_3_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, H"           },
-	{ &CZ80Core::BIT_3_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, L"           },
-	{ &CZ80Core::BIT_3_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (HL)"        },
-	{ &CZ80Core::BIT_3_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, A"           },
-	{ &CZ80Core::BIT_4_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, B"           },
-	{ &CZ80Core::BIT_4_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, C"           },
-	{ &CZ80Core::BIT_4_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, D"           },
-	{ &CZ80Core::BIT_4_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, E"           },
-	{ &CZ80Core::BIT_4_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, H"           },
-	{ &CZ80Core::BIT_4_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, L"           },
-	{ &CZ80Core::BIT_4_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (HL)"        },
-	{ &CZ80Core::BIT_4_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, A"           },
-	{ &CZ80Core::BIT_5_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, B"           },
-	{ &CZ80Core::BIT_5_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, C"           },
-	{ &CZ80Core::BIT_5_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, D"           },
-	{ &CZ80Core::BIT_5_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, E"           },
-	{ &CZ80Core::BIT_5_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, H"           },
-	{ &CZ80Core::BIT_5_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, L"           },
-	{ &CZ80Core::BIT_5_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (HL)"        },
-	{ &CZ80Core::BIT_5_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, A"           },
-	{ &CZ80Core::BIT_6_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, B"           },
-	{ &CZ80Core::BIT_6_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, C"           },
-	{ &CZ80Core::BIT_6_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, D"           },
-	{ &CZ80Core::BIT_6_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, E"           },
-	{ &CZ80Core::BIT_6_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, H"           },
-	{ &CZ80Core::BIT_6_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, L"           },
-	{ &CZ80Core::BIT_6_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (HL)"        },
-	{ &CZ80Core::BIT_6_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, A"           },
-	{ &CZ80Core::BIT_7_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, B"           },
-	{ &CZ80Core::BIT_7_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, C"           },
-	{ &CZ80Core::BIT_7_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, D"           },
-	{ &CZ80Core::BIT_7_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, E"           },
-	{ &CZ80Core::BIT_7_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, H"           },
-	{ &CZ80Core::BIT_7_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, L"           },
-	{ &CZ80Core::BIT_7_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (HL)"        },
-	{ &CZ80Core::BIT_7_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, A"           },
-	{ &CZ80Core::RES_0_B             , 0,										"RES  0, B"           },
-	{ &CZ80Core::RES_0_C             , 0,										"RES  0, C"           },
-	{ &CZ80Core::RES_0_D             , 0,										"RES  0, D"           },
-	{ &CZ80Core::RES_0_E             , 0,										"RES  0, E"           },
-	{ &CZ80Core::RES_0_H             , 0,										"RES  0, H"           },
-	{ &CZ80Core::RES_0_L             , 0,										"RES  0, L"           },
-	{ &CZ80Core::RES_0_off_HL        , 0,										"RES  0, (HL)"        },
-	{ &CZ80Core::RES_0_A             , 0,										"RES  0, A"           },
-	{ &CZ80Core::RES_1_B             , 0,										"RES  1, B"           },
-	{ &CZ80Core::RES_1_C             , 0,										"RES  1, C"           },
-	{ &CZ80Core::RES_1_D             , 0,										"RES  1, D"           },
-	{ &CZ80Core::RES_1_E             , 0,										"RES  1, E"           },
-	{ &CZ80Core::RES_1_H             , 0,										"RES  1, H"           },
-	{ &CZ80Core::RES_1_L             , 0,										"RES  1, L"           },
-	{ &CZ80Core::RES_1_off_HL        , 0,										"RES  1, (HL)"        },
-	{ &CZ80Core::RES_1_A             , 0,										"RES  1, A"           },
-	{ &CZ80Core::RES_2_B             , 0,										"RES  2, B"           },
-	{ &CZ80Core::RES_2_C             , 0,										"RES  2, C"           },
-	{ &CZ80Core::RES_2_D             , 0,										"RES  2, D"           },
-	{ &CZ80Core::RES_2_E             , 0,										"RES  2, E"           },
-	{ &CZ80Core::RES_2_H             , 0,										"RES  2, H"           },
-	{ &CZ80Core::RES_2_L             , 0,										"RES  2, L"           },
-	{ &CZ80Core::RES_2_off_HL        , 0,										"RES  2, (HL)"        },
-	{ &CZ80Core::RES_2_A             , 0,										"RES  2, A"           },
-	{ &CZ80Core::RES_3_B             , 0,										"RES  3, B"           },
-	{ &CZ80Core::RES_3_C             , 0,										"RES  3, C"           },
-	{ &CZ80Core::RES_3_D             , 0,										"RES  3, D"           },
-	{ &CZ80Core::RES_3_E             , 0,										"RES  3, E"           },
-	{ &CZ80Core::RES_3_H             , 0,										"RES  3, H"           },
-	{ &CZ80Core::RES_3_L             , 0,										"RES  3, L"           },
-	{ &CZ80Core::RES_3_off_HL        , 0,										"RES  3, (HL)"        },
-	{ &CZ80Core::RES_3_A             , 0,										"RES  3, A"           },
-	{ &CZ80Core::RES_4_B             , 0,										"RES  4, B"           },
-	{ &CZ80Core::RES_4_C             , 0,										"RES  4, C"           },
-	{ &CZ80Core::RES_4_D             , 0,										"RES  4, D"           },
-	{ &CZ80Core::RES_4_E             , 0,										"RES  4, E"           },
-	{ &CZ80Core::RES_4_H             , 0,										"RES  4, H"           },
-	{ &CZ80Core::RES_4_L             , 0,										"RES  4, L"           },
-	{ &CZ80Core::RES_4_off_HL        , 0,										"RES  4, (HL)"        },
-	{ &CZ80Core::RES_4_A             , 0,										"RES  4, A"           },
-	{ &CZ80Core::RES_5_B             , 0,										"RES  5, B"           },
-	{ &CZ80Core::RES_5_C             , 0,										"RES  5, C"           },
-	{ &CZ80Core::RES_5_D             , 0,										"RES  5, D"           },
-	{ &CZ80Core::RES_5_E             , 0,										"RES  5, E"           },
-	{ &CZ80Core::RES_5_H             , 0,										"RES  5, H"           },
-	{ &CZ80Core::RES_5_L             , 0,										"RES  5, L"           },
-	{ &CZ80Core::RES_5_off_HL        , 0,										"RES  5, (HL)"        },
-	{ &CZ80Core::RES_5_A             , 0,										"RES  5, A"           },
-	{ &CZ80Core::RES_6_B             , 0,										"RES  6, B"           },
-	{ &CZ80Core::RES_6_C             , 0,										"RES  6, C"           },
-	{ &CZ80Core::RES_6_D             , 0,										"RES  6, D"           },
-	{ &CZ80Core::RES_6_E             , 0,										"RES  6, E"           },
-	{ &CZ80Core::RES_6_H             , 0,										"RES  6, H"           },
-	{ &CZ80Core::RES_6_L             , 0,										"RES  6, L"           },
-	{ &CZ80Core::RES_6_off_HL        , 0,										"RES  6, (HL)"        },
-	{ &CZ80Core::RES_6_A             , 0,										"RES  6, A"           },
-	{ &CZ80Core::RES_7_B             , 0,										"RES  7, B"           },
-	{ &CZ80Core::RES_7_C             , 0,										"RES  7, C"           },
-	{ &CZ80Core::RES_7_D             , 0,										"RES  7, D"           },
-	{ &CZ80Core::RES_7_E             , 0,										"RES  7, E"           },
-	{ &CZ80Core::RES_7_H             , 0,										"RES  7, H"           },
-	{ &CZ80Core::RES_7_L             , 0,										"RES  7, L"           },
-	{ &CZ80Core::RES_7_off_HL        , 0,										"RES  7, (HL)"        },
-	{ &CZ80Core::RES_7_A             , 0,										"RES  7, A"           },
-	{ &CZ80Core::SET_0_B             , 0,										"SET  0, B"           },
-	{ &CZ80Core::SET_0_C             , 0,										"SET  0, C"           },
-	{ &CZ80Core::SET_0_D             , 0,										"SET  0, D"           },
-	{ &CZ80Core::SET_0_E             , 0,										"SET  0, E"           },
-	{ &CZ80Core::SET_0_H             , 0,										"SET  0, H"           },
-	{ &CZ80Core::SET_0_L             , 0,										"SET  0, L"           },
-	{ &CZ80Core::SET_0_off_HL        , 0,										"SET  0, (HL)"        },
-	{ &CZ80Core::SET_0_A             , 0,										"SET  0, A"           },
-	{ &CZ80Core::SET_1_B             , 0,										"SET  1, B"           },
-	{ &CZ80Core::SET_1_C             , 0,										"SET  1, C"           },
-	{ &CZ80Core::SET_1_D             , 0,										"SET  1, D"           },
-	{ &CZ80Core::SET_1_E             , 0,										"SET  1, E"           },
-	{ &CZ80Core::SET_1_H             , 0,										"SET  1, H"           },
-	{ &CZ80Core::SET_1_L             , 0,										"SET  1, L"           },
-	{ &CZ80Core::SET_1_off_HL        , 0,										"SET  1, (HL)"        },
-	{ &CZ80Core::SET_1_A             , 0,										"SET  1, A"           },
-	{ &CZ80Core::SET_2_B             , 0,										"SET  2, B"           },
-	{ &CZ80Core::SET_2_C             , 0,										"SET  2, C"           },
-	{ &CZ80Core::SET_2_D             , 0,										"SET  2, D"           },
-	{ &CZ80Core::SET_2_E             , 0,										"SET  2, E"           },
-	{ &CZ80Core::SET_2_H             , 0,										"SET  2, H"           },
-	{ &CZ80Core::SET_2_L             , 0,										"SET  2, L"           },
-	{ &CZ80Core::SET_2_off_HL        , 0,										"SET  2, (HL)"        },
-	{ &CZ80Core::SET_2_A             , 0,										"SET  2, A"           },
-	{ &CZ80Core::SET_3_B             , 0,										"SET  3, B"           },
-	{ &CZ80Core::SET_3_C             , 0,										"SET  3, C"           },
-	{ &CZ80Core::SET_3_D             , 0,										"SET  3, D"           },
-	{ &CZ80Core::SET_3_E             , 0,										"SET  3, E"           },
-	{ &CZ80Core::SET_3_H             , 0,										"SET  3, H"           },
-	{ &CZ80Core::SET_3_L             , 0,										"SET  3, L"           },
-	{ &CZ80Core::SET_3_off_HL        , 0,										"SET  3, (HL)"        },
-	{ &CZ80Core::SET_3_A             , 0,										"SET  3, A"           },
-	{ &CZ80Core::SET_4_B             , 0,										"SET  4, B"           },
-	{ &CZ80Core::SET_4_C             , 0,										"SET  4, C"           },
-	{ &CZ80Core::SET_4_D             , 0,										"SET  4, D"           },
-	{ &CZ80Core::SET_4_E             , 0,										"SET  4, E"           },
-	{ &CZ80Core::SET_4_H             , 0,										"SET  4, H"           },
-	{ &CZ80Core::SET_4_L             , 0,										"SET  4, L"           },
-	{ &CZ80Core::SET_4_off_HL        , 0,										"SET  4, (HL)"        },
-	{ &CZ80Core::SET_4_A             , 0,										"SET  4, A"           },
-	{ &CZ80Core::SET_5_B             , 0,										"SET  5, B"           },
-	{ &CZ80Core::SET_5_C             , 0,										"SET  5, C"           },
-	{ &CZ80Core::SET_5_D             , 0,										"SET  5, D"           },
-	{ &CZ80Core::SET_5_E             , 0,										"SET  5, E"           },
-	{ &CZ80Core::SET_5_H             , 0,										"SET  5, H"           },
-	{ &CZ80Core::SET_5_L             , 0,										"SET  5, L"           },
-	{ &CZ80Core::SET_5_off_HL        , 0,										"SET  5, (HL)"        },
-	{ &CZ80Core::SET_5_A             , 0,										"SET  5, A"           },
-	{ &CZ80Core::SET_6_B             , 0,										"SET  6, B"           },
-	{ &CZ80Core::SET_6_C             , 0,										"SET  6, C"           },
-	{ &CZ80Core::SET_6_D             , 0,										"SET  6, D"           },
-	{ &CZ80Core::SET_6_E             , 0,										"SET  6, E"           },
-	{ &CZ80Core::SET_6_H             , 0,										"SET  6, H"           },
-	{ &CZ80Core::SET_6_L             , 0,										"SET  6, L"           },
-	{ &CZ80Core::SET_6_off_HL        , 0,										"SET  6, (HL)"        },
-	{ &CZ80Core::SET_6_A             , 0,										"SET  6, A"           },
-	{ &CZ80Core::SET_7_B             , 0,										"SET  7, B"           },
-	{ &CZ80Core::SET_7_C             , 0,										"SET  7, C"           },
-	{ &CZ80Core::SET_7_D             , 0,										"SET  7, D"           },
-	{ &CZ80Core::SET_7_E             , 0,										"SET  7, E"           },
-	{ &CZ80Core::SET_7_H             , 0,										"SET  7, H"           },
-	{ &CZ80Core::SET_7_L             , 0,										"SET  7, L"           },
-	{ &CZ80Core::SET_7_off_HL        , 0,										"SET  7, (HL)"        },
-	{ &CZ80Core::SET_7_A             , 0,										"SET  7, A"           }
-} };
+// Main (unprefixed) opcodes
+#define Z80CORE_OPCODES_Main(OP, NO) \
+	OP(Main, 0x00, NOP                       , 0                                 , "NOP") \
+	OP(Main, 0x01, LD_BC_nn                  , 0                                 , "LD   BC, %W") \
+	OP(Main, 0x02, LD_off_BC_A               , 0                                 , "LD   (BC), A") \
+	OP(Main, 0x03, INC_BC                    , 0                                 , "INC  BC") \
+	OP(Main, 0x04, INC_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  B") \
+	OP(Main, 0x05, DEC_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  B") \
+	OP(Main, 0x06, LD_B_n                    , 0                                 , "LD   B, %B") \
+	OP(Main, 0x07, RLCA                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RLCA") \
+	OP(Main, 0x08, EX_AF_AF_                 , 0                                 , "EX   AF, AF'") \
+	OP(Main, 0x09, ADD_HL_BC                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  HL, BC") \
+	OP(Main, 0x0a, LD_A_off_BC               , 0                                 , "LD   A, (BC)") \
+	OP(Main, 0x0b, DEC_BC                    , 0                                 , "DEC  BC") \
+	OP(Main, 0x0c, INC_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  C") \
+	OP(Main, 0x0d, DEC_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  C") \
+	OP(Main, 0x0e, LD_C_n                    , 0                                 , "LD   C, %B") \
+	OP(Main, 0x0f, RRCA                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RRCA") \
+	OP(Main, 0x10, DJNZ_off_PC_e             , 0                                 , "DJNZ %R") \
+	OP(Main, 0x11, LD_DE_nn                  , 0                                 , "LD   DE, %W") \
+	OP(Main, 0x12, LD_off_DE_A               , 0                                 , "LD   (DE), A") \
+	OP(Main, 0x13, INC_DE                    , 0                                 , "INC  DE") \
+	OP(Main, 0x14, INC_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  D") \
+	OP(Main, 0x15, DEC_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  D") \
+	OP(Main, 0x16, LD_D_n                    , 0                                 , "LD   D, %B") \
+	OP(Main, 0x17, RLA                       , CZ80Core::OPCODEFLAG_AltersFlags  , "RLA") \
+	OP(Main, 0x18, JR_off_PC_e               , 0                                 , "JR   %R") \
+	OP(Main, 0x19, ADD_HL_DE                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  HL, DE") \
+	OP(Main, 0x1a, LD_A_off_DE               , 0                                 , "LD   A, (DE)") \
+	OP(Main, 0x1b, DEC_DE                    , 0                                 , "DEC  DE") \
+	OP(Main, 0x1c, INC_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  E") \
+	OP(Main, 0x1d, DEC_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  E") \
+	OP(Main, 0x1e, LD_E_n                    , 0                                 , "LD   E, %B") \
+	OP(Main, 0x1f, RRA                       , CZ80Core::OPCODEFLAG_AltersFlags  , "RRA") \
+	OP(Main, 0x20, JR_NZ_off_PC_e            , 0                                 , "JR   NZ, %R") \
+	OP(Main, 0x21, LD_HL_nn                  , 0                                 , "LD   HL, %W") \
+	OP(Main, 0x22, LD_off_nn_HL              , 0                                 , "LD   (%W), HL") \
+	OP(Main, 0x23, INC_HL                    , 0                                 , "INC  HL") \
+	OP(Main, 0x24, INC_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  H") \
+	OP(Main, 0x25, DEC_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  H") \
+	OP(Main, 0x26, LD_H_n                    , 0                                 , "LD   H, %B") \
+	OP(Main, 0x27, DAA                       , CZ80Core::OPCODEFLAG_AltersFlags  , "DAA") \
+	OP(Main, 0x28, JR_Z_off_PC_e             , 0                                 , "JR   Z, %R") \
+	OP(Main, 0x29, ADD_HL_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  HL,HL") \
+	OP(Main, 0x2a, LD_HL_off_nn              , 0                                 , "LD   HL, (%W)") \
+	OP(Main, 0x2b, DEC_HL                    , 0                                 , "DEC  HL") \
+	OP(Main, 0x2c, INC_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  L") \
+	OP(Main, 0x2d, DEC_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  L") \
+	OP(Main, 0x2e, LD_L_n                    , 0                                 , "LD   L, %B") \
+	OP(Main, 0x2f, CPL                       , CZ80Core::OPCODEFLAG_AltersFlags  , "CPL") \
+	OP(Main, 0x30, JR_NC_off_PC_e            , 0                                 , "JR   NC, %R") \
+	OP(Main, 0x31, LD_SP_nn                  , 0                                 , "LD   SP, %W") \
+	OP(Main, 0x32, LD_off_nn_A               , 0                                 , "LD   (%W), A") \
+	OP(Main, 0x33, INC_SP                    , 0                                 , "INC  SP") \
+	OP(Main, 0x34, INC_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  (HL)") \
+	OP(Main, 0x35, DEC_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  (HL)") \
+	OP(Main, 0x36, LD_off_HL_n               , 0                                 , "LD   (HL), %B") \
+	OP(Main, 0x37, SCF                       , CZ80Core::OPCODEFLAG_AltersFlags  , "SCF") \
+	OP(Main, 0x38, JR_C_off_PC_e             , 0                                 , "JR   C, %R") \
+	OP(Main, 0x39, ADD_HL_SP                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  HL, SP") \
+	OP(Main, 0x3a, LD_A_off_nn               , 0                                 , "LD   A, (%W)") \
+	OP(Main, 0x3b, DEC_SP                    , 0                                 , "DEC  SP") \
+	OP(Main, 0x3c, INC_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "INC  A") \
+	OP(Main, 0x3d, DEC_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC  A") \
+	OP(Main, 0x3e, LD_A_n                    , 0                                 , "LD   A, %B") \
+	OP(Main, 0x3f, CCF                       , CZ80Core::OPCODEFLAG_AltersFlags  , "CCF") \
+	OP(Main, 0x40, LD_B_B                    , 0                                 , "LD   B, B") \
+	OP(Main, 0x41, LD_B_C                    , 0                                 , "LD   B, C") \
+	OP(Main, 0x42, LD_B_D                    , 0                                 , "LD   B, D") \
+	OP(Main, 0x43, LD_B_E                    , 0                                 , "LD   B, E") \
+	OP(Main, 0x44, LD_B_H                    , 0                                 , "LD   B, H") \
+	OP(Main, 0x45, LD_B_L                    , 0                                 , "LD   B, L") \
+	OP(Main, 0x46, LD_B_off_HL               , 0                                 , "LD   B, (HL)") \
+	OP(Main, 0x47, LD_B_A                    , 0                                 , "LD   B, A") \
+	OP(Main, 0x48, LD_C_B                    , 0                                 , "LD   C, B") \
+	OP(Main, 0x49, LD_C_C                    , 0                                 , "LD   C, C") \
+	OP(Main, 0x4a, LD_C_D                    , 0                                 , "LD   C, D") \
+	OP(Main, 0x4b, LD_C_E                    , 0                                 , "LD   C, E") \
+	OP(Main, 0x4c, LD_C_H                    , 0                                 , "LD   C, H") \
+	OP(Main, 0x4d, LD_C_L                    , 0                                 , "LD   C, L") \
+	OP(Main, 0x4e, LD_C_off_HL               , 0                                 , "LD   C, (HL)") \
+	OP(Main, 0x4f, LD_C_A                    , 0                                 , "LD   C, A") \
+	OP(Main, 0x50, LD_D_B                    , 0                                 , "LD   D, B") \
+	OP(Main, 0x51, LD_D_C                    , 0                                 , "LD   D, C") \
+	OP(Main, 0x52, LD_D_D                    , 0                                 , "LD   D, D") \
+	OP(Main, 0x53, LD_D_E                    , 0                                 , "LD   D, E") \
+	OP(Main, 0x54, LD_D_H                    , 0                                 , "LD   D, H") \
+	OP(Main, 0x55, LD_D_L                    , 0                                 , "LD   D, L") \
+	OP(Main, 0x56, LD_D_off_HL               , 0                                 , "LD   D, (HL)") \
+	OP(Main, 0x57, LD_D_A                    , 0                                 , "LD   D, A") \
+	OP(Main, 0x58, LD_E_B                    , 0                                 , "LD   E, B") \
+	OP(Main, 0x59, LD_E_C                    , 0                                 , "LD   E, C") \
+	OP(Main, 0x5a, LD_E_D                    , 0                                 , "LD   E, D") \
+	OP(Main, 0x5b, LD_E_E                    , 0                                 , "LD   E, E") \
+	OP(Main, 0x5c, LD_E_H                    , 0                                 , "LD   E, H") \
+	OP(Main, 0x5d, LD_E_L                    , 0                                 , "LD   E, L") \
+	OP(Main, 0x5e, LD_E_off_HL               , 0                                 , "LD   E, (HL)") \
+	OP(Main, 0x5f, LD_E_A                    , 0                                 , "LD   E, A") \
+	OP(Main, 0x60, LD_H_B                    , 0                                 , "LD   H, B") \
+	OP(Main, 0x61, LD_H_C                    , 0                                 , "LD   H, C") \
+	OP(Main, 0x62, LD_H_D                    , 0                                 , "LD   H, D") \
+	OP(Main, 0x63, LD_H_E                    , 0                                 , "LD   H, E") \
+	OP(Main, 0x64, LD_H_H                    , 0                                 , "LD   H, H") \
+	OP(Main, 0x65, LD_H_L                    , 0                                 , "LD   H, L") \
+	OP(Main, 0x66, LD_H_off_HL               , 0                                 , "LD   H, (HL)") \
+	OP(Main, 0x67, LD_H_A                    , 0                                 , "LD   H, A") \
+	OP(Main, 0x68, LD_L_B                    , 0                                 , "LD   L, B") \
+	OP(Main, 0x69, LD_L_C                    , 0                                 , "LD   L, C") \
+	OP(Main, 0x6a, LD_L_D                    , 0                                 , "LD   L, D") \
+	OP(Main, 0x6b, LD_L_E                    , 0                                 , "LD   L, E") \
+	OP(Main, 0x6c, LD_L_H                    , 0                                 , "LD   L, H") \
+	OP(Main, 0x6d, LD_L_L                    , 0                                 , "LD   L, L") \
+	OP(Main, 0x6e, LD_L_off_HL               , 0                                 , "LD   L, (HL)") \
+	OP(Main, 0x6f, LD_L_A                    , 0                                 , "LD   L, A") \
+	OP(Main, 0x70, LD_off_HL_B               , 0                                 , "LD   (HL), B") \
+	OP(Main, 0x71, LD_off_HL_C               , 0                                 , "LD   (HL), C") \
+	OP(Main, 0x72, LD_off_HL_D               , 0                                 , "LD   (HL), D") \
+	OP(Main, 0x73, LD_off_HL_E               , 0                                 , "LD   (HL), E") \
+	OP(Main, 0x74, LD_off_HL_H               , 0                                 , "LD   (HL), H") \
+	OP(Main, 0x75, LD_off_HL_L               , 0                                 , "LD   (HL), L") \
+	OP(Main, 0x76, HALT                      , 0                                 , "HALT") \
+	OP(Main, 0x77, LD_off_HL_A               , 0                                 , "LD   (HL), A") \
+	OP(Main, 0x78, LD_A_B                    , 0                                 , "LD   A, B") \
+	OP(Main, 0x79, LD_A_C                    , 0                                 , "LD   A, C") \
+	OP(Main, 0x7a, LD_A_D                    , 0                                 , "LD   A, D") \
+	OP(Main, 0x7b, LD_A_E                    , 0                                 , "LD   A, E") \
+	OP(Main, 0x7c, LD_A_H                    , 0                                 , "LD   A, H") \
+	OP(Main, 0x7d, LD_A_L                    , 0                                 , "LD   A, L") \
+	OP(Main, 0x7e, LD_A_off_HL               , 0                                 , "LD   A, (HL)") \
+	OP(Main, 0x7f, LD_A_A                    , 0                                 , "LD   A, A") \
+	OP(Main, 0x80, ADD_A_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, B") \
+	OP(Main, 0x81, ADD_A_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, C") \
+	OP(Main, 0x82, ADD_A_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, D") \
+	OP(Main, 0x83, ADD_A_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, E") \
+	OP(Main, 0x84, ADD_A_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, H") \
+	OP(Main, 0x85, ADD_A_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, L") \
+	OP(Main, 0x86, ADD_A_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, (HL)") \
+	OP(Main, 0x87, ADD_A_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, A") \
+	OP(Main, 0x88, ADC_A_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, B") \
+	OP(Main, 0x89, ADC_A_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, C") \
+	OP(Main, 0x8a, ADC_A_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, D") \
+	OP(Main, 0x8b, ADC_A_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, E") \
+	OP(Main, 0x8c, ADC_A_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, H") \
+	OP(Main, 0x8d, ADC_A_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, L") \
+	OP(Main, 0x8e, ADC_A_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, (HL)") \
+	OP(Main, 0x8f, ADC_A_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, A") \
+	OP(Main, 0x90, SUB_A_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, B") \
+	OP(Main, 0x91, SUB_A_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, C") \
+	OP(Main, 0x92, SUB_A_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, D") \
+	OP(Main, 0x93, SUB_A_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, E") \
+	OP(Main, 0x94, SUB_A_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, H") \
+	OP(Main, 0x95, SUB_A_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, L") \
+	OP(Main, 0x96, SUB_A_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, (HL)") \
+	OP(Main, 0x97, SUB_A_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, A") \
+	OP(Main, 0x98, SBC_A_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, B") \
+	OP(Main, 0x99, SBC_A_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, C") \
+	OP(Main, 0x9a, SBC_A_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, D") \
+	OP(Main, 0x9b, SBC_A_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, E") \
+	OP(Main, 0x9c, SBC_A_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, H") \
+	OP(Main, 0x9d, SBC_A_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, L") \
+	OP(Main, 0x9e, SBC_A_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, (HL)") \
+	OP(Main, 0x9f, SBC_A_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, A") \
+	OP(Main, 0xa0, AND_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  B") \
+	OP(Main, 0xa1, AND_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  C") \
+	OP(Main, 0xa2, AND_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  D") \
+	OP(Main, 0xa3, AND_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  E") \
+	OP(Main, 0xa4, AND_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  H") \
+	OP(Main, 0xa5, AND_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  L") \
+	OP(Main, 0xa6, AND_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  (HL)") \
+	OP(Main, 0xa7, AND_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  A") \
+	OP(Main, 0xa8, XOR_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  B") \
+	OP(Main, 0xa9, XOR_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  C") \
+	OP(Main, 0xaa, XOR_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  D") \
+	OP(Main, 0xab, XOR_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  E") \
+	OP(Main, 0xac, XOR_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  H") \
+	OP(Main, 0xad, XOR_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  L") \
+	OP(Main, 0xae, XOR_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  (HL)") \
+	OP(Main, 0xaf, XOR_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  A") \
+	OP(Main, 0xb0, OR_B                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   B") \
+	OP(Main, 0xb1, OR_C                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   C") \
+	OP(Main, 0xb2, OR_D                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   D") \
+	OP(Main, 0xb3, OR_E                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   E") \
+	OP(Main, 0xb4, OR_H                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   H") \
+	OP(Main, 0xb5, OR_L                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   L") \
+	OP(Main, 0xb6, OR_off_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   (HL)") \
+	OP(Main, 0xb7, OR_A                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   A") \
+	OP(Main, 0xb8, CP_B                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   B") \
+	OP(Main, 0xb9, CP_C                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   C") \
+	OP(Main, 0xba, CP_D                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   D") \
+	OP(Main, 0xbb, CP_E                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   E") \
+	OP(Main, 0xbc, CP_H                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   H") \
+	OP(Main, 0xbd, CP_L                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   L") \
+	OP(Main, 0xbe, CP_off_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   (HL)") \
+	OP(Main, 0xbf, CP_A                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   A") \
+	OP(Main, 0xc0, RET_NZ                    , 0                                 , "RET  NZ") \
+	OP(Main, 0xc1, POP_BC                    , 0                                 , "POP  BC") \
+	OP(Main, 0xc2, JP_NZ_off_nn              , 0                                 , "JP   NZ, %W") \
+	OP(Main, 0xc3, JP_off_nn                 , 0                                 , "JP   %W") \
+	OP(Main, 0xc4, CALL_NZ_off_nn            , 0                                 , "CALL NZ, %W") \
+	OP(Main, 0xc5, PUSH_BC                   , 0                                 , "PUSH BC") \
+	OP(Main, 0xc6, ADD_A_n                   , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, %B") \
+	OP(Main, 0xc7, RST_0H                    , 0                                 , "RST  0H") \
+	OP(Main, 0xc8, RET_Z                     , 0                                 , "RET  Z") \
+	OP(Main, 0xc9, RET                       , 0                                 , "RET") \
+	OP(Main, 0xca, JP_Z_off_nn               , 0                                 , "JP   Z, %W") \
+	NO(Main, 0xcb) \
+	OP(Main, 0xcc, CALL_Z_off_nn             , 0                                 , "CALL Z, %W") \
+	OP(Main, 0xcd, CALL_off_nn               , 0                                 , "CALL %W") \
+	OP(Main, 0xce, ADC_A_n                   , 0                                 , "ADC  A, %B") \
+	OP(Main, 0xcf, RST_8H                    , 0                                 , "RST  8H") \
+	OP(Main, 0xd0, RET_NC                    , 0                                 , "RET  NC") \
+	OP(Main, 0xd1, POP_DE                    , 0                                 , "POP  DE") \
+	OP(Main, 0xd2, JP_NC_off_nn              , 0                                 , "JP   NC, %W") \
+	OP(Main, 0xd3, OUT_off_n_A               , 0                                 , "OUT (%B), A") \
+	OP(Main, 0xd4, CALL_NC_off_nn            , 0                                 , "CALL NC, %W") \
+	OP(Main, 0xd5, PUSH_DE                   , 0                                 , "PUSH DE") \
+	OP(Main, 0xd6, SUB_A_n                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A, %B") \
+	OP(Main, 0xd7, RST_10H                   , 0                                 , "RST  10H") \
+	OP(Main, 0xd8, RET_C                     , 0                                 , "RET  C") \
+	OP(Main, 0xd9, EXX                       , 0                                 , "EXX") \
+	OP(Main, 0xda, JP_C_off_nn               , 0                                 , "JP   C, %W") \
+	OP(Main, 0xdb, IN_A_off_n                , 0                                 , "IN   A, (%B)") \
+	OP(Main, 0xdc, CALL_C_off_nn             , 0                                 , "CALL C, %W") \
+	NO(Main, 0xdd) \
+	OP(Main, 0xde, SBC_A_n                   , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A, %B") \
+	OP(Main, 0xdf, RST_18H                   , 0                                 , "RST  18H") \
+	OP(Main, 0xe0, RET_PO                    , 0                                 , "RET  PO") \
+	OP(Main, 0xe1, POP_HL                    , 0                                 , "POP  HL") \
+	OP(Main, 0xe2, JP_PO_off_nn              , 0                                 , "JP   PO, %W") \
+	OP(Main, 0xe3, EX_off_SP_HL              , 0                                 , "EX   (SP), HL") \
+	OP(Main, 0xe4, CALL_PO_off_nn            , 0                                 , "CALL PO, %W") \
+	OP(Main, 0xe5, PUSH_HL                   , 0                                 , "PUSH HL") \
+	OP(Main, 0xe6, AND_n                     , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  %B") \
+	OP(Main, 0xe7, RST_20H                   , 0                                 , "RST  20H") \
+	OP(Main, 0xe8, RET_PE                    , 0                                 , "RET  PE") \
+	OP(Main, 0xe9, JP_off_HL                 , 0                                 , "JP   (HL)") \
+	OP(Main, 0xea, JP_PE_off_nn              , 0                                 , "JP   PE, %W") \
+	OP(Main, 0xeb, EX_DE_HL                  , 0                                 , "EX   DE, HL") \
+	OP(Main, 0xec, CALL_PE_off_nn            , 0                                 , "CALL PE, %W") \
+	NO(Main, 0xed) \
+	OP(Main, 0xee, XOR_n                     , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  %B") \
+	OP(Main, 0xef, RST_28H                   , 0                                 , "RST  28H") \
+	OP(Main, 0xf0, RET_P                     , 0                                 , "RET  P") \
+	OP(Main, 0xf1, POP_AF                    , 0                                 , "POP  AF") \
+	OP(Main, 0xf2, JP_P_off_nn               , 0                                 , "JP   P, %W") \
+	OP(Main, 0xf3, DI                        , 0                                 , "DI") \
+	OP(Main, 0xf4, CALL_P_off_nn             , 0                                 , "CALL P, %W") \
+	OP(Main, 0xf5, PUSH_AF                   , 0                                 , "PUSH AF") \
+	OP(Main, 0xf6, OR_n                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   %B") \
+	OP(Main, 0xf7, RST_30H                   , 0                                 , "RST  30H") \
+	OP(Main, 0xf8, RET_M                     , 0                                 , "RET  M") \
+	OP(Main, 0xf9, LD_SP_HL                  , 0                                 , "LD   SP, HL") \
+	OP(Main, 0xfa, JP_M_off_nn               , 0                                 , "JP   M, %W") \
+	OP(Main, 0xfb, EI                        , 0                                 , "EI") \
+	OP(Main, 0xfc, CALL_M_off_nn             , 0                                 , "CALL M, %W") \
+	NO(Main, 0xfd) \
+	OP(Main, 0xfe, CP_n                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   %B") \
+	OP(Main, 0xff, RST_38H                   , 0                                 , "RST  38H") \
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
-{
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, BC"         },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, DE"         },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IX_nn            , 0,										"LD   IX, %W"      },
-	{ &CZ80Core::LD_off_nn_IX        , 0,										"LD   (%W), IX"    },
-	{ &CZ80Core::INC_IX              , 0,										"INC IX"            },
-	{ &CZ80Core::INC_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IXh"           },
-	{ &CZ80Core::DEC_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IXh"           },
-	{ &CZ80Core::LD_IXh_n            , 0,										"LD   IXh, %B"     },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_IX           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, IX"         },
-	{ &CZ80Core::LD_IX_off_nn        , 0,										"LD   IX, (%W)"    },
-	{ &CZ80Core::DEC_IX              , 0,										"DEC IX"            },
-	{ &CZ80Core::INC_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IXl"           },
-	{ &CZ80Core::DEC_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IXl"           },
-	{ &CZ80Core::LD_IXl_n            , 0,										"LD   IXl, %B"     },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::INC_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"INC (IX + %O)"   },
-	{ &CZ80Core::DEC_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC (IX + %O)"   },
-	{ &CZ80Core::LD_off_IX_d_n       , 0,										"LD   (IX + %O), %B"},
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, SP"         },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_B_IXh            , 0,										"LD   B, IXh"          },
-	{ &CZ80Core::LD_B_IXl            , 0,										"LD   B, IXl"          },
-	{ &CZ80Core::LD_B_off_IX_d       , 0,										"LD   B, (IX + %O)"  },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_C_IXh            , 0,										"LD   C, IXh"          },
-	{ &CZ80Core::LD_C_IXl            , 0,										"LD   C, IXl"          },
-	{ &CZ80Core::LD_C_off_IX_d       , 0,										"LD   C, (IX + %O)"  },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_D_IXh            , 0,										"LD   D, IXh"          },
-	{ &CZ80Core::LD_D_IXl            , 0,										"LD   D, IXl"          },
-	{ &CZ80Core::LD_D_off_IX_d       , 0,										"LD   D, (IX + %O)"  },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_E_IXh            , 0,										"LD   E, IXh"          },
-	{ &CZ80Core::LD_E_IXl            , 0,										"LD   E, IXl"          },
-	{ &CZ80Core::LD_E_off_IX_d       , 0,										"LD   E, (IX + %O)"  },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IXh_B            , 0,										"LD   IXh, B"          },
-	{ &CZ80Core::LD_IXh_C            , 0,										"LD   IXh, C"          },
-	{ &CZ80Core::LD_IXh_D            , 0,										"LD   IXh, D"          },
-	{ &CZ80Core::LD_IXh_E            , 0,										"LD   IXh, E"          },
-	{ &CZ80Core::LD_IXh_IXh          , 0,										"LD   IXh, IXh"        },
-	{ &CZ80Core::LD_IXh_IXl          , 0,										"LD   IXh, IXl"        },
-	{ &CZ80Core::LD_H_off_IX_d       , 0,										"LD   H, (IX + %O)"  },
-	{ &CZ80Core::LD_IXh_A            , 0,										"LD   IXh, A"          },
-	{ &CZ80Core::LD_IXl_B            , 0,										"LD   IXl, B"          },
-	{ &CZ80Core::LD_IXl_C            , 0,										"LD   IXl, C"          },
-	{ &CZ80Core::LD_IXl_D            , 0,										"LD   IXl, D"          },
-	{ &CZ80Core::LD_IXl_E            , 0,										"LD   IXl, E"          },
-	{ &CZ80Core::LD_IXl_IXh          , 0,										"LD   IXl, IXh"        },
-	{ &CZ80Core::LD_IXl_IXl          , 0,										"LD   IXl, IXl"        },
-	{ &CZ80Core::LD_L_off_IX_d       , 0,										"LD   L, IX + %O)"  },
-	{ &CZ80Core::LD_IXl_A            , 0,										"LD   IXl, A"          },
-	{ &CZ80Core::LD_off_IX_d_B       , 0,										"LD   (IX + %O), B"  },
-	{ &CZ80Core::LD_off_IX_d_C       , 0,										"LD   (IX + %O), C"  },
-	{ &CZ80Core::LD_off_IX_d_D       , 0,										"LD   (IX + %O), D"  },
-	{ &CZ80Core::LD_off_IX_d_E       , 0,										"LD   (IX + %O), E"  },
-	{ &CZ80Core::LD_off_IX_d_H       , 0,										"LD   (IX + %O), H"  },
-	{ &CZ80Core::LD_off_IX_d_L       , 0,										"LD   (IX + %O), L"  },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_off_IX_d_A       , 0,										"LD   (IX + %O), A"  },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_A_IXh            , 0,										"LD   A, IXh"          },
-	{ &CZ80Core::LD_A_IXl            , 0,										"LD   A, IXl"          },
-	{ &CZ80Core::LD_A_off_IX_d       , 0,										"LD   A, (IX + %O)"  },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, IXh"         },
-	{ &CZ80Core::ADD_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, IXl"         },
-	{ &CZ80Core::ADD_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, (IX + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADC_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, IXh"         },
-	{ &CZ80Core::ADC_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, IXl"         },
-	{ &CZ80Core::ADC_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, (IX + %O)" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SUB_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, IXh"         },
-	{ &CZ80Core::SUB_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, IXl"         },
-	{ &CZ80Core::SUB_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, (IX + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::SBC_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, IXh"         },
-	{ &CZ80Core::SBC_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, IXl"         },
-	{ &CZ80Core::SBC_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, (IX + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::AND_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND IXh"           },
-	{ &CZ80Core::AND_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND IXl"           },
-	{ &CZ80Core::AND_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"AND (IX + %O)"   },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::XOR_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR IXh"           },
-	{ &CZ80Core::XOR_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR IXl"           },
-	{ &CZ80Core::XOR_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR (IX + %O)"   },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::OR_IXh              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  IXh"            },
-	{ &CZ80Core::OR_IXl              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  IXl"            },
-	{ &CZ80Core::OR_off_IX_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  (IX + %O)"    },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::CP_IXh              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  IXh"            },
-	{ &CZ80Core::CP_IXl              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  IXl"            },
-	{ &CZ80Core::CP_off_IX_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  (IX + %O)"    },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::POP_IX              , 0,										"POP  IX" },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::EX_off_SP_IX        , 0,										"EX   (SP), IX" },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::PUSH_IX             , 0,										"PUSH  IX" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::JP_off_IX           , 0,										"JP   (IX)" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LD_SP_IX            , 0,										"LD   SP, IX" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr }
-} };
+// CB prefixed opcodes
+#define Z80CORE_OPCODES_CB(OP, NO) \
+	OP(CB, 0x00, RLC_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  B") \
+	OP(CB, 0x01, RLC_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  C") \
+	OP(CB, 0x02, RLC_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  D") \
+	OP(CB, 0x03, RLC_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  E") \
+	OP(CB, 0x04, RLC_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  H") \
+	OP(CB, 0x05, RLC_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  L") \
+	OP(CB, 0x06, RLC_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  (HL)") \
+	OP(CB, 0x07, RLC_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  A") \
+	OP(CB, 0x08, RRC_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  B") \
+	OP(CB, 0x09, RRC_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  C") \
+	OP(CB, 0x0a, RRC_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  D") \
+	OP(CB, 0x0b, RRC_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  E") \
+	OP(CB, 0x0c, RRC_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  H") \
+	OP(CB, 0x0d, RRC_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  L") \
+	OP(CB, 0x0e, RRC_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  (HL)") \
+	OP(CB, 0x0f, RRC_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  A") \
+	OP(CB, 0x10, RL_B                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   B") \
+	OP(CB, 0x11, RL_C                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   C") \
+	OP(CB, 0x12, RL_D                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   D") \
+	OP(CB, 0x13, RL_E                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   E") \
+	OP(CB, 0x14, RL_H                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   H") \
+	OP(CB, 0x15, RL_L                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   L") \
+	OP(CB, 0x16, RL_off_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   (HL)") \
+	OP(CB, 0x17, RL_A                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   A") \
+	OP(CB, 0x18, RR_B                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   B") \
+	OP(CB, 0x19, RR_C                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   C") \
+	OP(CB, 0x1a, RR_D                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   D") \
+	OP(CB, 0x1b, RR_E                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   E") \
+	OP(CB, 0x1c, RR_H                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   H") \
+	OP(CB, 0x1d, RR_L                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   L") \
+	OP(CB, 0x1e, RR_off_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   (HL)") \
+	OP(CB, 0x1f, RR_A                      , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   A") \
+	OP(CB, 0x20, SLA_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  B") \
+	OP(CB, 0x21, SLA_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  C") \
+	OP(CB, 0x22, SLA_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  D") \
+	OP(CB, 0x23, SLA_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  E") \
+	OP(CB, 0x24, SLA_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  H") \
+	OP(CB, 0x25, SLA_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  L") \
+	OP(CB, 0x26, SLA_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  (HL)") \
+	OP(CB, 0x27, SLA_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  A") \
+	OP(CB, 0x28, SRA_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  B") \
+	OP(CB, 0x29, SRA_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  C") \
+	OP(CB, 0x2a, SRA_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  D") \
+	OP(CB, 0x2b, SRA_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  E") \
+	OP(CB, 0x2c, SRA_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  H") \
+	OP(CB, 0x2d, SRA_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  L") \
+	OP(CB, 0x2e, SRA_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  (HL)") \
+	OP(CB, 0x2f, SRA_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  A") \
+	OP(CB, 0x30, SLL_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  B") \
+	OP(CB, 0x31, SLL_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  C") \
+	OP(CB, 0x32, SLL_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  D") \
+	OP(CB, 0x33, SLL_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  E") \
+	OP(CB, 0x34, SLL_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  H") \
+	OP(CB, 0x35, SLL_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  L") \
+	OP(CB, 0x36, SLL_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  (HL)") \
+	OP(CB, 0x37, SLL_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  A") \
+	OP(CB, 0x38, SRL_B                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  B") \
+	OP(CB, 0x39, SRL_C                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  C") \
+	OP(CB, 0x3a, SRL_D                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  D") \
+	OP(CB, 0x3b, SRL_E                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  E") \
+	OP(CB, 0x3c, SRL_H                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  H") \
+	OP(CB, 0x3d, SRL_L                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  L") \
+	OP(CB, 0x3e, SRL_off_HL                , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  (HL)") \
+	OP(CB, 0x3f, SRL_A                     , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  A") \
+	OP(CB, 0x40, BIT_0_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, B") \
+	OP(CB, 0x41, BIT_0_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, C") \
+	OP(CB, 0x42, BIT_0_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, D") \
+	OP(CB, 0x43, BIT_0_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, E") \
+	OP(CB, 0x44, BIT_0_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, H") \
+	OP(CB, 0x45, BIT_0_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, L") \
+	OP(CB, 0x46, BIT_0_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (HL)") \
+	OP(CB, 0x47, BIT_0_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, A") \
+	OP(CB, 0x48, BIT_1_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, B") \
+	OP(CB, 0x49, BIT_1_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, C") \
+	OP(CB, 0x4a, BIT_1_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, D") \
+	OP(CB, 0x4b, BIT_1_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, E") \
+	OP(CB, 0x4c, BIT_1_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, H") \
+	OP(CB, 0x4d, BIT_1_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, L") \
+	OP(CB, 0x4e, BIT_1_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (HL)") \
+	OP(CB, 0x4f, BIT_1_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, A") \
+	OP(CB, 0x50, BIT_2_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, B") \
+	OP(CB, 0x51, BIT_2_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, C") \
+	OP(CB, 0x52, BIT_2_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, D") \
+	OP(CB, 0x53, BIT_2_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, E") \
+	OP(CB, 0x54, BIT_2_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, H") \
+	OP(CB, 0x55, BIT_2_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, L") \
+	OP(CB, 0x56, BIT_2_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (HL)") \
+	OP(CB, 0x57, BIT_2_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, A") \
+	OP(CB, 0x58, BIT_3_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, B") \
+	OP(CB, 0x59, BIT_3_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, C") \
+	OP(CB, 0x5a, BIT_3_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, D") \
+	OP(CB, 0x5b, BIT_3_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, E") \
+	OP(CB, 0x5c, BIT_3_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, H") \
+	OP(CB, 0x5d, BIT_3_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, L") \
+	OP(CB, 0x5e, BIT_3_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (HL)") \
+	OP(CB, 0x5f, BIT_3_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, A") \
+	OP(CB, 0x60, BIT_4_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, B") \
+	OP(CB, 0x61, BIT_4_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, C") \
+	OP(CB, 0x62, BIT_4_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, D") \
+	OP(CB, 0x63, BIT_4_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, E") \
+	OP(CB, 0x64, BIT_4_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, H") \
+	OP(CB, 0x65, BIT_4_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, L") \
+	OP(CB, 0x66, BIT_4_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (HL)") \
+	OP(CB, 0x67, BIT_4_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, A") \
+	OP(CB, 0x68, BIT_5_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, B") \
+	OP(CB, 0x69, BIT_5_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, C") \
+	OP(CB, 0x6a, BIT_5_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, D") \
+	OP(CB, 0x6b, BIT_5_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, E") \
+	OP(CB, 0x6c, BIT_5_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, H") \
+	OP(CB, 0x6d, BIT_5_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, L") \
+	OP(CB, 0x6e, BIT_5_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (HL)") \
+	OP(CB, 0x6f, BIT_5_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, A") \
+	OP(CB, 0x70, BIT_6_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, B") \
+	OP(CB, 0x71, BIT_6_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, C") \
+	OP(CB, 0x72, BIT_6_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, D") \
+	OP(CB, 0x73, BIT_6_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, E") \
+	OP(CB, 0x74, BIT_6_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, H") \
+	OP(CB, 0x75, BIT_6_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, L") \
+	OP(CB, 0x76, BIT_6_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (HL)") \
+	OP(CB, 0x77, BIT_6_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, A") \
+	OP(CB, 0x78, BIT_7_B                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, B") \
+	OP(CB, 0x79, BIT_7_C                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, C") \
+	OP(CB, 0x7a, BIT_7_D                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, D") \
+	OP(CB, 0x7b, BIT_7_E                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, E") \
+	OP(CB, 0x7c, BIT_7_H                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, H") \
+	OP(CB, 0x7d, BIT_7_L                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, L") \
+	OP(CB, 0x7e, BIT_7_off_HL              , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (HL)") \
+	OP(CB, 0x7f, BIT_7_A                   , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, A") \
+	OP(CB, 0x80, RES_0_B                   , 0                                 , "RES  0, B") \
+	OP(CB, 0x81, RES_0_C                   , 0                                 , "RES  0, C") \
+	OP(CB, 0x82, RES_0_D                   , 0                                 , "RES  0, D") \
+	OP(CB, 0x83, RES_0_E                   , 0                                 , "RES  0, E") \
+	OP(CB, 0x84, RES_0_H                   , 0                                 , "RES  0, H") \
+	OP(CB, 0x85, RES_0_L                   , 0                                 , "RES  0, L") \
+	OP(CB, 0x86, RES_0_off_HL              , 0                                 , "RES  0, (HL)") \
+	OP(CB, 0x87, RES_0_A                   , 0                                 , "RES  0, A") \
+	OP(CB, 0x88, RES_1_B                   , 0                                 , "RES  1, B") \
+	OP(CB, 0x89, RES_1_C                   , 0                                 , "RES  1, C") \
+	OP(CB, 0x8a, RES_1_D                   , 0                                 , "RES  1, D") \
+	OP(CB, 0x8b, RES_1_E                   , 0                                 , "RES  1, E") \
+	OP(CB, 0x8c, RES_1_H                   , 0                                 , "RES  1, H") \
+	OP(CB, 0x8d, RES_1_L                   , 0                                 , "RES  1, L") \
+	OP(CB, 0x8e, RES_1_off_HL              , 0                                 , "RES  1, (HL)") \
+	OP(CB, 0x8f, RES_1_A                   , 0                                 , "RES  1, A") \
+	OP(CB, 0x90, RES_2_B                   , 0                                 , "RES  2, B") \
+	OP(CB, 0x91, RES_2_C                   , 0                                 , "RES  2, C") \
+	OP(CB, 0x92, RES_2_D                   , 0                                 , "RES  2, D") \
+	OP(CB, 0x93, RES_2_E                   , 0                                 , "RES  2, E") \
+	OP(CB, 0x94, RES_2_H                   , 0                                 , "RES  2, H") \
+	OP(CB, 0x95, RES_2_L                   , 0                                 , "RES  2, L") \
+	OP(CB, 0x96, RES_2_off_HL              , 0                                 , "RES  2, (HL)") \
+	OP(CB, 0x97, RES_2_A                   , 0                                 , "RES  2, A") \
+	OP(CB, 0x98, RES_3_B                   , 0                                 , "RES  3, B") \
+	OP(CB, 0x99, RES_3_C                   , 0                                 , "RES  3, C") \
+	OP(CB, 0x9a, RES_3_D                   , 0                                 , "RES  3, D") \
+	OP(CB, 0x9b, RES_3_E                   , 0                                 , "RES  3, E") \
+	OP(CB, 0x9c, RES_3_H                   , 0                                 , "RES  3, H") \
+	OP(CB, 0x9d, RES_3_L                   , 0                                 , "RES  3, L") \
+	OP(CB, 0x9e, RES_3_off_HL              , 0                                 , "RES  3, (HL)") \
+	OP(CB, 0x9f, RES_3_A                   , 0                                 , "RES  3, A") \
+	OP(CB, 0xa0, RES_4_B                   , 0                                 , "RES  4, B") \
+	OP(CB, 0xa1, RES_4_C                   , 0                                 , "RES  4, C") \
+	OP(CB, 0xa2, RES_4_D                   , 0                                 , "RES  4, D") \
+	OP(CB, 0xa3, RES_4_E                   , 0                                 , "RES  4, E") \
+	OP(CB, 0xa4, RES_4_H                   , 0                                 , "RES  4, H") \
+	OP(CB, 0xa5, RES_4_L                   , 0                                 , "RES  4, L") \
+	OP(CB, 0xa6, RES_4_off_HL              , 0                                 , "RES  4, (HL)") \
+	OP(CB, 0xa7, RES_4_A                   , 0                                 , "RES  4, A") \
+	OP(CB, 0xa8, RES_5_B                   , 0                                 , "RES  5, B") \
+	OP(CB, 0xa9, RES_5_C                   , 0                                 , "RES  5, C") \
+	OP(CB, 0xaa, RES_5_D                   , 0                                 , "RES  5, D") \
+	OP(CB, 0xab, RES_5_E                   , 0                                 , "RES  5, E") \
+	OP(CB, 0xac, RES_5_H                   , 0                                 , "RES  5, H") \
+	OP(CB, 0xad, RES_5_L                   , 0                                 , "RES  5, L") \
+	OP(CB, 0xae, RES_5_off_HL              , 0                                 , "RES  5, (HL)") \
+	OP(CB, 0xaf, RES_5_A                   , 0                                 , "RES  5, A") \
+	OP(CB, 0xb0, RES_6_B                   , 0                                 , "RES  6, B") \
+	OP(CB, 0xb1, RES_6_C                   , 0                                 , "RES  6, C") \
+	OP(CB, 0xb2, RES_6_D                   , 0                                 , "RES  6, D") \
+	OP(CB, 0xb3, RES_6_E                   , 0                                 , "RES  6, E") \
+	OP(CB, 0xb4, RES_6_H                   , 0                                 , "RES  6, H") \
+	OP(CB, 0xb5, RES_6_L                   , 0                                 , "RES  6, L") \
+	OP(CB, 0xb6, RES_6_off_HL              , 0                                 , "RES  6, (HL)") \
+	OP(CB, 0xb7, RES_6_A                   , 0                                 , "RES  6, A") \
+	OP(CB, 0xb8, RES_7_B                   , 0                                 , "RES  7, B") \
+	OP(CB, 0xb9, RES_7_C                   , 0                                 , "RES  7, C") \
+	OP(CB, 0xba, RES_7_D                   , 0                                 , "RES  7, D") \
+	OP(CB, 0xbb, RES_7_E                   , 0                                 , "RES  7, E") \
+	OP(CB, 0xbc, RES_7_H                   , 0                                 , "RES  7, H") \
+	OP(CB, 0xbd, RES_7_L                   , 0                                 , "RES  7, L") \
+	OP(CB, 0xbe, RES_7_off_HL              , 0                                 , "RES  7, (HL)") \
+	OP(CB, 0xbf, RES_7_A                   , 0                                 , "RES  7, A") \
+	OP(CB, 0xc0, SET_0_B                   , 0                                 , "SET  0, B") \
+	OP(CB, 0xc1, SET_0_C                   , 0                                 , "SET  0, C") \
+	OP(CB, 0xc2, SET_0_D                   , 0                                 , "SET  0, D") \
+	OP(CB, 0xc3, SET_0_E                   , 0                                 , "SET  0, E") \
+	OP(CB, 0xc4, SET_0_H                   , 0                                 , "SET  0, H") \
+	OP(CB, 0xc5, SET_0_L                   , 0                                 , "SET  0, L") \
+	OP(CB, 0xc6, SET_0_off_HL              , 0                                 , "SET  0, (HL)") \
+	OP(CB, 0xc7, SET_0_A                   , 0                                 , "SET  0, A") \
+	OP(CB, 0xc8, SET_1_B                   , 0                                 , "SET  1, B") \
+	OP(CB, 0xc9, SET_1_C                   , 0                                 , "SET  1, C") \
+	OP(CB, 0xca, SET_1_D                   , 0                                 , "SET  1, D") \
+	OP(CB, 0xcb, SET_1_E                   , 0                                 , "SET  1, E") \
+	OP(CB, 0xcc, SET_1_H                   , 0                                 , "SET  1, H") \
+	OP(CB, 0xcd, SET_1_L                   , 0                                 , "SET  1, L") \
+	OP(CB, 0xce, SET_1_off_HL              , 0                                 , "SET  1, (HL)") \
+	OP(CB, 0xcf, SET_1_A                   , 0                                 , "SET  1, A") \
+	OP(CB, 0xd0, SET_2_B                   , 0                                 , "SET  2, B") \
+	OP(CB, 0xd1, SET_2_C                   , 0                                 , "SET  2, C") \
+	OP(CB, 0xd2, SET_2_D                   , 0                                 , "SET  2, D") \
+	OP(CB, 0xd3, SET_2_E                   , 0                                 , "SET  2, E") \
+	OP(CB, 0xd4, SET_2_H                   , 0                                 , "SET  2, H") \
+	OP(CB, 0xd5, SET_2_L                   , 0                                 , "SET  2, L") \
+	OP(CB, 0xd6, SET_2_off_HL              , 0                                 , "SET  2, (HL)") \
+	OP(CB, 0xd7, SET_2_A                   , 0                                 , "SET  2, A") \
+	OP(CB, 0xd8, SET_3_B                   , 0                                 , "SET  3, B") \
+	OP(CB, 0xd9, SET_3_C                   , 0                                 , "SET  3, C") \
+	OP(CB, 0xda, SET_3_D                   , 0                                 , "SET  3, D") \
+	OP(CB, 0xdb, SET_3_E                   , 0                                 , "SET  3, E") \
+	OP(CB, 0xdc, SET_3_H                   , 0                                 , "SET  3, H") \
+	OP(CB, 0xdd, SET_3_L                   , 0                                 , "SET  3, L") \
+	OP(CB, 0xde, SET_3_off_HL              , 0                                 , "SET  3, (HL)") \
+	OP(CB, 0xdf, SET_3_A                   , 0                                 , "SET  3, A") \
+	OP(CB, 0xe0, SET_4_B                   , 0                                 , "SET  4, B") \
+	OP(CB, 0xe1, SET_4_C                   , 0                                 , "SET  4, C") \
+	OP(CB, 0xe2, SET_4_D                   , 0                                 , "SET  4, D") \
+	OP(CB, 0xe3, SET_4_E                   , 0                                 , "SET  4, E") \
+	OP(CB, 0xe4, SET_4_H                   , 0                                 , "SET  4, H") \
+	OP(CB, 0xe5, SET_4_L                   , 0                                 , "SET  4, L") \
+	OP(CB, 0xe6, SET_4_off_HL              , 0                                 , "SET  4, (HL)") \
+	OP(CB, 0xe7, SET_4_A                   , 0                                 , "SET  4, A") \
+	OP(CB, 0xe8, SET_5_B                   , 0                                 , "SET  5, B") \
+	OP(CB, 0xe9, SET_5_C                   , 0                                 , "SET  5, C") \
+	OP(CB, 0xea, SET_5_D                   , 0                                 , "SET  5, D") \
+	OP(CB, 0xeb, SET_5_E                   , 0                                 , "SET  5, E") \
+	OP(CB, 0xec, SET_5_H                   , 0                                 , "SET  5, H") \
+	OP(CB, 0xed, SET_5_L                   , 0                                 , "SET  5, L") \
+	OP(CB, 0xee, SET_5_off_HL              , 0                                 , "SET  5, (HL)") \
+	OP(CB, 0xef, SET_5_A                   , 0                                 , "SET  5, A") \
+	OP(CB, 0xf0, SET_6_B                   , 0                                 , "SET  6, B") \
+	OP(CB, 0xf1, SET_6_C                   , 0                                 , "SET  6, C") \
+	OP(CB, 0xf2, SET_6_D                   , 0                                 , "SET  6, D") \
+	OP(CB, 0xf3, SET_6_E                   , 0                                 , "SET  6, E") \
+	OP(CB, 0xf4, SET_6_H                   , 0                                 , "SET  6, H") \
+	OP(CB, 0xf5, SET_6_L                   , 0                                 , "SET  6, L") \
+	OP(CB, 0xf6, SET_6_off_HL              , 0                                 , "SET  6, (HL)") \
+	OP(CB, 0xf7, SET_6_A                   , 0                                 , "SET  6, A") \
+	OP(CB, 0xf8, SET_7_B                   , 0                                 , "SET  7, B") \
+	OP(CB, 0xf9, SET_7_C                   , 0                                 , "SET  7, C") \
+	OP(CB, 0xfa, SET_7_D                   , 0                                 , "SET  7, D") \
+	OP(CB, 0xfb, SET_7_E                   , 0                                 , "SET  7, E") \
+	OP(CB, 0xfc, SET_7_H                   , 0                                 , "SET  7, H") \
+	OP(CB, 0xfd, SET_7_L                   , 0                                 , "SET  7, L") \
+	OP(CB, 0xfe, SET_7_off_HL              , 0                                 , "SET  7, (HL)") \
+	OP(CB, 0xff, SET_7_A                   , 0                                 , "SET  7, A") \
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::ED_Opcodes = {
-{
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::IN_B_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   B, (C)"          },
-	{ &CZ80Core::OUT_off_C_B         , 0,										"OUT  (C), B"         },
-	{ &CZ80Core::SBC_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, BC"         },
-	{ &CZ80Core::LD_off_nn_BC        , 0,										"LD   (%W), BC"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::LD_I_A              , 0,										"LD   I, A"            },
-	{ &CZ80Core::IN_C_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   C, (C)"          },
-	{ &CZ80Core::OUT_off_C_C         , 0,										"OUT  (C), C"         },
-	{ &CZ80Core::ADC_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, BC"         },
-	{ &CZ80Core::LD_BC_off_nn        , 0,										"LD   BC, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETI                , 0,										"RETI"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::LD_R_A              , 0,										"LD   R, A"            },
-	{ &CZ80Core::IN_D_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   D, (C)"          },
-	{ &CZ80Core::OUT_off_C_D         , 0,										"OUT  (C), D"         },
-	{ &CZ80Core::SBC_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, DE"         },
-	{ &CZ80Core::LD_off_nn_DE        , 0,										"LD   (%W), DE"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_1                , 0,										"IM   1"              },
-	{ &CZ80Core::LD_A_I              , 0,										"LD   A, I"            },
-	{ &CZ80Core::IN_E_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   E, (C)"          },
-	{ &CZ80Core::OUT_off_C_E         , 0,										"OUT  (C), E"         },
-	{ &CZ80Core::ADC_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, DE"         },
-	{ &CZ80Core::LD_DE_off_nn        , 0,										"LD   DE, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_2                , 0,										"IM   2"              },
-	{ &CZ80Core::LD_A_R              , 0,										"LD   A, R"            },
-	{ &CZ80Core::IN_H_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   H, (C)"          },
-	{ &CZ80Core::OUT_off_C_H         , 0,										"OUT  (C), H"         },
-	{ &CZ80Core::SBC_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, HL"         },
-	{ &CZ80Core::LD_off_nn_HL        , 0,										"LD   (%W), HL"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::RRD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"RRD"               },
-	{ &CZ80Core::IN_L_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   L, (C)"          },
-	{ &CZ80Core::OUT_off_C_L         , 0,										"OUT  (C), L"         },
-	{ &CZ80Core::ADC_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, HL"         },
-	{ &CZ80Core::LD_HL_off_nn        , 0,										"LD   HL, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::RLD                  , CZ80Core::OPCODEFLAG_AltersFlags,		"RLD"               },
-	{ &CZ80Core::IN_F_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   F, (C)"          },
-	{ &CZ80Core::OUT_off_C_0         , 0,										"OUT  (C), 0"         },
-	{ &CZ80Core::SBC_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, SP"         },
-	{ &CZ80Core::LD_off_nn_SP        , 0,										"LD   (%W), SP"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_1                , 0,										"IM   1" },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::IN_A_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   A, (C)" },
-	{ &CZ80Core::OUT_off_C_A         , 0,										"OUT  (C), A" },
-	{ &CZ80Core::ADC_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, SP"         },
-	{ &CZ80Core::LD_SP_off_nn        , 0,										"LD   SP, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN" },
-	{ &CZ80Core::IM_2                , 0,										"IM   2" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"LDI"               },
-	{ &CZ80Core::CPI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"CPI"               },
-	{ &CZ80Core::INI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"INI"               },
-	{ &CZ80Core::OUTI                , CZ80Core::OPCODEFLAG_AltersFlags,		"OUTI"              },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LDD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"LDD"               },
-	{ &CZ80Core::CPD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"CPD"               },
-	{ &CZ80Core::IND                 , CZ80Core::OPCODEFLAG_AltersFlags,		"IND"               },
-	{ &CZ80Core::OUTD                , CZ80Core::OPCODEFLAG_AltersFlags,		"OUTD"              },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"LDIR"              },
-	{ &CZ80Core::CPIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"CPIR"              },
-	{ &CZ80Core::INIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"INIR"              },
-	{ &CZ80Core::OTIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"OTIR" },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"LDDR"              },
-	{ &CZ80Core::CPDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"CPDR"              },
-	{ &CZ80Core::INDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"INDR"              },
-	{ &CZ80Core::OTDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"OTDR"              },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                }
-} };
+// DD prefixed opcodes
+#define Z80CORE_OPCODES_DD(OP, NO) \
+	NO(DD, 0x00) \
+	NO(DD, 0x01) \
+	NO(DD, 0x02) \
+	NO(DD, 0x03) \
+	NO(DD, 0x04) \
+	NO(DD, 0x05) \
+	NO(DD, 0x06) \
+	NO(DD, 0x07) \
+	NO(DD, 0x08) \
+	OP(DD, 0x09, ADD_IX_BC                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IX, BC") \
+	NO(DD, 0x0a) \
+	NO(DD, 0x0b) \
+	NO(DD, 0x0c) \
+	NO(DD, 0x0d) \
+	NO(DD, 0x0e) \
+	NO(DD, 0x0f) \
+	NO(DD, 0x10) \
+	NO(DD, 0x11) \
+	NO(DD, 0x12) \
+	NO(DD, 0x13) \
+	NO(DD, 0x14) \
+	NO(DD, 0x15) \
+	NO(DD, 0x16) \
+	NO(DD, 0x17) \
+	NO(DD, 0x18) \
+	OP(DD, 0x19, ADD_IX_DE                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IX, DE") \
+	NO(DD, 0x1a) \
+	NO(DD, 0x1b) \
+	NO(DD, 0x1c) \
+	NO(DD, 0x1d) \
+	NO(DD, 0x1e) \
+	NO(DD, 0x1f) \
+	NO(DD, 0x20) \
+	OP(DD, 0x21, LD_IX_nn                  , 0                                 , "LD   IX, %W") \
+	OP(DD, 0x22, LD_off_nn_IX              , 0                                 , "LD   (%W), IX") \
+	OP(DD, 0x23, INC_IX                    , 0                                 , "INC IX") \
+	OP(DD, 0x24, INC_IXh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "INC IXh") \
+	OP(DD, 0x25, DEC_IXh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC IXh") \
+	OP(DD, 0x26, LD_IXh_n                  , 0                                 , "LD   IXh, %B") \
+	NO(DD, 0x27) \
+	NO(DD, 0x28) \
+	OP(DD, 0x29, ADD_IX_IX                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IX, IX") \
+	OP(DD, 0x2a, LD_IX_off_nn              , 0                                 , "LD   IX, (%W)") \
+	OP(DD, 0x2b, DEC_IX                    , 0                                 , "DEC IX") \
+	OP(DD, 0x2c, INC_IXl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "INC IXl") \
+	OP(DD, 0x2d, DEC_IXl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC IXl") \
+	OP(DD, 0x2e, LD_IXl_n                  , 0                                 , "LD   IXl, %B") \
+	NO(DD, 0x2f) \
+	NO(DD, 0x30) \
+	NO(DD, 0x31) \
+	NO(DD, 0x32) \
+	NO(DD, 0x33) \
+	OP(DD, 0x34, INC_off_IX_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "INC (IX + %O)") \
+	OP(DD, 0x35, DEC_off_IX_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC (IX + %O)") \
+	OP(DD, 0x36, LD_off_IX_d_n             , 0                                 , "LD   (IX + %O), %B") \
+	NO(DD, 0x37) \
+	NO(DD, 0x38) \
+	OP(DD, 0x39, ADD_IX_SP                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IX, SP") \
+	NO(DD, 0x3a) \
+	NO(DD, 0x3b) \
+	NO(DD, 0x3c) \
+	NO(DD, 0x3d) \
+	NO(DD, 0x3e) \
+	NO(DD, 0x3f) \
+	NO(DD, 0x40) \
+	NO(DD, 0x41) \
+	NO(DD, 0x42) \
+	NO(DD, 0x43) \
+	OP(DD, 0x44, LD_B_IXh                  , 0                                 , "LD   B, IXh") \
+	OP(DD, 0x45, LD_B_IXl                  , 0                                 , "LD   B, IXl") \
+	OP(DD, 0x46, LD_B_off_IX_d             , 0                                 , "LD   B, (IX + %O)") \
+	NO(DD, 0x47) \
+	NO(DD, 0x48) \
+	NO(DD, 0x49) \
+	NO(DD, 0x4a) \
+	NO(DD, 0x4b) \
+	OP(DD, 0x4c, LD_C_IXh                  , 0                                 , "LD   C, IXh") \
+	OP(DD, 0x4d, LD_C_IXl                  , 0                                 , "LD   C, IXl") \
+	OP(DD, 0x4e, LD_C_off_IX_d             , 0                                 , "LD   C, (IX + %O)") \
+	NO(DD, 0x4f) \
+	NO(DD, 0x50) \
+	NO(DD, 0x51) \
+	NO(DD, 0x52) \
+	NO(DD, 0x53) \
+	OP(DD, 0x54, LD_D_IXh                  , 0                                 , "LD   D, IXh") \
+	OP(DD, 0x55, LD_D_IXl                  , 0                                 , "LD   D, IXl") \
+	OP(DD, 0x56, LD_D_off_IX_d             , 0                                 , "LD   D, (IX + %O)") \
+	NO(DD, 0x57) \
+	NO(DD, 0x58) \
+	NO(DD, 0x59) \
+	NO(DD, 0x5a) \
+	NO(DD, 0x5b) \
+	OP(DD, 0x5c, LD_E_IXh                  , 0                                 , "LD   E, IXh") \
+	OP(DD, 0x5d, LD_E_IXl                  , 0                                 , "LD   E, IXl") \
+	OP(DD, 0x5e, LD_E_off_IX_d             , 0                                 , "LD   E, (IX + %O)") \
+	NO(DD, 0x5f) \
+	OP(DD, 0x60, LD_IXh_B                  , 0                                 , "LD   IXh, B") \
+	OP(DD, 0x61, LD_IXh_C                  , 0                                 , "LD   IXh, C") \
+	OP(DD, 0x62, LD_IXh_D                  , 0                                 , "LD   IXh, D") \
+	OP(DD, 0x63, LD_IXh_E                  , 0                                 , "LD   IXh, E") \
+	OP(DD, 0x64, LD_IXh_IXh                , 0                                 , "LD   IXh, IXh") \
+	OP(DD, 0x65, LD_IXh_IXl                , 0                                 , "LD   IXh, IXl") \
+	OP(DD, 0x66, LD_H_off_IX_d             , 0                                 , "LD   H, (IX + %O)") \
+	OP(DD, 0x67, LD_IXh_A                  , 0                                 , "LD   IXh, A") \
+	OP(DD, 0x68, LD_IXl_B                  , 0                                 , "LD   IXl, B") \
+	OP(DD, 0x69, LD_IXl_C                  , 0                                 , "LD   IXl, C") \
+	OP(DD, 0x6a, LD_IXl_D                  , 0                                 , "LD   IXl, D") \
+	OP(DD, 0x6b, LD_IXl_E                  , 0                                 , "LD   IXl, E") \
+	OP(DD, 0x6c, LD_IXl_IXh                , 0                                 , "LD   IXl, IXh") \
+	OP(DD, 0x6d, LD_IXl_IXl                , 0                                 , "LD   IXl, IXl") \
+	OP(DD, 0x6e, LD_L_off_IX_d             , 0                                 , "LD   L, IX + %O)") \
+	OP(DD, 0x6f, LD_IXl_A                  , 0                                 , "LD   IXl, A") \
+	OP(DD, 0x70, LD_off_IX_d_B             , 0                                 , "LD   (IX + %O), B") \
+	OP(DD, 0x71, LD_off_IX_d_C             , 0                                 , "LD   (IX + %O), C") \
+	OP(DD, 0x72, LD_off_IX_d_D             , 0                                 , "LD   (IX + %O), D") \
+	OP(DD, 0x73, LD_off_IX_d_E             , 0                                 , "LD   (IX + %O), E") \
+	OP(DD, 0x74, LD_off_IX_d_H             , 0                                 , "LD   (IX + %O), H") \
+	OP(DD, 0x75, LD_off_IX_d_L             , 0                                 , "LD   (IX + %O), L") \
+	NO(DD, 0x76) \
+	OP(DD, 0x77, LD_off_IX_d_A             , 0                                 , "LD   (IX + %O), A") \
+	NO(DD, 0x78) \
+	NO(DD, 0x79) \
+	NO(DD, 0x7a) \
+	NO(DD, 0x7b) \
+	OP(DD, 0x7c, LD_A_IXh                  , 0                                 , "LD   A, IXh") \
+	OP(DD, 0x7d, LD_A_IXl                  , 0                                 , "LD   A, IXl") \
+	OP(DD, 0x7e, LD_A_off_IX_d             , 0                                 , "LD   A, (IX + %O)") \
+	NO(DD, 0x7f) \
+	NO(DD, 0x80) \
+	NO(DD, 0x81) \
+	NO(DD, 0x82) \
+	NO(DD, 0x83) \
+	OP(DD, 0x84, ADD_A_IXh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD A, IXh") \
+	OP(DD, 0x85, ADD_A_IXl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD A, IXl") \
+	OP(DD, 0x86, ADD_A_off_IX_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD A, (IX + %O)") \
+	NO(DD, 0x87) \
+	NO(DD, 0x88) \
+	NO(DD, 0x89) \
+	NO(DD, 0x8a) \
+	NO(DD, 0x8b) \
+	OP(DD, 0x8c, ADC_A_IXh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC A, IXh") \
+	OP(DD, 0x8d, ADC_A_IXl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC A, IXl") \
+	OP(DD, 0x8e, ADC_A_off_IX_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC A, (IX + %O)") \
+	NO(DD, 0x8f) \
+	NO(DD, 0x90) \
+	NO(DD, 0x91) \
+	NO(DD, 0x92) \
+	NO(DD, 0x93) \
+	OP(DD, 0x94, SUB_A_IXh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB A, IXh") \
+	OP(DD, 0x95, SUB_A_IXl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB A, IXl") \
+	OP(DD, 0x96, SUB_A_off_IX_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB A, (IX + %O)") \
+	NO(DD, 0x97) \
+	NO(DD, 0x98) \
+	NO(DD, 0x99) \
+	NO(DD, 0x9a) \
+	NO(DD, 0x9b) \
+	OP(DD, 0x9c, SBC_A_IXh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC A, IXh") \
+	OP(DD, 0x9d, SBC_A_IXl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC A, IXl") \
+	OP(DD, 0x9e, SBC_A_off_IX_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC A, (IX + %O)") \
+	NO(DD, 0x9f) \
+	NO(DD, 0xa0) \
+	NO(DD, 0xa1) \
+	NO(DD, 0xa2) \
+	NO(DD, 0xa3) \
+	OP(DD, 0xa4, AND_IXh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "AND IXh") \
+	OP(DD, 0xa5, AND_IXl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "AND IXl") \
+	OP(DD, 0xa6, AND_off_IX_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "AND (IX + %O)") \
+	NO(DD, 0xa7) \
+	NO(DD, 0xa8) \
+	NO(DD, 0xa9) \
+	NO(DD, 0xaa) \
+	NO(DD, 0xab) \
+	OP(DD, 0xac, XOR_IXh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR IXh") \
+	OP(DD, 0xad, XOR_IXl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR IXl") \
+	OP(DD, 0xae, XOR_off_IX_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR (IX + %O)") \
+	NO(DD, 0xaf) \
+	NO(DD, 0xb0) \
+	NO(DD, 0xb1) \
+	NO(DD, 0xb2) \
+	NO(DD, 0xb3) \
+	OP(DD, 0xb4, OR_IXh                    , CZ80Core::OPCODEFLAG_AltersFlags  , "OR  IXh") \
+	OP(DD, 0xb5, OR_IXl                    , CZ80Core::OPCODEFLAG_AltersFlags  , "OR  IXl") \
+	OP(DD, 0xb6, OR_off_IX_d               , CZ80Core::OPCODEFLAG_AltersFlags  , "OR  (IX + %O)") \
+	NO(DD, 0xb7) \
+	NO(DD, 0xb8) \
+	NO(DD, 0xb9) \
+	NO(DD, 0xba) \
+	NO(DD, 0xbb) \
+	OP(DD, 0xbc, CP_IXh                    , CZ80Core::OPCODEFLAG_AltersFlags  , "CP  IXh") \
+	OP(DD, 0xbd, CP_IXl                    , CZ80Core::OPCODEFLAG_AltersFlags  , "CP  IXl") \
+	OP(DD, 0xbe, CP_off_IX_d               , CZ80Core::OPCODEFLAG_AltersFlags  , "CP  (IX + %O)") \
+	NO(DD, 0xbf) \
+	NO(DD, 0xc0) \
+	NO(DD, 0xc1) \
+	NO(DD, 0xc2) \
+	NO(DD, 0xc3) \
+	NO(DD, 0xc4) \
+	NO(DD, 0xc5) \
+	NO(DD, 0xc6) \
+	NO(DD, 0xc7) \
+	NO(DD, 0xc8) \
+	NO(DD, 0xc9) \
+	NO(DD, 0xca) \
+	NO(DD, 0xcb) \
+	NO(DD, 0xcc) \
+	NO(DD, 0xcd) \
+	NO(DD, 0xce) \
+	NO(DD, 0xcf) \
+	NO(DD, 0xd0) \
+	NO(DD, 0xd1) \
+	NO(DD, 0xd2) \
+	NO(DD, 0xd3) \
+	NO(DD, 0xd4) \
+	NO(DD, 0xd5) \
+	NO(DD, 0xd6) \
+	NO(DD, 0xd7) \
+	NO(DD, 0xd8) \
+	NO(DD, 0xd9) \
+	NO(DD, 0xda) \
+	NO(DD, 0xdb) \
+	NO(DD, 0xdc) \
+	NO(DD, 0xdd) \
+	NO(DD, 0xde) \
+	NO(DD, 0xdf) \
+	NO(DD, 0xe0) \
+	OP(DD, 0xe1, POP_IX                    , 0                                 , "POP  IX") \
+	NO(DD, 0xe2) \
+	OP(DD, 0xe3, EX_off_SP_IX              , 0                                 , "EX   (SP), IX") \
+	NO(DD, 0xe4) \
+	OP(DD, 0xe5, PUSH_IX                   , 0                                 , "PUSH  IX") \
+	NO(DD, 0xe6) \
+	NO(DD, 0xe7) \
+	NO(DD, 0xe8) \
+	OP(DD, 0xe9, JP_off_IX                 , 0                                 , "JP   (IX)") \
+	NO(DD, 0xea) \
+	NO(DD, 0xeb) \
+	NO(DD, 0xec) \
+	NO(DD, 0xed) \
+	NO(DD, 0xee) \
+	NO(DD, 0xef) \
+	NO(DD, 0xf0) \
+	NO(DD, 0xf1) \
+	NO(DD, 0xf2) \
+	NO(DD, 0xf3) \
+	NO(DD, 0xf4) \
+	NO(DD, 0xf5) \
+	NO(DD, 0xf6) \
+	NO(DD, 0xf7) \
+	NO(DD, 0xf8) \
+	OP(DD, 0xf9, LD_SP_IX                  , 0                                 , "LD   SP, IX") \
+	NO(DD, 0xfa) \
+	NO(DD, 0xfb) \
+	NO(DD, 0xfc) \
+	NO(DD, 0xfd) \
+	NO(DD, 0xfe) \
+	NO(DD, 0xff) \
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
-{
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, BC"			},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_DE      	 , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, DE"			},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::LD_IY_nn            , 0,										"LD   IY, %W"		},
-	{ &CZ80Core::LD_off_nn_IY        , 0,										"LD   (%W), IY"		},
-	{ &CZ80Core::INC_IY              , 0,										"INC IY"				},
-	{ &CZ80Core::INC_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IYh"			},
-	{ &CZ80Core::DEC_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IYh"			},
-	{ &CZ80Core::LD_IYh_n            , 0,										"LD   IYh, %B"		},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_IY           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY,IY"			},
-	{ &CZ80Core::LD_IY_off_nn        , 0,										"LD   IY, (%W)"		},
-	{ &CZ80Core::DEC_IY              , 0,										"DEC IY"				},
-	{ &CZ80Core::INC_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IYl"			},
-	{ &CZ80Core::DEC_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IYl"			},
-	{ &CZ80Core::LD_IYl_n            , 0,										"LD   IYl, %B"		},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-    { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::INC_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"INC (IY + %O)"	},
-	{ &CZ80Core::DEC_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC (IY + %O)"	},
-	{ &CZ80Core::LD_off_IY_d_n       , 0,										"LD   (IY + %O), %B"},
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IY_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, SP"         },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_B_IYh            , 0,										"LD   B, IYh"         },
-	{ &CZ80Core::LD_B_IYl            , 0,										"LD   B, IYl"         },
-	{ &CZ80Core::LD_B_off_IY_d       , 0,										"LD   B, (IY + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_C_IYh            , 0,										"LD   C, IYh"         },
-	{ &CZ80Core::LD_C_IYl            , 0,										"LD   C, IYl"         },
-	{ &CZ80Core::LD_C_off_IY_d       , 0,										"LD   C, (IY + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_D_IYh            , 0,										"LD   D, IYh"         },
-	{ &CZ80Core::LD_D_IYl            , 0,										"LD   D ,IYl"         },
-	{ &CZ80Core::LD_D_off_IY_d       , 0,										"LD   D, (IY + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_E_IYh            , 0,										"LD   E, IYh"         },
-	{ &CZ80Core::LD_E_IYl            , 0,										"LD   E, IYl"         },
-	{ &CZ80Core::LD_E_off_IY_d       , 0,										"LD   E, (IY + %O)" },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IYh_B            , 0,										"LD   IYh, B"         },
-	{ &CZ80Core::LD_IYh_C            , 0,										"LD   IYh, C"         },
-	{ &CZ80Core::LD_IYh_D            , 0,										"LD   IYh, D"         },
-	{ &CZ80Core::LD_IYh_E            , 0,										"LD   IYh, E"         },
-	{ &CZ80Core::LD_IYh_IYh          , 0,										"LD   IYh, IYh"       },
-	{ &CZ80Core::LD_IYh_IYl          , 0,										"LD   IYh, IYl"       },
-	{ &CZ80Core::LD_H_off_IY_d       , 0,										"LD   H, (IY + %O)" },
-	{ &CZ80Core::LD_IYh_A            , 0,										"LD   IYh, A"         },
-	{ &CZ80Core::LD_IYl_B            , 0,										"LD   IYl, B"         },
-	{ &CZ80Core::LD_IYl_C            , 0,										"LD   IYl, C"         },
-	{ &CZ80Core::LD_IYl_D            , 0,										"LD   IYl, D"         },
-	{ &CZ80Core::LD_IYl_E            , 0,										"LD   IYl, E"         },
-	{ &CZ80Core::LD_IYl_IYh          , 0,										"LD   IYl, IYh"       },
-	{ &CZ80Core::LD_IYl_IYl          , 0,										"LD   IYl, IYl"       },
-	{ &CZ80Core::LD_L_off_IY_d       , 0,										"LD   L, IY + %O)" },
-	{ &CZ80Core::LD_IYl_A            , 0,										"LD   IYl, A"         },
-	{ &CZ80Core::LD_off_IY_d_B       , 0,										"LD   (IY + %O), B" },
-	{ &CZ80Core::LD_off_IY_d_C       , 0,										"LD   (IY + %O), C" },
-	{ &CZ80Core::LD_off_IY_d_D       , 0,										"LD   (IY + %O), D" },
-	{ &CZ80Core::LD_off_IY_d_E       , 0,										"LD   (IY + %O), E" },
-	{ &CZ80Core::LD_off_IY_d_H       , 0,										"LD   (IY + %O), H" },
-	{ &CZ80Core::LD_off_IY_d_L       , 0,										"LD   (IY + %O), L" },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_off_IY_d_A       , 0,										"LD   (IY + %O), A" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_A_IYh            , 0,										"LD   A, IYh"         },
-	{ &CZ80Core::LD_A_IYl            , 0,										"LD   A, IYl"         },
-	{ &CZ80Core::LD_A_off_IY_d       , 0,										"LD   A, (IY + %O)" },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, IYh"        },
-	{ &CZ80Core::ADD_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, IYl"        },
-	{ &CZ80Core::ADD_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, (IY + %O)"},
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADC_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, IYh"        },
-	{ &CZ80Core::ADC_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, IYl"        },
-	{ &CZ80Core::ADC_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, (IY + %O)"},
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SUB_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,IYh"        },
-	{ &CZ80Core::SUB_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,IYl"        },
-	{ &CZ80Core::SUB_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,(IY + %O)"},
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SBC_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,IYh"        },
-	{ &CZ80Core::SBC_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,IYl"        },
-	{ &CZ80Core::SBC_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,(IY + %O)"},
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::AND_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  IYh"          },
-	{ &CZ80Core::AND_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  IYl"          },
-	{ &CZ80Core::AND_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  (IY + %O)"  },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::XOR_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  IYh"           },
-	{ &CZ80Core::XOR_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  IYl"           },
-	{ &CZ80Core::XOR_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  (IY + %O)"   },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::OR_IYh              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   IYh"            },
-	{ &CZ80Core::OR_IYl              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   IYl"            },
-	{ &CZ80Core::OR_off_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   (IY + %O)"    },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-    { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::CP_IYh              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   IYh"            },
-	{ &CZ80Core::CP_IYl              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   IYl"            },
-	{ &CZ80Core::CP_off_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   (IY + %O)"    },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::POP_IY              , 0,										"POP  IY"            },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::EX_off_SP_IY        , 0,										"EX   (SP), IY"        },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::PUSH_IY             , 0,										"PUSH IY"           },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::JP_off_IY           , 0,										"JP   (IY)"           },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_SP_IY            , 0,										"LD   SP, IY"          },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                },
-    { nullptr							 , 0,										nullptr                }
-} };
+// ED prefixed opcodes
+#define Z80CORE_OPCODES_ED(OP, NO) \
+	NO(ED, 0x00) \
+	NO(ED, 0x01) \
+	NO(ED, 0x02) \
+	NO(ED, 0x03) \
+	NO(ED, 0x04) \
+	NO(ED, 0x05) \
+	NO(ED, 0x06) \
+	NO(ED, 0x07) \
+	NO(ED, 0x08) \
+	NO(ED, 0x09) \
+	NO(ED, 0x0a) \
+	NO(ED, 0x0b) \
+	NO(ED, 0x0c) \
+	NO(ED, 0x0d) \
+	NO(ED, 0x0e) \
+	NO(ED, 0x0f) \
+	NO(ED, 0x10) \
+	NO(ED, 0x11) \
+	NO(ED, 0x12) \
+	NO(ED, 0x13) \
+	NO(ED, 0x14) \
+	NO(ED, 0x15) \
+	NO(ED, 0x16) \
+	NO(ED, 0x17) \
+	NO(ED, 0x18) \
+	NO(ED, 0x19) \
+	NO(ED, 0x1a) \
+	NO(ED, 0x1b) \
+	NO(ED, 0x1c) \
+	NO(ED, 0x1d) \
+	NO(ED, 0x1e) \
+	NO(ED, 0x1f) \
+	NO(ED, 0x20) \
+	NO(ED, 0x21) \
+	NO(ED, 0x22) \
+	NO(ED, 0x23) \
+	NO(ED, 0x24) \
+	NO(ED, 0x25) \
+	NO(ED, 0x26) \
+	NO(ED, 0x27) \
+	NO(ED, 0x28) \
+	NO(ED, 0x29) \
+	NO(ED, 0x2a) \
+	NO(ED, 0x2b) \
+	NO(ED, 0x2c) \
+	NO(ED, 0x2d) \
+	NO(ED, 0x2e) \
+	NO(ED, 0x2f) \
+	NO(ED, 0x30) \
+	NO(ED, 0x31) \
+	NO(ED, 0x32) \
+	NO(ED, 0x33) \
+	NO(ED, 0x34) \
+	NO(ED, 0x35) \
+	NO(ED, 0x36) \
+	NO(ED, 0x37) \
+	NO(ED, 0x38) \
+	NO(ED, 0x39) \
+	NO(ED, 0x3a) \
+	NO(ED, 0x3b) \
+	NO(ED, 0x3c) \
+	NO(ED, 0x3d) \
+	NO(ED, 0x3e) \
+	NO(ED, 0x3f) \
+	OP(ED, 0x40, IN_B_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   B, (C)") \
+	OP(ED, 0x41, OUT_off_C_B               , 0                                 , "OUT  (C), B") \
+	OP(ED, 0x42, SBC_HL_BC                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  HL, BC") \
+	OP(ED, 0x43, LD_off_nn_BC              , 0                                 , "LD   (%W), BC") \
+	OP(ED, 0x44, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x45, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x46, IM_0                      , 0                                 , "IM   0") \
+	OP(ED, 0x47, LD_I_A                    , 0                                 , "LD   I, A") \
+	OP(ED, 0x48, IN_C_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   C, (C)") \
+	OP(ED, 0x49, OUT_off_C_C               , 0                                 , "OUT  (C), C") \
+	OP(ED, 0x4a, ADC_HL_BC                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  HL, BC") \
+	OP(ED, 0x4b, LD_BC_off_nn              , 0                                 , "LD   BC, (%W)") \
+	OP(ED, 0x4c, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x4d, RETI                      , 0                                 , "RETI") \
+	OP(ED, 0x4e, IM_0                      , 0                                 , "IM   0") \
+	OP(ED, 0x4f, LD_R_A                    , 0                                 , "LD   R, A") \
+	OP(ED, 0x50, IN_D_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   D, (C)") \
+	OP(ED, 0x51, OUT_off_C_D               , 0                                 , "OUT  (C), D") \
+	OP(ED, 0x52, SBC_HL_DE                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  HL, DE") \
+	OP(ED, 0x53, LD_off_nn_DE              , 0                                 , "LD   (%W), DE") \
+	OP(ED, 0x54, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x55, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x56, IM_1                      , 0                                 , "IM   1") \
+	OP(ED, 0x57, LD_A_I                    , 0                                 , "LD   A, I") \
+	OP(ED, 0x58, IN_E_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   E, (C)") \
+	OP(ED, 0x59, OUT_off_C_E               , 0                                 , "OUT  (C), E") \
+	OP(ED, 0x5a, ADC_HL_DE                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  HL, DE") \
+	OP(ED, 0x5b, LD_DE_off_nn              , 0                                 , "LD   DE, (%W)") \
+	OP(ED, 0x5c, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x5d, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x5e, IM_2                      , 0                                 , "IM   2") \
+	OP(ED, 0x5f, LD_A_R                    , 0                                 , "LD   A, R") \
+	OP(ED, 0x60, IN_H_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   H, (C)") \
+	OP(ED, 0x61, OUT_off_C_H               , 0                                 , "OUT  (C), H") \
+	OP(ED, 0x62, SBC_HL_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  HL, HL") \
+	OP(ED, 0x63, LD_off_nn_HL              , 0                                 , "LD   (%W), HL") \
+	OP(ED, 0x64, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x65, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x66, IM_0                      , 0                                 , "IM   0") \
+	OP(ED, 0x67, RRD                       , CZ80Core::OPCODEFLAG_AltersFlags  , "RRD") \
+	OP(ED, 0x68, IN_L_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   L, (C)") \
+	OP(ED, 0x69, OUT_off_C_L               , 0                                 , "OUT  (C), L") \
+	OP(ED, 0x6a, ADC_HL_HL                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  HL, HL") \
+	OP(ED, 0x6b, LD_HL_off_nn              , 0                                 , "LD   HL, (%W)") \
+	OP(ED, 0x6c, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x6d, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x6e, IM_0                      , 0                                 , "IM   0") \
+	OP(ED, 0x6f, RLD                       , CZ80Core::OPCODEFLAG_AltersFlags  , "RLD") \
+	OP(ED, 0x70, IN_F_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   F, (C)") \
+	OP(ED, 0x71, OUT_off_C_0               , 0                                 , "OUT  (C), 0") \
+	OP(ED, 0x72, SBC_HL_SP                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  HL, SP") \
+	OP(ED, 0x73, LD_off_nn_SP              , 0                                 , "LD   (%W), SP") \
+	OP(ED, 0x74, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x75, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x76, IM_1                      , 0                                 , "IM   1") \
+	NO(ED, 0x77) \
+	OP(ED, 0x78, IN_A_off_C                , CZ80Core::OPCODEFLAG_AltersFlags  , "IN   A, (C)") \
+	OP(ED, 0x79, OUT_off_C_A               , 0                                 , "OUT  (C), A") \
+	OP(ED, 0x7a, ADC_HL_SP                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  HL, SP") \
+	OP(ED, 0x7b, LD_SP_off_nn              , 0                                 , "LD   SP, (%W)") \
+	OP(ED, 0x7c, NEG                       , CZ80Core::OPCODEFLAG_AltersFlags  , "NEG") \
+	OP(ED, 0x7d, RETN                      , 0                                 , "RETN") \
+	OP(ED, 0x7e, IM_2                      , 0                                 , "IM   2") \
+	NO(ED, 0x7f) \
+	NO(ED, 0x80) \
+	NO(ED, 0x81) \
+	NO(ED, 0x82) \
+	NO(ED, 0x83) \
+	NO(ED, 0x84) \
+	NO(ED, 0x85) \
+	NO(ED, 0x86) \
+	NO(ED, 0x87) \
+	NO(ED, 0x88) \
+	NO(ED, 0x89) \
+	NO(ED, 0x8a) \
+	NO(ED, 0x8b) \
+	NO(ED, 0x8c) \
+	NO(ED, 0x8d) \
+	NO(ED, 0x8e) \
+	NO(ED, 0x8f) \
+	NO(ED, 0x90) \
+	NO(ED, 0x91) \
+	NO(ED, 0x92) \
+	NO(ED, 0x93) \
+	NO(ED, 0x94) \
+	NO(ED, 0x95) \
+	NO(ED, 0x96) \
+	NO(ED, 0x97) \
+	NO(ED, 0x98) \
+	NO(ED, 0x99) \
+	NO(ED, 0x9a) \
+	NO(ED, 0x9b) \
+	NO(ED, 0x9c) \
+	NO(ED, 0x9d) \
+	NO(ED, 0x9e) \
+	NO(ED, 0x9f) \
+	OP(ED, 0xa0, LDI                       , CZ80Core::OPCODEFLAG_AltersFlags  , "LDI") \
+	OP(ED, 0xa1, CPI                       , CZ80Core::OPCODEFLAG_AltersFlags  , "CPI") \
+	OP(ED, 0xa2, INI                       , CZ80Core::OPCODEFLAG_AltersFlags  , "INI") \
+	OP(ED, 0xa3, OUTI                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OUTI") \
+	NO(ED, 0xa4) \
+	NO(ED, 0xa5) \
+	NO(ED, 0xa6) \
+	NO(ED, 0xa7) \
+	OP(ED, 0xa8, LDD                       , CZ80Core::OPCODEFLAG_AltersFlags  , "LDD") \
+	OP(ED, 0xa9, CPD                       , CZ80Core::OPCODEFLAG_AltersFlags  , "CPD") \
+	OP(ED, 0xaa, IND                       , CZ80Core::OPCODEFLAG_AltersFlags  , "IND") \
+	OP(ED, 0xab, OUTD                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OUTD") \
+	NO(ED, 0xac) \
+	NO(ED, 0xad) \
+	NO(ED, 0xae) \
+	NO(ED, 0xaf) \
+	OP(ED, 0xb0, LDIR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "LDIR") \
+	OP(ED, 0xb1, CPIR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CPIR") \
+	OP(ED, 0xb2, INIR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "INIR") \
+	OP(ED, 0xb3, OTIR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OTIR") \
+	NO(ED, 0xb4) \
+	NO(ED, 0xb5) \
+	NO(ED, 0xb6) \
+	NO(ED, 0xb7) \
+	OP(ED, 0xb8, LDDR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "LDDR") \
+	OP(ED, 0xb9, CPDR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "CPDR") \
+	OP(ED, 0xba, INDR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "INDR") \
+	OP(ED, 0xbb, OTDR                      , CZ80Core::OPCODEFLAG_AltersFlags  , "OTDR") \
+	NO(ED, 0xbc) \
+	NO(ED, 0xbd) \
+	NO(ED, 0xbe) \
+	NO(ED, 0xbf) \
+	NO(ED, 0xc0) \
+	NO(ED, 0xc1) \
+	NO(ED, 0xc2) \
+	NO(ED, 0xc3) \
+	NO(ED, 0xc4) \
+	NO(ED, 0xc5) \
+	NO(ED, 0xc6) \
+	NO(ED, 0xc7) \
+	NO(ED, 0xc8) \
+	NO(ED, 0xc9) \
+	NO(ED, 0xca) \
+	NO(ED, 0xcb) \
+	NO(ED, 0xcc) \
+	NO(ED, 0xcd) \
+	NO(ED, 0xce) \
+	NO(ED, 0xcf) \
+	NO(ED, 0xd0) \
+	NO(ED, 0xd1) \
+	NO(ED, 0xd2) \
+	NO(ED, 0xd3) \
+	NO(ED, 0xd4) \
+	NO(ED, 0xd5) \
+	NO(ED, 0xd6) \
+	NO(ED, 0xd7) \
+	NO(ED, 0xd8) \
+	NO(ED, 0xd9) \
+	NO(ED, 0xda) \
+	NO(ED, 0xdb) \
+	NO(ED, 0xdc) \
+	NO(ED, 0xdd) \
+	NO(ED, 0xde) \
+	NO(ED, 0xdf) \
+	NO(ED, 0xe0) \
+	NO(ED, 0xe1) \
+	NO(ED, 0xe2) \
+	NO(ED, 0xe3) \
+	NO(ED, 0xe4) \
+	NO(ED, 0xe5) \
+	NO(ED, 0xe6) \
+	NO(ED, 0xe7) \
+	NO(ED, 0xe8) \
+	NO(ED, 0xe9) \
+	NO(ED, 0xea) \
+	NO(ED, 0xeb) \
+	NO(ED, 0xec) \
+	NO(ED, 0xed) \
+	NO(ED, 0xee) \
+	NO(ED, 0xef) \
+	NO(ED, 0xf0) \
+	NO(ED, 0xf1) \
+	NO(ED, 0xf2) \
+	NO(ED, 0xf3) \
+	NO(ED, 0xf4) \
+	NO(ED, 0xf5) \
+	NO(ED, 0xf6) \
+	NO(ED, 0xf7) \
+	NO(ED, 0xf8) \
+	NO(ED, 0xf9) \
+	NO(ED, 0xfa) \
+	NO(ED, 0xfb) \
+	NO(ED, 0xfc) \
+	NO(ED, 0xfd) \
+	NO(ED, 0xfe) \
+	NO(ED, 0xff) \
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::DDCB_Opcodes = {
-{
-	{ &CZ80Core::LD_B_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RLC (IX + %O)" },
-	{ &CZ80Core::LD_C_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RLC (IX + %O)" },
-	{ &CZ80Core::LD_D_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RLC (IX + %O)" },
-	{ &CZ80Core::LD_E_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RLC (IX + %O)" },
-	{ &CZ80Core::LD_H_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RLC (IX + %O)" },
-	{ &CZ80Core::LD_L_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RLC (IX + %O)" },
-	{ &CZ80Core::RLC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  (IX + %O)" },
-	{ &CZ80Core::LD_A_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RLC (IX + %O)" },
-	{ &CZ80Core::LD_B_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_C_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_D_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_E_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_H_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_L_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RRC  (IX + %O)" },
-	{ &CZ80Core::RRC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  (IX + %O)" },
-	{ &CZ80Core::LD_A_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_B_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RL (IX + %O)" },
-	{ &CZ80Core::LD_C_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RL (IX + %O)" },
-	{ &CZ80Core::LD_D_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RL (IX + %O)" },
-	{ &CZ80Core::LD_E_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RL (IX + %O)" },
-	{ &CZ80Core::LD_H_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RL (IX + %O)" },
-	{ &CZ80Core::LD_L_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RL (IX + %O)" },
-	{ &CZ80Core::RL_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   (IX + %O)" },
-	{ &CZ80Core::LD_A_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RL (IX + %O)" },
-	{ &CZ80Core::LD_B_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RR (IX + %O)" },
-	{ &CZ80Core::LD_C_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RR (IX + %O)" },
-	{ &CZ80Core::LD_D_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RR (IX + %O)" },
-	{ &CZ80Core::LD_E_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RR (IX + %O)" },
-	{ &CZ80Core::LD_H_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RR (IX + %O)" },
-	{ &CZ80Core::LD_L_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RR (IX + %O)" },
-	{ &CZ80Core::RR_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   (IX + %O)" },
-	{ &CZ80Core::LD_A_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RR (IX + %O)" },
-	{ &CZ80Core::LD_B_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SLA (IX + %O)" },
-	{ &CZ80Core::LD_C_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SLA (IX + %O)" },
-	{ &CZ80Core::LD_D_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SLA (IX + %O)" },
-	{ &CZ80Core::LD_E_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SLA (IX + %O)" },
-	{ &CZ80Core::LD_H_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SLA (IX + %O)" },
-	{ &CZ80Core::LD_L_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SLA (IX + %O)" },
-	{ &CZ80Core::SLA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  (IX + %O)" },
-	{ &CZ80Core::LD_A_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SLA (IX + %O)" },
-	{ &CZ80Core::LD_B_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SRA (IX + %O)" },
-	{ &CZ80Core::LD_C_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SRA (IX + %O)" },
-	{ &CZ80Core::LD_D_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SRA (IX + %O)" },
-	{ &CZ80Core::LD_E_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SRA (IX + %O)" },
-	{ &CZ80Core::LD_H_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SRA (IX + %O)" },
-	{ &CZ80Core::LD_L_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SRA (IX + %O)" },
-	{ &CZ80Core::SRA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  (IX + %O)" },
-	{ &CZ80Core::LD_A_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SRA (IX + %O)" },
-	{ &CZ80Core::LD_B_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_C_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_D_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_E_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_H_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_L_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SLL  (IX + %O)" },
-	{ &CZ80Core::SLL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  (IX + %O)" },
-	{ &CZ80Core::LD_A_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_B_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SRL (IX + %O)" },
-	{ &CZ80Core::LD_C_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SRL (IX + %O)" },
-	{ &CZ80Core::LD_D_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SRL (IX + %O)" },
-	{ &CZ80Core::LD_E_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SRL (IX + %O)" },
-	{ &CZ80Core::LD_H_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SRL (IX + %O)" },
-	{ &CZ80Core::LD_L_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SRL (IX + %O)" },
-	{ &CZ80Core::SRL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  (IX + %O)" },
-	{ &CZ80Core::LD_A_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A,SRL (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_0_off_IX_IY_d , 0,									"LD   B, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_0_off_IX_IY_d , 0,									"LD   C, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_0_off_IX_IY_d , 0,									"LD   D, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_0_off_IX_IY_d , 0,									"LD   E, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_0_off_IX_IY_d , 0,									"LD   H, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_0_off_IX_IY_d , 0,									"LD   L, RES  0, (IX + %O)" },
-	{ &CZ80Core::RES_0_off_IX_IY_d      , 0,									"RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_0_off_IX_IY_d , 0,									"LD   A, RES 0, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_1_off_IX_IY_d , 0,									"LD   B, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_1_off_IX_IY_d , 0,									"LD   C, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_1_off_IX_IY_d , 0,									"LD   D, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_1_off_IX_IY_d , 0,									"LD   E, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_1_off_IX_IY_d , 0,									"LD   H, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_1_off_IX_IY_d , 0,									"LD   L, RES  1, (IX + %O)" },
-	{ &CZ80Core::RES_1_off_IX_IY_d      , 0,									"RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_1_off_IX_IY_d , 0,									"LD   A, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_2_off_IX_IY_d , 0,									"LD   B, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_2_off_IX_IY_d , 0,									"LD   C, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_2_off_IX_IY_d , 0,									"LD   D, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_2_off_IX_IY_d , 0,									"LD   E, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_2_off_IX_IY_d , 0,									"LD   H, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_2_off_IX_IY_d , 0,									"LD   L, RES  2, (IX + %O)" },
-	{ &CZ80Core::RES_2_off_IX_IY_d      , 0,									"RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_2_off_IX_IY_d , 0,									"LD   A, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_3_off_IX_IY_d , 0,									"LD   B, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_3_off_IX_IY_d , 0,									"LD   C, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_3_off_IX_IY_d , 0,									"LD   D, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_3_off_IX_IY_d , 0,									"LD   E, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_3_off_IX_IY_d , 0,									"LD   H, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_3_off_IX_IY_d , 0,									"LD   L, RES  3, (IX + %O)" },
-	{ &CZ80Core::RES_3_off_IX_IY_d      , 0,									"RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_3_off_IX_IY_d , 0,									"LD   A, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_4_off_IX_IY_d , 0,									"LD   B, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_4_off_IX_IY_d , 0,									"LD   C, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_4_off_IX_IY_d , 0,									"LD   D, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_4_off_IX_IY_d , 0,									"LD   E, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_4_off_IX_IY_d , 0,									"LD   H, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_4_off_IX_IY_d , 0,									"LD   L, RES  4, (IX + %O)" },
-	{ &CZ80Core::RES_4_off_IX_IY_d      , 0,									"RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_4_off_IX_IY_d , 0,									"LD   A, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_5_off_IX_IY_d , 0,									"LD   B, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_5_off_IX_IY_d , 0,									"LD   C, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_5_off_IX_IY_d , 0,									"LD   D, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_5_off_IX_IY_d , 0,									"LD   E, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_5_off_IX_IY_d , 0,									"LD   H, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_5_off_IX_IY_d , 0,									"LD   L, RES 5, (IX + %O)" },
-	{ &CZ80Core::RES_5_off_IX_IY_d      , 0,									"RES  5, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_5_off_IX_IY_d , 0,									"LD   A, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_6_off_IX_IY_d , 0,									"LD   B, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_6_off_IX_IY_d , 0,									"LD   C, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_6_off_IX_IY_d , 0,									"LD   D, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_6_off_IX_IY_d , 0,									"LD   E, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_6_off_IX_IY_d , 0,									"LD   H, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_6_off_IX_IY_d , 0,									"LD   L, RES 6, (IX + %O)" },
-	{ &CZ80Core::RES_6_off_IX_IY_d      , 0,									"RES  6, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_6_off_IX_IY_d , 0,									"LD   A, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_7_off_IX_IY_d , 0,									"LD   B, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_7_off_IX_IY_d , 0,									"LD   C, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_7_off_IX_IY_d , 0,									"LD   D, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_7_off_IX_IY_d , 0,									"LD   E, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_7_off_IX_IY_d , 0,									"LD   H, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_7_off_IX_IY_d , 0,									"LD   L, RES 7, (IX + %O)" },
-	{ &CZ80Core::RES_7_off_IX_IY_d      , 0,									"RES  7, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_7_off_IX_IY_d , 0,									"LD   A, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_0_off_IX_IY_d , 0,									"LD   B, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_0_off_IX_IY_d , 0,									"LD   C, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_0_off_IX_IY_d , 0,									"LD   D, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_0_off_IX_IY_d , 0,									"LD   E, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_0_off_IX_IY_d , 0,									"LD   H, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_0_off_IX_IY_d , 0,									"LD   L, SET 0, (IX + %O)" },
-	{ &CZ80Core::SET_0_off_IX_IY_d      , 0,									"SET  0, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_0_off_IX_IY_d , 0,									"LD   A, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_1_off_IX_IY_d , 0,									"LD   B, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_1_off_IX_IY_d , 0,									"LD   C, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_1_off_IX_IY_d , 0,									"LD   D, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_1_off_IX_IY_d , 0,									"LD   E, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_1_off_IX_IY_d , 0,									"LD   H, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_1_off_IX_IY_d , 0,									"LD   L, SET 1, (IX + %O)" },
-	{ &CZ80Core::SET_1_off_IX_IY_d      , 0,									"SET  1, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_1_off_IX_IY_d , 0,									"LD   A, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_2_off_IX_IY_d , 0,									"LD   B, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_2_off_IX_IY_d , 0,									"LD   C, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_2_off_IX_IY_d , 0,									"LD   D, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_2_off_IX_IY_d , 0,									"LD   E, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_2_off_IX_IY_d , 0,									"LD   H, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_2_off_IX_IY_d , 0,									"LD   L, SET 2, (IX + %O)" },
-	{ &CZ80Core::SET_2_off_IX_IY_d      , 0,									"SET  2, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_2_off_IX_IY_d , 0,									"LD   A, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_3_off_IX_IY_d , 0,									"LD   B, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_3_off_IX_IY_d , 0,									"LD   C, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_3_off_IX_IY_d , 0,									"LD   D, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_3_off_IX_IY_d , 0,									"LD   E, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_3_off_IX_IY_d , 0,									"LD   H, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_3_off_IX_IY_d , 0,									"LD   L, SET 3, (IX + %O)" },
-	{ &CZ80Core::SET_3_off_IX_IY_d      , 0,									"SET  3, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_3_off_IX_IY_d , 0,									"LD   A, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_4_off_IX_IY_d , 0,									"LD   B, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_4_off_IX_IY_d , 0,									"LD   C, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_4_off_IX_IY_d , 0,									"LD   D, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_4_off_IX_IY_d , 0,									"LD   E, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_4_off_IX_IY_d , 0,									"LD   H, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_4_off_IX_IY_d , 0,									"LD   L, SET 4, (IX + %O)" },
-	{ &CZ80Core::SET_4_off_IX_IY_d      , 0,									"SET  4, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_4_off_IX_IY_d , 0,									"LD   A, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_5_off_IX_IY_d , 0,									"LD   B, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_5_off_IX_IY_d , 0,									"LD   C, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_5_off_IX_IY_d , 0,									"LD   D, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_5_off_IX_IY_d , 0,									"LD   E, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_5_off_IX_IY_d , 0,									"LD   H, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_5_off_IX_IY_d , 0,									"LD   L, SET 5, (IX + %O)" },
-	{ &CZ80Core::SET_5_off_IX_IY_d      , 0,									"SET  5, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_5_off_IX_IY_d , 0,									"LD   A, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_6_off_IX_IY_d , 0,									"LD   B, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_6_off_IX_IY_d , 0,									"LD   C, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_6_off_IX_IY_d , 0,									"LD   D, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_6_off_IX_IY_d , 0,									"LD   E, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_6_off_IX_IY_d , 0,									"LD   H, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_6_off_IX_IY_d , 0,									"LD   L, SET 6, (IX + %O)" },
-	{ &CZ80Core::SET_6_off_IX_IY_d      , 0,									"SET  6, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_6_off_IX_IY_d , 0,									"LD   A, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_7_off_IX_IY_d , 0,									"LD   B, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_7_off_IX_IY_d , 0,									"LD   C, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_7_off_IX_IY_d , 0,									"LD   D, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_7_off_IX_IY_d , 0,									"LD   E, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_7_off_IX_IY_d , 0,									"LD   H, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_7_off_IX_IY_d , 0,									"LD   L, SET 7, (IX + %O)" },
-	{ &CZ80Core::SET_7_off_IX_IY_d      , 0,									"SET  7, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_7_off_IX_IY_d , 0,									"LD   A, SET 7, (IX + %O)" }
-}};
+// FD prefixed opcodes
+#define Z80CORE_OPCODES_FD(OP, NO) \
+	NO(FD, 0x00) \
+	NO(FD, 0x01) \
+	NO(FD, 0x02) \
+	NO(FD, 0x03) \
+	NO(FD, 0x04) \
+	NO(FD, 0x05) \
+	NO(FD, 0x06) \
+	NO(FD, 0x07) \
+	NO(FD, 0x08) \
+	OP(FD, 0x09, ADD_IY_BC                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IY, BC") \
+	NO(FD, 0x0a) \
+	NO(FD, 0x0b) \
+	NO(FD, 0x0c) \
+	NO(FD, 0x0d) \
+	NO(FD, 0x0e) \
+	NO(FD, 0x0f) \
+	NO(FD, 0x10) \
+	NO(FD, 0x11) \
+	NO(FD, 0x12) \
+	NO(FD, 0x13) \
+	NO(FD, 0x14) \
+	NO(FD, 0x15) \
+	NO(FD, 0x16) \
+	NO(FD, 0x17) \
+	NO(FD, 0x18) \
+	OP(FD, 0x19, ADD_IY_DE                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IY, DE") \
+	NO(FD, 0x1a) \
+	NO(FD, 0x1b) \
+	NO(FD, 0x1c) \
+	NO(FD, 0x1d) \
+	NO(FD, 0x1e) \
+	NO(FD, 0x1f) \
+	NO(FD, 0x20) \
+	OP(FD, 0x21, LD_IY_nn                  , 0                                 , "LD   IY, %W") \
+	OP(FD, 0x22, LD_off_nn_IY              , 0                                 , "LD   (%W), IY") \
+	OP(FD, 0x23, INC_IY                    , 0                                 , "INC IY") \
+	OP(FD, 0x24, INC_IYh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "INC IYh") \
+	OP(FD, 0x25, DEC_IYh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC IYh") \
+	OP(FD, 0x26, LD_IYh_n                  , 0                                 , "LD   IYh, %B") \
+	NO(FD, 0x27) \
+	NO(FD, 0x28) \
+	OP(FD, 0x29, ADD_IY_IY                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IY,IY") \
+	OP(FD, 0x2a, LD_IY_off_nn              , 0                                 , "LD   IY, (%W)") \
+	OP(FD, 0x2b, DEC_IY                    , 0                                 , "DEC IY") \
+	OP(FD, 0x2c, INC_IYl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "INC IYl") \
+	OP(FD, 0x2d, DEC_IYl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC IYl") \
+	OP(FD, 0x2e, LD_IYl_n                  , 0                                 , "LD   IYl, %B") \
+	NO(FD, 0x2f) \
+	NO(FD, 0x30) \
+	NO(FD, 0x31) \
+	NO(FD, 0x32) \
+	NO(FD, 0x33) \
+	OP(FD, 0x34, INC_off_IY_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "INC (IY + %O)") \
+	OP(FD, 0x35, DEC_off_IY_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "DEC (IY + %O)") \
+	OP(FD, 0x36, LD_off_IY_d_n             , 0                                 , "LD   (IY + %O), %B") \
+	NO(FD, 0x37) \
+	NO(FD, 0x38) \
+	OP(FD, 0x39, ADD_IY_SP                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD IY, SP") \
+	NO(FD, 0x3a) \
+	NO(FD, 0x3b) \
+	NO(FD, 0x3c) \
+	NO(FD, 0x3d) \
+	NO(FD, 0x3e) \
+	NO(FD, 0x3f) \
+	NO(FD, 0x40) \
+	NO(FD, 0x41) \
+	NO(FD, 0x42) \
+	NO(FD, 0x43) \
+	OP(FD, 0x44, LD_B_IYh                  , 0                                 , "LD   B, IYh") \
+	OP(FD, 0x45, LD_B_IYl                  , 0                                 , "LD   B, IYl") \
+	OP(FD, 0x46, LD_B_off_IY_d             , 0                                 , "LD   B, (IY + %O)") \
+	NO(FD, 0x47) \
+	NO(FD, 0x48) \
+	NO(FD, 0x49) \
+	NO(FD, 0x4a) \
+	NO(FD, 0x4b) \
+	OP(FD, 0x4c, LD_C_IYh                  , 0                                 , "LD   C, IYh") \
+	OP(FD, 0x4d, LD_C_IYl                  , 0                                 , "LD   C, IYl") \
+	OP(FD, 0x4e, LD_C_off_IY_d             , 0                                 , "LD   C, (IY + %O)") \
+	NO(FD, 0x4f) \
+	NO(FD, 0x50) \
+	NO(FD, 0x51) \
+	NO(FD, 0x52) \
+	NO(FD, 0x53) \
+	OP(FD, 0x54, LD_D_IYh                  , 0                                 , "LD   D, IYh") \
+	OP(FD, 0x55, LD_D_IYl                  , 0                                 , "LD   D ,IYl") \
+	OP(FD, 0x56, LD_D_off_IY_d             , 0                                 , "LD   D, (IY + %O)") \
+	NO(FD, 0x57) \
+	NO(FD, 0x58) \
+	NO(FD, 0x59) \
+	NO(FD, 0x5a) \
+	NO(FD, 0x5b) \
+	OP(FD, 0x5c, LD_E_IYh                  , 0                                 , "LD   E, IYh") \
+	OP(FD, 0x5d, LD_E_IYl                  , 0                                 , "LD   E, IYl") \
+	OP(FD, 0x5e, LD_E_off_IY_d             , 0                                 , "LD   E, (IY + %O)") \
+	NO(FD, 0x5f) \
+	OP(FD, 0x60, LD_IYh_B                  , 0                                 , "LD   IYh, B") \
+	OP(FD, 0x61, LD_IYh_C                  , 0                                 , "LD   IYh, C") \
+	OP(FD, 0x62, LD_IYh_D                  , 0                                 , "LD   IYh, D") \
+	OP(FD, 0x63, LD_IYh_E                  , 0                                 , "LD   IYh, E") \
+	OP(FD, 0x64, LD_IYh_IYh                , 0                                 , "LD   IYh, IYh") \
+	OP(FD, 0x65, LD_IYh_IYl                , 0                                 , "LD   IYh, IYl") \
+	OP(FD, 0x66, LD_H_off_IY_d             , 0                                 , "LD   H, (IY + %O)") \
+	OP(FD, 0x67, LD_IYh_A                  , 0                                 , "LD   IYh, A") \
+	OP(FD, 0x68, LD_IYl_B                  , 0                                 , "LD   IYl, B") \
+	OP(FD, 0x69, LD_IYl_C                  , 0                                 , "LD   IYl, C") \
+	OP(FD, 0x6a, LD_IYl_D                  , 0                                 , "LD   IYl, D") \
+	OP(FD, 0x6b, LD_IYl_E                  , 0                                 , "LD   IYl, E") \
+	OP(FD, 0x6c, LD_IYl_IYh                , 0                                 , "LD   IYl, IYh") \
+	OP(FD, 0x6d, LD_IYl_IYl                , 0                                 , "LD   IYl, IYl") \
+	OP(FD, 0x6e, LD_L_off_IY_d             , 0                                 , "LD   L, IY + %O)") \
+	OP(FD, 0x6f, LD_IYl_A                  , 0                                 , "LD   IYl, A") \
+	OP(FD, 0x70, LD_off_IY_d_B             , 0                                 , "LD   (IY + %O), B") \
+	OP(FD, 0x71, LD_off_IY_d_C             , 0                                 , "LD   (IY + %O), C") \
+	OP(FD, 0x72, LD_off_IY_d_D             , 0                                 , "LD   (IY + %O), D") \
+	OP(FD, 0x73, LD_off_IY_d_E             , 0                                 , "LD   (IY + %O), E") \
+	OP(FD, 0x74, LD_off_IY_d_H             , 0                                 , "LD   (IY + %O), H") \
+	OP(FD, 0x75, LD_off_IY_d_L             , 0                                 , "LD   (IY + %O), L") \
+	NO(FD, 0x76) \
+	OP(FD, 0x77, LD_off_IY_d_A             , 0                                 , "LD   (IY + %O), A") \
+	NO(FD, 0x78) \
+	NO(FD, 0x79) \
+	NO(FD, 0x7a) \
+	NO(FD, 0x7b) \
+	OP(FD, 0x7c, LD_A_IYh                  , 0                                 , "LD   A, IYh") \
+	OP(FD, 0x7d, LD_A_IYl                  , 0                                 , "LD   A, IYl") \
+	OP(FD, 0x7e, LD_A_off_IY_d             , 0                                 , "LD   A, (IY + %O)") \
+	NO(FD, 0x7f) \
+	NO(FD, 0x80) \
+	NO(FD, 0x81) \
+	NO(FD, 0x82) \
+	NO(FD, 0x83) \
+	OP(FD, 0x84, ADD_A_IYh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, IYh") \
+	OP(FD, 0x85, ADD_A_IYl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, IYl") \
+	OP(FD, 0x86, ADD_A_off_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "ADD  A, (IY + %O)") \
+	NO(FD, 0x87) \
+	NO(FD, 0x88) \
+	NO(FD, 0x89) \
+	NO(FD, 0x8a) \
+	NO(FD, 0x8b) \
+	OP(FD, 0x8c, ADC_A_IYh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, IYh") \
+	OP(FD, 0x8d, ADC_A_IYl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, IYl") \
+	OP(FD, 0x8e, ADC_A_off_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "ADC  A, (IY + %O)") \
+	NO(FD, 0x8f) \
+	NO(FD, 0x90) \
+	NO(FD, 0x91) \
+	NO(FD, 0x92) \
+	NO(FD, 0x93) \
+	OP(FD, 0x94, SUB_A_IYh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A,IYh") \
+	OP(FD, 0x95, SUB_A_IYl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A,IYl") \
+	OP(FD, 0x96, SUB_A_off_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "SUB  A,(IY + %O)") \
+	NO(FD, 0x97) \
+	NO(FD, 0x98) \
+	NO(FD, 0x99) \
+	NO(FD, 0x9a) \
+	NO(FD, 0x9b) \
+	OP(FD, 0x9c, SBC_A_IYh                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A,IYh") \
+	OP(FD, 0x9d, SBC_A_IYl                 , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A,IYl") \
+	OP(FD, 0x9e, SBC_A_off_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "SBC  A,(IY + %O)") \
+	NO(FD, 0x9f) \
+	NO(FD, 0xa0) \
+	NO(FD, 0xa1) \
+	NO(FD, 0xa2) \
+	NO(FD, 0xa3) \
+	OP(FD, 0xa4, AND_IYh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  IYh") \
+	OP(FD, 0xa5, AND_IYl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  IYl") \
+	OP(FD, 0xa6, AND_off_IY_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "AND  (IY + %O)") \
+	NO(FD, 0xa7) \
+	NO(FD, 0xa8) \
+	NO(FD, 0xa9) \
+	NO(FD, 0xaa) \
+	NO(FD, 0xab) \
+	OP(FD, 0xac, XOR_IYh                   , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  IYh") \
+	OP(FD, 0xad, XOR_IYl                   , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  IYl") \
+	OP(FD, 0xae, XOR_off_IY_d              , CZ80Core::OPCODEFLAG_AltersFlags  , "XOR  (IY + %O)") \
+	NO(FD, 0xaf) \
+	NO(FD, 0xb0) \
+	NO(FD, 0xb1) \
+	NO(FD, 0xb2) \
+	NO(FD, 0xb3) \
+	OP(FD, 0xb4, OR_IYh                    , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   IYh") \
+	OP(FD, 0xb5, OR_IYl                    , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   IYl") \
+	OP(FD, 0xb6, OR_off_IY_d               , CZ80Core::OPCODEFLAG_AltersFlags  , "OR   (IY + %O)") \
+	NO(FD, 0xb7) \
+	NO(FD, 0xb8) \
+	NO(FD, 0xb9) \
+	NO(FD, 0xba) \
+	NO(FD, 0xbb) \
+	OP(FD, 0xbc, CP_IYh                    , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   IYh") \
+	OP(FD, 0xbd, CP_IYl                    , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   IYl") \
+	OP(FD, 0xbe, CP_off_IY_d               , CZ80Core::OPCODEFLAG_AltersFlags  , "CP   (IY + %O)") \
+	NO(FD, 0xbf) \
+	NO(FD, 0xc0) \
+	NO(FD, 0xc1) \
+	NO(FD, 0xc2) \
+	NO(FD, 0xc3) \
+	NO(FD, 0xc4) \
+	NO(FD, 0xc5) \
+	NO(FD, 0xc6) \
+	NO(FD, 0xc7) \
+	NO(FD, 0xc8) \
+	NO(FD, 0xc9) \
+	NO(FD, 0xca) \
+	NO(FD, 0xcb) \
+	NO(FD, 0xcc) \
+	NO(FD, 0xcd) \
+	NO(FD, 0xce) \
+	NO(FD, 0xcf) \
+	NO(FD, 0xd0) \
+	NO(FD, 0xd1) \
+	NO(FD, 0xd2) \
+	NO(FD, 0xd3) \
+	NO(FD, 0xd4) \
+	NO(FD, 0xd5) \
+	NO(FD, 0xd6) \
+	NO(FD, 0xd7) \
+	NO(FD, 0xd8) \
+	NO(FD, 0xd9) \
+	NO(FD, 0xda) \
+	NO(FD, 0xdb) \
+	NO(FD, 0xdc) \
+	NO(FD, 0xdd) \
+	NO(FD, 0xde) \
+	NO(FD, 0xdf) \
+	NO(FD, 0xe0) \
+	OP(FD, 0xe1, POP_IY                    , 0                                 , "POP  IY") \
+	NO(FD, 0xe2) \
+	OP(FD, 0xe3, EX_off_SP_IY              , 0                                 , "EX   (SP), IY") \
+	NO(FD, 0xe4) \
+	OP(FD, 0xe5, PUSH_IY                   , 0                                 , "PUSH IY") \
+	NO(FD, 0xe6) \
+	NO(FD, 0xe7) \
+	NO(FD, 0xe8) \
+	OP(FD, 0xe9, JP_off_IY                 , 0                                 , "JP   (IY)") \
+	NO(FD, 0xea) \
+	NO(FD, 0xeb) \
+	NO(FD, 0xec) \
+	NO(FD, 0xed) \
+	NO(FD, 0xee) \
+	NO(FD, 0xef) \
+	NO(FD, 0xf0) \
+	NO(FD, 0xf1) \
+	NO(FD, 0xf2) \
+	NO(FD, 0xf3) \
+	NO(FD, 0xf4) \
+	NO(FD, 0xf5) \
+	NO(FD, 0xf6) \
+	NO(FD, 0xf7) \
+	NO(FD, 0xf8) \
+	OP(FD, 0xf9, LD_SP_IY                  , 0                                 , "LD   SP, IY") \
+	NO(FD, 0xfa) \
+	NO(FD, 0xfb) \
+	NO(FD, 0xfc) \
+	NO(FD, 0xfd) \
+	NO(FD, 0xfe) \
+	NO(FD, 0xff) \
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::Main_Opcodes = {
-	{
-		{ &CZ80Core::NOP                 , 0,									"NOP"              },
-		{ &CZ80Core::LD_BC_nn            , 0,									"LD   BC, %W"     },
-		{ &CZ80Core::LD_off_BC_A         , 0,									"LD   (BC), A"        },
-		{ &CZ80Core::INC_BC              , 0,									"INC  BC"           },
-		{ &CZ80Core::INC_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  B"            },
-		{ &CZ80Core::DEC_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  B"            },
-		{ &CZ80Core::LD_B_n              , 0,									"LD   B, %B"      },
-		{ &CZ80Core::RLCA                , CZ80Core::OPCODEFLAG_AltersFlags,	"RLCA"             },
-		{ &CZ80Core::EX_AF_AF_           , 0,									"EX   AF, AF'"        },
-		{ &CZ80Core::ADD_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, BC"        },
-		{ &CZ80Core::LD_A_off_BC         , 0,									"LD   A, (BC)"        },
-		{ &CZ80Core::DEC_BC              , 0,									"DEC  BC"           },
-		{ &CZ80Core::INC_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  C"            },
-		{ &CZ80Core::DEC_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  C"            },
-		{ &CZ80Core::LD_C_n              , 0,									"LD   C, %B"      },
-		{ &CZ80Core::RRCA                , CZ80Core::OPCODEFLAG_AltersFlags,	"RRCA"             },
-		{ &CZ80Core::DJNZ_off_PC_e       , 0,									"DJNZ %R"     },
-		{ &CZ80Core::LD_DE_nn            , 0,									"LD   DE, %W"     },
-		{ &CZ80Core::LD_off_DE_A         , 0,									"LD   (DE), A"        },
-		{ &CZ80Core::INC_DE              , 0,									"INC  DE"           },
-		{ &CZ80Core::INC_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  D"            },
-		{ &CZ80Core::DEC_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  D"            },
-		{ &CZ80Core::LD_D_n              , 0,									"LD   D, %B"      },
-		{ &CZ80Core::RLA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"RLA"             },
-		{ &CZ80Core::JR_off_PC_e         , 0,									"JR   %R"       },
-		{ &CZ80Core::ADD_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, DE"        },
-		{ &CZ80Core::LD_A_off_DE         , 0,									"LD   A, (DE)"        },
-		{ &CZ80Core::DEC_DE              , 0,									"DEC  DE"           },
-		{ &CZ80Core::INC_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  E"            },
-		{ &CZ80Core::DEC_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  E"            },
-		{ &CZ80Core::LD_E_n              , 0,									"LD   E, %B"      },
-		{ &CZ80Core::RRA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"RRA"             },
-		{ &CZ80Core::JR_NZ_off_PC_e      , 0,									"JR   NZ, %R"    },
-		{ &CZ80Core::LD_HL_nn            , 0,									"LD   HL, %W"     },
-		{ &CZ80Core::LD_off_nn_HL        , 0,									"LD   (%W), HL"   },
-		{ &CZ80Core::INC_HL              , 0,									"INC  HL"           },
-		{ &CZ80Core::INC_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  H"            },
-		{ &CZ80Core::DEC_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  H"            },
-		{ &CZ80Core::LD_H_n              , 0,									"LD   H, %B"      },
-		{ &CZ80Core::DAA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"DAA"             },
-		{ &CZ80Core::JR_Z_off_PC_e       , 0,									"JR   Z, %R"     },
-		{ &CZ80Core::ADD_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL,HL"        },
-		{ &CZ80Core::LD_HL_off_nn        , 0,									"LD   HL, (%W)"   },
-		{ &CZ80Core::DEC_HL              , 0,									"DEC  HL"           },
-		{ &CZ80Core::INC_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  L"            },
-		{ &CZ80Core::DEC_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  L"            },
-		{ &CZ80Core::LD_L_n              , 0,									"LD   L, %B"      },
-		{ &CZ80Core::CPL                 , CZ80Core::OPCODEFLAG_AltersFlags,	"CPL"             },
-		{ &CZ80Core::JR_NC_off_PC_e      , 0,									"JR   NC, %R"    },
-		{ &CZ80Core::LD_SP_nn            , 0,									"LD   SP, %W"     },
-		{ &CZ80Core::LD_off_nn_A         , 0,									"LD   (%W), A"    },
-		{ &CZ80Core::INC_SP              , 0,									"INC  SP"           },
-		{ &CZ80Core::INC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  (HL)"         },
-		{ &CZ80Core::DEC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  (HL)"         },
-		{ &CZ80Core::LD_off_HL_n         , 0,									"LD   (HL), %B"   },
-		{ &CZ80Core::SCF                 , CZ80Core::OPCODEFLAG_AltersFlags,	"SCF"             },
-		{ &CZ80Core::JR_C_off_PC_e       , 0,									"JR   C, %R"     },
-		{ &CZ80Core::ADD_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, SP"        },
-		{ &CZ80Core::LD_A_off_nn         , 0,									"LD   A, (%W)"    },
-		{ &CZ80Core::DEC_SP              , 0,									"DEC  SP"           },
-		{ &CZ80Core::INC_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  A"            },
-		{ &CZ80Core::DEC_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  A"            },
-		{ &CZ80Core::LD_A_n              , 0,									"LD   A, %B"      },
-		{ &CZ80Core::CCF                 , CZ80Core::OPCODEFLAG_AltersFlags,	"CCF"             },
-		{ &CZ80Core::LD_B_B              , 0,									"LD   B, B"           },
-		{ &CZ80Core::LD_B_C              , 0,									"LD   B, C"           },
-		{ &CZ80Core::LD_B_D              , 0,									"LD   B, D"           },
-		{ &CZ80Core::LD_B_E              , 0,									"LD   B, E"           },
-		{ &CZ80Core::LD_B_H              , 0,									"LD   B, H"           },
-		{ &CZ80Core::LD_B_L              , 0,									"LD   B, L"           },
-		{ &CZ80Core::LD_B_off_HL         , 0,									"LD   B, (HL)"        },
-		{ &CZ80Core::LD_B_A              , 0,									"LD   B, A"           },
-		{ &CZ80Core::LD_C_B              , 0,									"LD   C, B"           },
-		{ &CZ80Core::LD_C_C              , 0,									"LD   C, C"           },
-		{ &CZ80Core::LD_C_D              , 0,									"LD   C, D"           },
-		{ &CZ80Core::LD_C_E              , 0,									"LD   C, E"           },
-		{ &CZ80Core::LD_C_H              , 0,									"LD   C, H"           },
-		{ &CZ80Core::LD_C_L              , 0,									"LD   C, L"           },
-		{ &CZ80Core::LD_C_off_HL         , 0,									"LD   C, (HL)"        },
-		{ &CZ80Core::LD_C_A              , 0,									"LD   C, A"           },
-		{ &CZ80Core::LD_D_B              , 0,									"LD   D, B"           },
-		{ &CZ80Core::LD_D_C              , 0,									"LD   D, C"           },
-		{ &CZ80Core::LD_D_D              , 0,									"LD   D, D"           },
-		{ &CZ80Core::LD_D_E              , 0,									"LD   D, E"           },
-		{ &CZ80Core::LD_D_H              , 0,									"LD   D, H"           },
-		{ &CZ80Core::LD_D_L              , 0,									"LD   D, L"           },
-		{ &CZ80Core::LD_D_off_HL         , 0,									"LD   D, (HL)"        },
-		{ &CZ80Core::LD_D_A              , 0,									"LD   D, A"           },
-		{ &CZ80Core::LD_E_B              , 0,									"LD   E, B"           },
-		{ &CZ80Core::LD_E_C              , 0,									"LD   E, C"           },
-		{ &CZ80Core::LD_E_D              , 0,									"LD   E, D"           },
-		{ &CZ80Core::LD_E_E              , 0,									"LD   E, E"           },
-		{ &CZ80Core::LD_E_H              , 0,									"LD   E, H"           },
-		{ &CZ80Core::LD_E_L              , 0,									"LD   E, L"           },
-		{ &CZ80Core::LD_E_off_HL         , 0,									"LD   E, (HL)"        },
-		{ &CZ80Core::LD_E_A              , 0,									"LD   E, A"           },
-		{ &CZ80Core::LD_H_B              , 0,									"LD   H, B"           },
-		{ &CZ80Core::LD_H_C              , 0,									"LD   H, C"           },
-		{ &CZ80Core::LD_H_D              , 0,									"LD   H, D"           },
-		{ &CZ80Core::LD_H_E              , 0,									"LD   H, E"           },
-		{ &CZ80Core::LD_H_H              , 0,									"LD   H, H"           },
-		{ &CZ80Core::LD_H_L              , 0,									"LD   H, L"           },
-		{ &CZ80Core::LD_H_off_HL         , 0,									"LD   H, (HL)"        },
-		{ &CZ80Core::LD_H_A              , 0,									"LD   H, A"           },
-		{ &CZ80Core::LD_L_B              , 0,									"LD   L, B"           },
-		{ &CZ80Core::LD_L_C              , 0,									"LD   L, C"           },
-		{ &CZ80Core::LD_L_D              , 0,									"LD   L, D"           },
-		{ &CZ80Core::LD_L_E              , 0,									"LD   L, E"           },
-		{ &CZ80Core::LD_L_H              , 0,									"LD   L, H"           },
-		{ &CZ80Core::LD_L_L              , 0,									"LD   L, L"           },
-		{ &CZ80Core::LD_L_off_HL         , 0,									"LD   L, (HL)"        },
-		{ &CZ80Core::LD_L_A              , 0,									"LD   L, A"           },
-		{ &CZ80Core::LD_off_HL_B         , 0,									"LD   (HL), B"        },
-		{ &CZ80Core::LD_off_HL_C         , 0,									"LD   (HL), C"        },
-		{ &CZ80Core::LD_off_HL_D         , 0,									"LD   (HL), D"        },
-		{ &CZ80Core::LD_off_HL_E         , 0,									"LD   (HL), E"        },
-		{ &CZ80Core::LD_off_HL_H         , 0,									"LD   (HL), H"        },
-		{ &CZ80Core::LD_off_HL_L         , 0,									"LD   (HL), L"        },
-		{ &CZ80Core::HALT                , 0,									"HALT"             },
-		{ &CZ80Core::LD_off_HL_A         , 0,									"LD   (HL), A"        },
-		{ &CZ80Core::LD_A_B              , 0,									"LD   A, B"           },
-		{ &CZ80Core::LD_A_C              , 0,									"LD   A, C"           },
-		{ &CZ80Core::LD_A_D              , 0,									"LD   A, D"           },
-		{ &CZ80Core::LD_A_E              , 0,									"LD   A, E"           },
-		{ &CZ80Core::LD_A_H              , 0,									"LD   A, H"           },
-		{ &CZ80Core::LD_A_L              , 0,									"LD   A, L"           },
-		{ &CZ80Core::LD_A_off_HL         , 0,									"LD   A, (HL)"        },
-		{ &CZ80Core::LD_A_A              , 0,									"LD   A, A"           },
-		{ &CZ80Core::ADD_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, B"          },
-		{ &CZ80Core::ADD_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, C"          },
-		{ &CZ80Core::ADD_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, D"          },
-		{ &CZ80Core::ADD_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, E"          },
-		{ &CZ80Core::ADD_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, H"          },
-		{ &CZ80Core::ADD_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, L"          },
-		{ &CZ80Core::ADD_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, (HL)"       },
-		{ &CZ80Core::ADD_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, A"          },
-		{ &CZ80Core::ADC_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, B"          },
-		{ &CZ80Core::ADC_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, C"          },
-		{ &CZ80Core::ADC_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, D"          },
-		{ &CZ80Core::ADC_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, E"          },
-		{ &CZ80Core::ADC_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, H"          },
-		{ &CZ80Core::ADC_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, L"          },
-		{ &CZ80Core::ADC_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, (HL)"       },
-		{ &CZ80Core::ADC_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, A"          },
-		{ &CZ80Core::SUB_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, B"          },
-		{ &CZ80Core::SUB_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, C"          },
-		{ &CZ80Core::SUB_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, D"          },
-		{ &CZ80Core::SUB_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, E"          },
-		{ &CZ80Core::SUB_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, H"          },
-		{ &CZ80Core::SUB_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, L"          },
-		{ &CZ80Core::SUB_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, (HL)"       },
-		{ &CZ80Core::SUB_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, A"          },
-		{ &CZ80Core::SBC_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, B"          },
-		{ &CZ80Core::SBC_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, C"          },
-		{ &CZ80Core::SBC_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, D"          },
-		{ &CZ80Core::SBC_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, E"          },
-		{ &CZ80Core::SBC_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, H"          },
-		{ &CZ80Core::SBC_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, L"          },
-		{ &CZ80Core::SBC_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, (HL)"       },
-		{ &CZ80Core::SBC_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, A"          },
-		{ &CZ80Core::AND_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  B"             },
-		{ &CZ80Core::AND_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  C"             },
-		{ &CZ80Core::AND_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  D"             },
-		{ &CZ80Core::AND_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  E"            },
-		{ &CZ80Core::AND_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  H"            },
-		{ &CZ80Core::AND_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  L"            },
-		{ &CZ80Core::AND_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  (HL)"         },
-		{ &CZ80Core::AND_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  A"            },
-		{ &CZ80Core::XOR_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  B"            },
-		{ &CZ80Core::XOR_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  C"            },
-		{ &CZ80Core::XOR_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  D"            },
-		{ &CZ80Core::XOR_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  E"            },
-		{ &CZ80Core::XOR_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  H"            },
-		{ &CZ80Core::XOR_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  L"            },
-		{ &CZ80Core::XOR_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  (HL)"         },
-		{ &CZ80Core::XOR_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  A"            },
-		{ &CZ80Core::OR_B                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   B"             },
-		{ &CZ80Core::OR_C                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   C"             },
-		{ &CZ80Core::OR_D                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   D"             },
-		{ &CZ80Core::OR_E                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   E"             },
-		{ &CZ80Core::OR_H                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   H"             },
-		{ &CZ80Core::OR_L                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   L"             },
-		{ &CZ80Core::OR_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   (HL)"          },
-		{ &CZ80Core::OR_A                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   A"             },
-		{ &CZ80Core::CP_B                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   B"             },
-		{ &CZ80Core::CP_C                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   C"             },
-		{ &CZ80Core::CP_D                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   D"             },
-		{ &CZ80Core::CP_E                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   E"             },
-		{ &CZ80Core::CP_H                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   H"             },
-		{ &CZ80Core::CP_L                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   L"             },
-		{ &CZ80Core::CP_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   (HL)"          },
-		{ &CZ80Core::CP_A                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   A"             },
-		{ &CZ80Core::RET_NZ              , 0,									"RET  NZ" },
-		{ &CZ80Core::POP_BC              , 0,									"POP  BC" },
-		{ &CZ80Core::JP_NZ_off_nn        , 0,									"JP   NZ, %W" },
-		{ &CZ80Core::JP_off_nn           , 0,									"JP   %W" },
-		{ &CZ80Core::CALL_NZ_off_nn      , 0,									"CALL NZ, %W" },
-		{ &CZ80Core::PUSH_BC             , 0,									"PUSH BC" },
-		{ &CZ80Core::ADD_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, %B"     },
-		{ &CZ80Core::RST_0H              , 0,									"RST  0H" },
-		{ &CZ80Core::RET_Z               , 0,									"RET  Z" },
-		{ &CZ80Core::RET                 , 0,									"RET" },
-		{ &CZ80Core::JP_Z_off_nn         , 0,									"JP   Z, %W" },
-        { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::CALL_Z_off_nn       , 0,									"CALL Z, %W" },
-		{ &CZ80Core::CALL_off_nn         , 0,									"CALL %W" },
-		{ &CZ80Core::ADC_A_n             , 0,									"ADC  A, %B" },
-		{ &CZ80Core::RST_8H              , 0,									"RST  8H" },
-		{ &CZ80Core::RET_NC              , 0,									"RET  NC" },
-		{ &CZ80Core::POP_DE              , 0,									"POP  DE" },
-		{ &CZ80Core::JP_NC_off_nn        , 0,									"JP   NC, %W" },
-		{ &CZ80Core::OUT_off_n_A         , 0,									"OUT (%B), A" },
-		{ &CZ80Core::CALL_NC_off_nn      , 0,									"CALL NC, %W" },
-		{ &CZ80Core::PUSH_DE             , 0,									"PUSH DE" },
-		{ &CZ80Core::SUB_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, %B"     },
-		{ &CZ80Core::RST_10H             , 0,									"RST  10H" },
-		{ &CZ80Core::RET_C               , 0,									"RET  C" },
-		{ &CZ80Core::EXX                 , 0,									"EXX" },
-		{ &CZ80Core::JP_C_off_nn         , 0,									"JP   C, %W" },
-		{ &CZ80Core::IN_A_off_n          , 0,									"IN   A, (%B)" },
-		{ &CZ80Core::CALL_C_off_nn       , 0,									"CALL C, %W" },
-        { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::SBC_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, %B"     },
-		{ &CZ80Core::RST_18H             , 0,									"RST  18H" },
-		{ &CZ80Core::RET_PO              , 0,									"RET  PO" },
-		{ &CZ80Core::POP_HL              , 0,									"POP  HL" },
-		{ &CZ80Core::JP_PO_off_nn        , 0,									"JP   PO, %W" },
-		{ &CZ80Core::EX_off_SP_HL        , 0,									"EX   (SP), HL" },
-		{ &CZ80Core::CALL_PO_off_nn      , 0,									"CALL PO, %W" },
-		{ &CZ80Core::PUSH_HL             , 0,									"PUSH HL" },
-		{ &CZ80Core::AND_n               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  %B"       },
-		{ &CZ80Core::RST_20H             , 0,									"RST  20H"          },
-		{ &CZ80Core::RET_PE              , 0,									"RET  PE"           },
-		{ &CZ80Core::JP_off_HL           , 0,									"JP   (HL)"          },
-		{ &CZ80Core::JP_PE_off_nn        , 0,									"JP   PE, %W"   },
-		{ &CZ80Core::EX_DE_HL            , 0,									"EX   DE, HL"         },
-		{ &CZ80Core::CALL_PE_off_nn      , 0,									"CALL PE, %W" },
-        { nullptr							 , 0,									nullptr               },
-		{ &CZ80Core::XOR_n               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  %B"       },
-		{ &CZ80Core::RST_28H             , 0,									"RST  28H" },
-		{ &CZ80Core::RET_P               , 0,									"RET  P" },
-		{ &CZ80Core::POP_AF              , 0,									"POP  AF" },
-		{ &CZ80Core::JP_P_off_nn         , 0,									"JP   P, %W" },
-		{ &CZ80Core::DI                  , 0,									"DI" },
-		{ &CZ80Core::CALL_P_off_nn       , 0,									"CALL P, %W" },
-		{ &CZ80Core::PUSH_AF             , 0,									"PUSH AF" },
-		{ &CZ80Core::OR_n                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   %B"        },
-		{ &CZ80Core::RST_30H             , 0,									"RST  30H" },
-		{ &CZ80Core::RET_M               , 0,									"RET  M" },
-		{ &CZ80Core::LD_SP_HL            , 0,									"LD   SP, HL" },
-		{ &CZ80Core::JP_M_off_nn         , 0,									"JP   M, %W" },
-		{ &CZ80Core::EI                  , 0,									"EI" },
-		{ &CZ80Core::CALL_M_off_nn       , 0,									"CALL M, %W" },
-        { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::CP_n                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   %B"        },
-		{ &CZ80Core::RST_38H             , 0,									"RST  38H"          }
-	}
-};
+// DD CB prefixed opcodes
+#define Z80CORE_OPCODES_DDCB(OP, NO) \
+	OP(DDCB, 0x00, LD_B_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RLC (IX + %O)") \
+	OP(DDCB, 0x01, LD_C_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RLC (IX + %O)") \
+	OP(DDCB, 0x02, LD_D_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RLC (IX + %O)") \
+	OP(DDCB, 0x03, LD_E_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RLC (IX + %O)") \
+	OP(DDCB, 0x04, LD_H_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RLC (IX + %O)") \
+	OP(DDCB, 0x05, LD_L_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RLC (IX + %O)") \
+	OP(DDCB, 0x06, RLC_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC  (IX + %O)") \
+	OP(DDCB, 0x07, LD_A_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RLC (IX + %O)") \
+	OP(DDCB, 0x08, LD_B_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RRC  (IX + %O)") \
+	OP(DDCB, 0x09, LD_C_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RRC  (IX + %O)") \
+	OP(DDCB, 0x0a, LD_D_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RRC  (IX + %O)") \
+	OP(DDCB, 0x0b, LD_E_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RRC  (IX + %O)") \
+	OP(DDCB, 0x0c, LD_H_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RRC  (IX + %O)") \
+	OP(DDCB, 0x0d, LD_L_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RRC  (IX + %O)") \
+	OP(DDCB, 0x0e, RRC_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  (IX + %O)") \
+	OP(DDCB, 0x0f, LD_A_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RRC  (IX + %O)") \
+	OP(DDCB, 0x10, LD_B_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RL (IX + %O)") \
+	OP(DDCB, 0x11, LD_C_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RL (IX + %O)") \
+	OP(DDCB, 0x12, LD_D_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RL (IX + %O)") \
+	OP(DDCB, 0x13, LD_E_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RL (IX + %O)") \
+	OP(DDCB, 0x14, LD_H_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RL (IX + %O)") \
+	OP(DDCB, 0x15, LD_L_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RL (IX + %O)") \
+	OP(DDCB, 0x16, RL_off_IX_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "RL   (IX + %O)") \
+	OP(DDCB, 0x17, LD_A_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RL (IX + %O)") \
+	OP(DDCB, 0x18, LD_B_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RR (IX + %O)") \
+	OP(DDCB, 0x19, LD_C_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RR (IX + %O)") \
+	OP(DDCB, 0x1a, LD_D_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RR (IX + %O)") \
+	OP(DDCB, 0x1b, LD_E_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RR (IX + %O)") \
+	OP(DDCB, 0x1c, LD_H_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RR (IX + %O)") \
+	OP(DDCB, 0x1d, LD_L_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RR (IX + %O)") \
+	OP(DDCB, 0x1e, RR_off_IX_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "RR   (IX + %O)") \
+	OP(DDCB, 0x1f, LD_A_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RR (IX + %O)") \
+	OP(DDCB, 0x20, LD_B_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SLA (IX + %O)") \
+	OP(DDCB, 0x21, LD_C_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SLA (IX + %O)") \
+	OP(DDCB, 0x22, LD_D_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SLA (IX + %O)") \
+	OP(DDCB, 0x23, LD_E_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SLA (IX + %O)") \
+	OP(DDCB, 0x24, LD_H_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SLA (IX + %O)") \
+	OP(DDCB, 0x25, LD_L_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SLA (IX + %O)") \
+	OP(DDCB, 0x26, SLA_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  (IX + %O)") \
+	OP(DDCB, 0x27, LD_A_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SLA (IX + %O)") \
+	OP(DDCB, 0x28, LD_B_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SRA (IX + %O)") \
+	OP(DDCB, 0x29, LD_C_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SRA (IX + %O)") \
+	OP(DDCB, 0x2a, LD_D_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SRA (IX + %O)") \
+	OP(DDCB, 0x2b, LD_E_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SRA (IX + %O)") \
+	OP(DDCB, 0x2c, LD_H_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SRA (IX + %O)") \
+	OP(DDCB, 0x2d, LD_L_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SRA (IX + %O)") \
+	OP(DDCB, 0x2e, SRA_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  (IX + %O)") \
+	OP(DDCB, 0x2f, LD_A_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SRA (IX + %O)") \
+	OP(DDCB, 0x30, LD_B_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SLL  (IX + %O)") \
+	OP(DDCB, 0x31, LD_C_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SLL  (IX + %O)") \
+	OP(DDCB, 0x32, LD_D_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SLL  (IX + %O)") \
+	OP(DDCB, 0x33, LD_E_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SLL  (IX + %O)") \
+	OP(DDCB, 0x34, LD_H_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SLL  (IX + %O)") \
+	OP(DDCB, 0x35, LD_L_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SLL  (IX + %O)") \
+	OP(DDCB, 0x36, SLL_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  (IX + %O)") \
+	OP(DDCB, 0x37, LD_A_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SLL  (IX + %O)") \
+	OP(DDCB, 0x38, LD_B_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SRL (IX + %O)") \
+	OP(DDCB, 0x39, LD_C_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SRL (IX + %O)") \
+	OP(DDCB, 0x3a, LD_D_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SRL (IX + %O)") \
+	OP(DDCB, 0x3b, LD_E_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SRL (IX + %O)") \
+	OP(DDCB, 0x3c, LD_H_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SRL (IX + %O)") \
+	OP(DDCB, 0x3d, LD_L_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SRL (IX + %O)") \
+	OP(DDCB, 0x3e, SRL_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  (IX + %O)") \
+	OP(DDCB, 0x3f, LD_A_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A,SRL (IX + %O)") \
+	OP(DDCB, 0x40, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x41, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x42, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x43, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x44, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x45, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x46, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x47, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IX + %O)") \
+	OP(DDCB, 0x48, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x49, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4a, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4b, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4c, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4d, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4e, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x4f, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IX + %O)") \
+	OP(DDCB, 0x50, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x51, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x52, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x53, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x54, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x55, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x56, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x57, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IX + %O)") \
+	OP(DDCB, 0x58, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x59, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5a, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5b, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5c, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5d, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5e, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x5f, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IX + %O)") \
+	OP(DDCB, 0x60, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x61, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x62, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x63, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x64, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x65, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x66, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x67, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IX + %O)") \
+	OP(DDCB, 0x68, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x69, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6a, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6b, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6c, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6d, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6e, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x6f, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IX + %O)") \
+	OP(DDCB, 0x70, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x71, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x72, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x73, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x74, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x75, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x76, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x77, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IX + %O)") \
+	OP(DDCB, 0x78, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x79, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7a, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7b, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7c, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7d, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7e, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x7f, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IX + %O)") \
+	OP(DDCB, 0x80, LD_B_RES_0_off_IX_IY_d    , 0                                 , "LD   B, RES  0, (IX + %O)") \
+	OP(DDCB, 0x81, LD_C_RES_0_off_IX_IY_d    , 0                                 , "LD   C, RES  0, (IX + %O)") \
+	OP(DDCB, 0x82, LD_D_RES_0_off_IX_IY_d    , 0                                 , "LD   D, RES  0, (IX + %O)") \
+	OP(DDCB, 0x83, LD_E_RES_0_off_IX_IY_d    , 0                                 , "LD   E, RES  0, (IX + %O)") \
+	OP(DDCB, 0x84, LD_H_RES_0_off_IX_IY_d    , 0                                 , "LD   H, RES  0, (IX + %O)") \
+	OP(DDCB, 0x85, LD_L_RES_0_off_IX_IY_d    , 0                                 , "LD   L, RES  0, (IX + %O)") \
+	OP(DDCB, 0x86, RES_0_off_IX_IY_d         , 0                                 , "RES  0, (IX + %O)") \
+	OP(DDCB, 0x87, LD_A_RES_0_off_IX_IY_d    , 0                                 , "LD   A, RES 0, (IX + %O)") \
+	OP(DDCB, 0x88, LD_B_RES_1_off_IX_IY_d    , 0                                 , "LD   B, RES  1, (IX + %O)") \
+	OP(DDCB, 0x89, LD_C_RES_1_off_IX_IY_d    , 0                                 , "LD   C, RES  1, (IX + %O)") \
+	OP(DDCB, 0x8a, LD_D_RES_1_off_IX_IY_d    , 0                                 , "LD   D, RES  1, (IX + %O)") \
+	OP(DDCB, 0x8b, LD_E_RES_1_off_IX_IY_d    , 0                                 , "LD   E, RES  1, (IX + %O)") \
+	OP(DDCB, 0x8c, LD_H_RES_1_off_IX_IY_d    , 0                                 , "LD   H, RES  1, (IX + %O)") \
+	OP(DDCB, 0x8d, LD_L_RES_1_off_IX_IY_d    , 0                                 , "LD   L, RES  1, (IX + %O)") \
+	OP(DDCB, 0x8e, RES_1_off_IX_IY_d         , 0                                 , "RES  1, (IX + %O)") \
+	OP(DDCB, 0x8f, LD_A_RES_1_off_IX_IY_d    , 0                                 , "LD   A, RES  1, (IX + %O)") \
+	OP(DDCB, 0x90, LD_B_RES_2_off_IX_IY_d    , 0                                 , "LD   B, RES  2, (IX + %O)") \
+	OP(DDCB, 0x91, LD_C_RES_2_off_IX_IY_d    , 0                                 , "LD   C, RES  2, (IX + %O)") \
+	OP(DDCB, 0x92, LD_D_RES_2_off_IX_IY_d    , 0                                 , "LD   D, RES  2, (IX + %O)") \
+	OP(DDCB, 0x93, LD_E_RES_2_off_IX_IY_d    , 0                                 , "LD   E, RES  2, (IX + %O)") \
+	OP(DDCB, 0x94, LD_H_RES_2_off_IX_IY_d    , 0                                 , "LD   H, RES  2, (IX + %O)") \
+	OP(DDCB, 0x95, LD_L_RES_2_off_IX_IY_d    , 0                                 , "LD   L, RES  2, (IX + %O)") \
+	OP(DDCB, 0x96, RES_2_off_IX_IY_d         , 0                                 , "RES  2, (IX + %O)") \
+	OP(DDCB, 0x97, LD_A_RES_2_off_IX_IY_d    , 0                                 , "LD   A, RES  2, (IX + %O)") \
+	OP(DDCB, 0x98, LD_B_RES_3_off_IX_IY_d    , 0                                 , "LD   B, RES  3, (IX + %O)") \
+	OP(DDCB, 0x99, LD_C_RES_3_off_IX_IY_d    , 0                                 , "LD   C, RES  3, (IX + %O)") \
+	OP(DDCB, 0x9a, LD_D_RES_3_off_IX_IY_d    , 0                                 , "LD   D, RES  3, (IX + %O)") \
+	OP(DDCB, 0x9b, LD_E_RES_3_off_IX_IY_d    , 0                                 , "LD   E, RES  3, (IX + %O)") \
+	OP(DDCB, 0x9c, LD_H_RES_3_off_IX_IY_d    , 0                                 , "LD   H, RES  3, (IX + %O)") \
+	OP(DDCB, 0x9d, LD_L_RES_3_off_IX_IY_d    , 0                                 , "LD   L, RES  3, (IX + %O)") \
+	OP(DDCB, 0x9e, RES_3_off_IX_IY_d         , 0                                 , "RES  3, (IX + %O)") \
+	OP(DDCB, 0x9f, LD_A_RES_3_off_IX_IY_d    , 0                                 , "LD   A, RES  3, (IX + %O)") \
+	OP(DDCB, 0xa0, LD_B_RES_4_off_IX_IY_d    , 0                                 , "LD   B, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa1, LD_C_RES_4_off_IX_IY_d    , 0                                 , "LD   C, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa2, LD_D_RES_4_off_IX_IY_d    , 0                                 , "LD   D, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa3, LD_E_RES_4_off_IX_IY_d    , 0                                 , "LD   E, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa4, LD_H_RES_4_off_IX_IY_d    , 0                                 , "LD   H, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa5, LD_L_RES_4_off_IX_IY_d    , 0                                 , "LD   L, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa6, RES_4_off_IX_IY_d         , 0                                 , "RES  4, (IX + %O)") \
+	OP(DDCB, 0xa7, LD_A_RES_4_off_IX_IY_d    , 0                                 , "LD   A, RES  4, (IX + %O)") \
+	OP(DDCB, 0xa8, LD_B_RES_5_off_IX_IY_d    , 0                                 , "LD   B, RES 5, (IX + %O)") \
+	OP(DDCB, 0xa9, LD_C_RES_5_off_IX_IY_d    , 0                                 , "LD   C, RES 5, (IX + %O)") \
+	OP(DDCB, 0xaa, LD_D_RES_5_off_IX_IY_d    , 0                                 , "LD   D, RES 5, (IX + %O)") \
+	OP(DDCB, 0xab, LD_E_RES_5_off_IX_IY_d    , 0                                 , "LD   E, RES 5, (IX + %O)") \
+	OP(DDCB, 0xac, LD_H_RES_5_off_IX_IY_d    , 0                                 , "LD   H, RES 5, (IX + %O)") \
+	OP(DDCB, 0xad, LD_L_RES_5_off_IX_IY_d    , 0                                 , "LD   L, RES 5, (IX + %O)") \
+	OP(DDCB, 0xae, RES_5_off_IX_IY_d         , 0                                 , "RES  5, (IX + %O)") \
+	OP(DDCB, 0xaf, LD_A_RES_5_off_IX_IY_d    , 0                                 , "LD   A, RES 5, (IX + %O)") \
+	OP(DDCB, 0xb0, LD_B_RES_6_off_IX_IY_d    , 0                                 , "LD   B, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb1, LD_C_RES_6_off_IX_IY_d    , 0                                 , "LD   C, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb2, LD_D_RES_6_off_IX_IY_d    , 0                                 , "LD   D, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb3, LD_E_RES_6_off_IX_IY_d    , 0                                 , "LD   E, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb4, LD_H_RES_6_off_IX_IY_d    , 0                                 , "LD   H, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb5, LD_L_RES_6_off_IX_IY_d    , 0                                 , "LD   L, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb6, RES_6_off_IX_IY_d         , 0                                 , "RES  6, (IX + %O)") \
+	OP(DDCB, 0xb7, LD_A_RES_6_off_IX_IY_d    , 0                                 , "LD   A, RES 6, (IX + %O)") \
+	OP(DDCB, 0xb8, LD_B_RES_7_off_IX_IY_d    , 0                                 , "LD   B, RES 7, (IX + %O)") \
+	OP(DDCB, 0xb9, LD_C_RES_7_off_IX_IY_d    , 0                                 , "LD   C, RES 7, (IX + %O)") \
+	OP(DDCB, 0xba, LD_D_RES_7_off_IX_IY_d    , 0                                 , "LD   D, RES 7, (IX + %O)") \
+	OP(DDCB, 0xbb, LD_E_RES_7_off_IX_IY_d    , 0                                 , "LD   E, RES 7, (IX + %O)") \
+	OP(DDCB, 0xbc, LD_H_RES_7_off_IX_IY_d    , 0                                 , "LD   H, RES 7, (IX + %O)") \
+	OP(DDCB, 0xbd, LD_L_RES_7_off_IX_IY_d    , 0                                 , "LD   L, RES 7, (IX + %O)") \
+	OP(DDCB, 0xbe, RES_7_off_IX_IY_d         , 0                                 , "RES  7, (IX + %O)") \
+	OP(DDCB, 0xbf, LD_A_RES_7_off_IX_IY_d    , 0                                 , "LD   A, RES 7, (IX + %O)") \
+	OP(DDCB, 0xc0, LD_B_SET_0_off_IX_IY_d    , 0                                 , "LD   B, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc1, LD_C_SET_0_off_IX_IY_d    , 0                                 , "LD   C, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc2, LD_D_SET_0_off_IX_IY_d    , 0                                 , "LD   D, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc3, LD_E_SET_0_off_IX_IY_d    , 0                                 , "LD   E, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc4, LD_H_SET_0_off_IX_IY_d    , 0                                 , "LD   H, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc5, LD_L_SET_0_off_IX_IY_d    , 0                                 , "LD   L, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc6, SET_0_off_IX_IY_d         , 0                                 , "SET  0, (IX + %O)") \
+	OP(DDCB, 0xc7, LD_A_SET_0_off_IX_IY_d    , 0                                 , "LD   A, SET 0, (IX + %O)") \
+	OP(DDCB, 0xc8, LD_B_SET_1_off_IX_IY_d    , 0                                 , "LD   B, SET 1, (IX + %O)") \
+	OP(DDCB, 0xc9, LD_C_SET_1_off_IX_IY_d    , 0                                 , "LD   C, SET 1, (IX + %O)") \
+	OP(DDCB, 0xca, LD_D_SET_1_off_IX_IY_d    , 0                                 , "LD   D, SET 1, (IX + %O)") \
+	OP(DDCB, 0xcb, LD_E_SET_1_off_IX_IY_d    , 0                                 , "LD   E, SET 1, (IX + %O)") \
+	OP(DDCB, 0xcc, LD_H_SET_1_off_IX_IY_d    , 0                                 , "LD   H, SET 1, (IX + %O)") \
+	OP(DDCB, 0xcd, LD_L_SET_1_off_IX_IY_d    , 0                                 , "LD   L, SET 1, (IX + %O)") \
+	OP(DDCB, 0xce, SET_1_off_IX_IY_d         , 0                                 , "SET  1, (IX + %O)") \
+	OP(DDCB, 0xcf, LD_A_SET_1_off_IX_IY_d    , 0                                 , "LD   A, SET 1, (IX + %O)") \
+	OP(DDCB, 0xd0, LD_B_SET_2_off_IX_IY_d    , 0                                 , "LD   B, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd1, LD_C_SET_2_off_IX_IY_d    , 0                                 , "LD   C, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd2, LD_D_SET_2_off_IX_IY_d    , 0                                 , "LD   D, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd3, LD_E_SET_2_off_IX_IY_d    , 0                                 , "LD   E, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd4, LD_H_SET_2_off_IX_IY_d    , 0                                 , "LD   H, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd5, LD_L_SET_2_off_IX_IY_d    , 0                                 , "LD   L, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd6, SET_2_off_IX_IY_d         , 0                                 , "SET  2, (IX + %O)") \
+	OP(DDCB, 0xd7, LD_A_SET_2_off_IX_IY_d    , 0                                 , "LD   A, SET 2, (IX + %O)") \
+	OP(DDCB, 0xd8, LD_B_SET_3_off_IX_IY_d    , 0                                 , "LD   B, SET 3, (IX + %O)") \
+	OP(DDCB, 0xd9, LD_C_SET_3_off_IX_IY_d    , 0                                 , "LD   C, SET 3, (IX + %O)") \
+	OP(DDCB, 0xda, LD_D_SET_3_off_IX_IY_d    , 0                                 , "LD   D, SET 3, (IX + %O)") \
+	OP(DDCB, 0xdb, LD_E_SET_3_off_IX_IY_d    , 0                                 , "LD   E, SET 3, (IX + %O)") \
+	OP(DDCB, 0xdc, LD_H_SET_3_off_IX_IY_d    , 0                                 , "LD   H, SET 3, (IX + %O)") \
+	OP(DDCB, 0xdd, LD_L_SET_3_off_IX_IY_d    , 0                                 , "LD   L, SET 3, (IX + %O)") \
+	OP(DDCB, 0xde, SET_3_off_IX_IY_d         , 0                                 , "SET  3, (IX + %O)") \
+	OP(DDCB, 0xdf, LD_A_SET_3_off_IX_IY_d    , 0                                 , "LD   A, SET 3, (IX + %O)") \
+	OP(DDCB, 0xe0, LD_B_SET_4_off_IX_IY_d    , 0                                 , "LD   B, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe1, LD_C_SET_4_off_IX_IY_d    , 0                                 , "LD   C, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe2, LD_D_SET_4_off_IX_IY_d    , 0                                 , "LD   D, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe3, LD_E_SET_4_off_IX_IY_d    , 0                                 , "LD   E, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe4, LD_H_SET_4_off_IX_IY_d    , 0                                 , "LD   H, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe5, LD_L_SET_4_off_IX_IY_d    , 0                                 , "LD   L, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe6, SET_4_off_IX_IY_d         , 0                                 , "SET  4, (IX + %O)") \
+	OP(DDCB, 0xe7, LD_A_SET_4_off_IX_IY_d    , 0                                 , "LD   A, SET 4, (IX + %O)") \
+	OP(DDCB, 0xe8, LD_B_SET_5_off_IX_IY_d    , 0                                 , "LD   B, SET 5, (IX + %O)") \
+	OP(DDCB, 0xe9, LD_C_SET_5_off_IX_IY_d    , 0                                 , "LD   C, SET 5, (IX + %O)") \
+	OP(DDCB, 0xea, LD_D_SET_5_off_IX_IY_d    , 0                                 , "LD   D, SET 5, (IX + %O)") \
+	OP(DDCB, 0xeb, LD_E_SET_5_off_IX_IY_d    , 0                                 , "LD   E, SET 5, (IX + %O)") \
+	OP(DDCB, 0xec, LD_H_SET_5_off_IX_IY_d    , 0                                 , "LD   H, SET 5, (IX + %O)") \
+	OP(DDCB, 0xed, LD_L_SET_5_off_IX_IY_d    , 0                                 , "LD   L, SET 5, (IX + %O)") \
+	OP(DDCB, 0xee, SET_5_off_IX_IY_d         , 0                                 , "SET  5, (IX + %O)") \
+	OP(DDCB, 0xef, LD_A_SET_5_off_IX_IY_d    , 0                                 , "LD   A, SET 5, (IX + %O)") \
+	OP(DDCB, 0xf0, LD_B_SET_6_off_IX_IY_d    , 0                                 , "LD   B, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf1, LD_C_SET_6_off_IX_IY_d    , 0                                 , "LD   C, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf2, LD_D_SET_6_off_IX_IY_d    , 0                                 , "LD   D, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf3, LD_E_SET_6_off_IX_IY_d    , 0                                 , "LD   E, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf4, LD_H_SET_6_off_IX_IY_d    , 0                                 , "LD   H, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf5, LD_L_SET_6_off_IX_IY_d    , 0                                 , "LD   L, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf6, SET_6_off_IX_IY_d         , 0                                 , "SET  6, (IX + %O)") \
+	OP(DDCB, 0xf7, LD_A_SET_6_off_IX_IY_d    , 0                                 , "LD   A, SET 6, (IX + %O)") \
+	OP(DDCB, 0xf8, LD_B_SET_7_off_IX_IY_d    , 0                                 , "LD   B, SET 7, (IX + %O)") \
+	OP(DDCB, 0xf9, LD_C_SET_7_off_IX_IY_d    , 0                                 , "LD   C, SET 7, (IX + %O)") \
+	OP(DDCB, 0xfa, LD_D_SET_7_off_IX_IY_d    , 0                                 , "LD   D, SET 7, (IX + %O)") \
+	OP(DDCB, 0xfb, LD_E_SET_7_off_IX_IY_d    , 0                                 , "LD   E, SET 7, (IX + %O)") \
+	OP(DDCB, 0xfc, LD_H_SET_7_off_IX_IY_d    , 0                                 , "LD   H, SET 7, (IX + %O)") \
+	OP(DDCB, 0xfd, LD_L_SET_7_off_IX_IY_d    , 0                                 , "LD   L, SET 7, (IX + %O)") \
+	OP(DDCB, 0xfe, SET_7_off_IX_IY_d         , 0                                 , "SET  7, (IX + %O)") \
+	OP(DDCB, 0xff, LD_A_SET_7_off_IX_IY_d    , 0                                 , "LD   A, SET 7, (IX + %O)") \
+
+
+// FD CB prefixed opcodes
+#define Z80CORE_OPCODES_FDCB(OP, NO) \
+	OP(FDCB, 0x00, LD_B_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RLC (IY + %O)") \
+	OP(FDCB, 0x01, LD_C_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RLC (IY + %O)") \
+	OP(FDCB, 0x02, LD_D_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RLC (IY + %O)") \
+	OP(FDCB, 0x03, LD_E_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RLC (IY + %O)") \
+	OP(FDCB, 0x04, LD_H_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RLC (IY + %O)") \
+	OP(FDCB, 0x05, LD_L_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RLC (IY + %O)") \
+	OP(FDCB, 0x06, RLC_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "RLC (IY + %O)") \
+	OP(FDCB, 0x07, LD_A_RLC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A,RLC (IY + %O)") \
+	OP(FDCB, 0x08, LD_B_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RRC (IY + %O)") \
+	OP(FDCB, 0x09, LD_C_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RRC (IY + %O)") \
+	OP(FDCB, 0x0a, LD_D_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RRC (IY + %O)") \
+	OP(FDCB, 0x0b, LD_E_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RRC (IY + %O)") \
+	OP(FDCB, 0x0c, LD_H_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RRC (IY + %O)") \
+	OP(FDCB, 0x0d, LD_L_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RRC (IY + %O)") \
+	OP(FDCB, 0x0e, RRC_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "RRC  (IY + %O)") \
+	OP(FDCB, 0x0f, LD_A_RRC_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RRC (IY + %O)") \
+	OP(FDCB, 0x10, LD_B_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RL (IY + %O)") \
+	OP(FDCB, 0x11, LD_C_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RL (IY + %O)") \
+	OP(FDCB, 0x12, LD_D_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RL (IY + %O)") \
+	OP(FDCB, 0x13, LD_E_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RL (IY + %O)") \
+	OP(FDCB, 0x14, LD_H_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RL (IY + %O)") \
+	OP(FDCB, 0x15, LD_L_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RL (IY + %O)") \
+	OP(FDCB, 0x16, RL_off_IX_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "RL  (IY + %O)") \
+	OP(FDCB, 0x17, LD_A_RL_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RL (IY + %O)") \
+	OP(FDCB, 0x18, LD_B_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, RR (IY + %O)") \
+	OP(FDCB, 0x19, LD_C_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, RR (IY + %O)") \
+	OP(FDCB, 0x1a, LD_D_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, RR (IY + %O)") \
+	OP(FDCB, 0x1b, LD_E_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, RR (IY + %O)") \
+	OP(FDCB, 0x1c, LD_H_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, RR (IY + %O)") \
+	OP(FDCB, 0x1d, LD_L_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, RR (IY + %O)") \
+	OP(FDCB, 0x1e, RR_off_IX_IY_d            , CZ80Core::OPCODEFLAG_AltersFlags  , "RR  (IY + %O)") \
+	OP(FDCB, 0x1f, LD_A_RR_off_IX_IY_d       , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, RR (IY + %O)") \
+	OP(FDCB, 0x20, LD_B_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SLA (IY + %O)") \
+	OP(FDCB, 0x21, LD_C_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SLA (IY + %O)") \
+	OP(FDCB, 0x22, LD_D_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SLA (IY + %O)") \
+	OP(FDCB, 0x23, LD_E_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SLA (IY + %O)") \
+	OP(FDCB, 0x24, LD_H_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SLA (IY + %O)") \
+	OP(FDCB, 0x25, LD_L_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SLA (IY + %O)") \
+	OP(FDCB, 0x26, SLA_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SLA  (IY + %O)") \
+	OP(FDCB, 0x27, LD_A_SLA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SLA (IY + %O)") \
+	OP(FDCB, 0x28, LD_B_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SRA (IY + %O)") \
+	OP(FDCB, 0x29, LD_C_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SRA (IY + %O)") \
+	OP(FDCB, 0x2a, LD_D_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SRA (IY + %O)") \
+	OP(FDCB, 0x2b, LD_E_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SRA (IY + %O)") \
+	OP(FDCB, 0x2c, LD_H_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SRA (IY + %O)") \
+	OP(FDCB, 0x2d, LD_L_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SRA (IY + %O)") \
+	OP(FDCB, 0x2e, SRA_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SRA  (IY + %O)") \
+	OP(FDCB, 0x2f, LD_A_SRA_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SRA (IY + %O)") \
+	OP(FDCB, 0x30, LD_B_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SLL  (IY + %O)") \
+	OP(FDCB, 0x31, LD_C_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SLL  (IY + %O)") \
+	OP(FDCB, 0x32, LD_D_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SLL  (IY + %O)") \
+	OP(FDCB, 0x33, LD_E_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SLL  (IY + %O)") \
+	OP(FDCB, 0x34, LD_H_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SLL  (IY + %O)") \
+	OP(FDCB, 0x35, LD_L_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SLL  (IY + %O)") \
+	OP(FDCB, 0x36, SLL_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SLL  (IY + %O)") \
+	OP(FDCB, 0x37, LD_A_SLL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SLL  (IY + %O)") \
+	OP(FDCB, 0x38, LD_B_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   B, SRL (IY + %O)") \
+	OP(FDCB, 0x39, LD_C_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   C, SRL (IY + %O)") \
+	OP(FDCB, 0x3a, LD_D_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   D, SRL (IY + %O)") \
+	OP(FDCB, 0x3b, LD_E_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   E, SRL (IY + %O)") \
+	OP(FDCB, 0x3c, LD_H_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   H, SRL (IY + %O)") \
+	OP(FDCB, 0x3d, LD_L_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   L, SRL (IY + %O)") \
+	OP(FDCB, 0x3e, SRL_off_IX_IY_d           , CZ80Core::OPCODEFLAG_AltersFlags  , "SRL  (IY + %O)") \
+	OP(FDCB, 0x3f, LD_A_SRL_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags  , "LD   A, SRL (IY + %O)") \
+	OP(FDCB, 0x40, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x41, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x42, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x43, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x44, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x45, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x46, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x47, BIT_0_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  0, (IY + %O)") \
+	OP(FDCB, 0x48, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x49, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4a, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4b, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4c, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4d, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4e, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x4f, BIT_1_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  1, (IY + %O)") \
+	OP(FDCB, 0x50, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x51, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x52, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x53, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x54, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x55, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x56, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x57, BIT_2_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  2, (IY + %O)") \
+	OP(FDCB, 0x58, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x59, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5a, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5b, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5c, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5d, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5e, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x5f, BIT_3_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  3, (IY + %O)") \
+	OP(FDCB, 0x60, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x61, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x62, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x63, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x64, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x65, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x66, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x67, BIT_4_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  4, (IY + %O)") \
+	OP(FDCB, 0x68, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x69, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6a, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6b, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6c, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6d, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6e, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x6f, BIT_5_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  5, (IY + %O)") \
+	OP(FDCB, 0x70, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x71, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x72, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x73, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x74, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x75, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x76, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x77, BIT_6_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  6, (IY + %O)") \
+	OP(FDCB, 0x78, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x79, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7a, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7b, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7c, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7d, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7e, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x7f, BIT_7_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags  , "BIT  7, (IY + %O)") \
+	OP(FDCB, 0x80, LD_B_RES_0_off_IX_IY_d    , 0                                 , "LD   B,RES  0, (IY + %O)") \
+	OP(FDCB, 0x81, LD_C_RES_0_off_IX_IY_d    , 0                                 , "LD   C,RES  0, (IY + %O)") \
+	OP(FDCB, 0x82, LD_D_RES_0_off_IX_IY_d    , 0                                 , "LD   D,RES  0, (IY + %O)") \
+	OP(FDCB, 0x83, LD_E_RES_0_off_IX_IY_d    , 0                                 , "LD   E,RES  0, (IY + %O)") \
+	OP(FDCB, 0x84, LD_H_RES_0_off_IX_IY_d    , 0                                 , "LD   H,RES  0, (IY + %O)") \
+	OP(FDCB, 0x85, LD_L_RES_0_off_IX_IY_d    , 0                                 , "LD   L,RES  0, (IY + %O)") \
+	OP(FDCB, 0x86, RES_0_off_IX_IY_d         , 0                                 , "RES  0,(IY + %O)") \
+	OP(FDCB, 0x87, LD_A_RES_0_off_IX_IY_d    , 0                                 , "LD   A,RES  0, (IY + %O)") \
+	OP(FDCB, 0x88, LD_B_RES_1_off_IX_IY_d    , 0                                 , "LD   B,RES  1, (IY + %O)") \
+	OP(FDCB, 0x89, LD_C_RES_1_off_IX_IY_d    , 0                                 , "LD   C,RES  1, (IY + %O)") \
+	OP(FDCB, 0x8a, LD_D_RES_1_off_IX_IY_d    , 0                                 , "LD   D,RES  1, (IY + %O)") \
+	OP(FDCB, 0x8b, LD_E_RES_1_off_IX_IY_d    , 0                                 , "LD   E,RES  1, (IY + %O)") \
+	OP(FDCB, 0x8c, LD_H_RES_1_off_IX_IY_d    , 0                                 , "LD   H,RES  1, (IY + %O)") \
+	OP(FDCB, 0x8d, LD_L_RES_1_off_IX_IY_d    , 0                                 , "LD   L,RES  1, (IY + %O)") \
+	OP(FDCB, 0x8e, RES_1_off_IX_IY_d         , 0                                 , "RES  1,(IY + %O)") \
+	OP(FDCB, 0x8f, LD_A_RES_1_off_IX_IY_d    , 0                                 , "LD   A,RES  1, (IY + %O)") \
+	OP(FDCB, 0x90, LD_B_RES_2_off_IX_IY_d    , 0                                 , "LD   B,RES  2, (IY + %O)") \
+	OP(FDCB, 0x91, LD_C_RES_2_off_IX_IY_d    , 0                                 , "LD   C,RES  2, (IY + %O)") \
+	OP(FDCB, 0x92, LD_D_RES_2_off_IX_IY_d    , 0                                 , "LD   D,RES  2, (IY + %O)") \
+	OP(FDCB, 0x93, LD_E_RES_2_off_IX_IY_d    , 0                                 , "LD   E,RES  2, (IY + %O)") \
+	OP(FDCB, 0x94, LD_H_RES_2_off_IX_IY_d    , 0                                 , "LD   H,RES  2, (IY + %O)") \
+	OP(FDCB, 0x95, LD_L_RES_2_off_IX_IY_d    , 0                                 , "LD   L,RES  2, (IY + %O)") \
+	OP(FDCB, 0x96, RES_2_off_IX_IY_d         , 0                                 , "RES  2,(IY + %O)") \
+	OP(FDCB, 0x97, LD_A_RES_2_off_IX_IY_d    , 0                                 , "LD   A,RES  2, (IY + %O)") \
+	OP(FDCB, 0x98, LD_B_RES_3_off_IX_IY_d    , 0                                 , "LD   B,RES  3, (IY + %O)") \
+	OP(FDCB, 0x99, LD_C_RES_3_off_IX_IY_d    , 0                                 , "LD   C,RES  3, (IY + %O)") \
+	OP(FDCB, 0x9a, LD_D_RES_3_off_IX_IY_d    , 0                                 , "LD   D,RES  3, (IY + %O)") \
+	OP(FDCB, 0x9b, LD_E_RES_3_off_IX_IY_d    , 0                                 , "LD   E,RES  3, (IY + %O)") \
+	OP(FDCB, 0x9c, LD_H_RES_3_off_IX_IY_d    , 0                                 , "LD   H,RES  3, (IY + %O)") \
+	OP(FDCB, 0x9d, LD_L_RES_3_off_IX_IY_d    , 0                                 , "LD   L,RES  3, (IY + %O)") \
+	OP(FDCB, 0x9e, RES_3_off_IX_IY_d         , 0                                 , "RES  3,(IY + %O)") \
+	OP(FDCB, 0x9f, LD_A_RES_3_off_IX_IY_d    , 0                                 , "LD   A,RES  3, (IY + %O)") \
+	OP(FDCB, 0xa0, LD_B_RES_4_off_IX_IY_d    , 0                                 , "LD   B,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa1, LD_C_RES_4_off_IX_IY_d    , 0                                 , "LD   C,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa2, LD_D_RES_4_off_IX_IY_d    , 0                                 , "LD   D,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa3, LD_E_RES_4_off_IX_IY_d    , 0                                 , "LD   E,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa4, LD_H_RES_4_off_IX_IY_d    , 0                                 , "LD   H,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa5, LD_L_RES_4_off_IX_IY_d    , 0                                 , "LD   L,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa6, RES_4_off_IX_IY_d         , 0                                 , "RES  4,(IY + %O)") \
+	OP(FDCB, 0xa7, LD_A_RES_4_off_IX_IY_d    , 0                                 , "LD   A,RES  4, (IY + %O)") \
+	OP(FDCB, 0xa8, LD_B_RES_5_off_IX_IY_d    , 0                                 , "LD   B,RES 5, (IY + %O)") \
+	OP(FDCB, 0xa9, LD_C_RES_5_off_IX_IY_d    , 0                                 , "LD   C,RES 5, (IY + %O)") \
+	OP(FDCB, 0xaa, LD_D_RES_5_off_IX_IY_d    , 0                                 , "LD   D,RES 5, (IY + %O)") \
+	OP(FDCB, 0xab, LD_E_RES_5_off_IX_IY_d    , 0                                 , "LD   E,RES 5, (IY + %O)") \
+	OP(FDCB, 0xac, LD_H_RES_5_off_IX_IY_d    , 0                                 , "LD   H,RES 5, (IY + %O)") \
+	OP(FDCB, 0xad, LD_L_RES_5_off_IX_IY_d    , 0                                 , "LD   L,RES 5,( IY + %O)") \
+	OP(FDCB, 0xae, RES_5_off_IX_IY_d         , 0                                 , "RES  5,(IY + %O)") \
+	OP(FDCB, 0xaf, LD_A_RES_5_off_IX_IY_d    , 0                                 , "LD   A,RES 5, (IY + %O)") \
+	OP(FDCB, 0xb0, LD_B_RES_6_off_IX_IY_d    , 0                                 , "LD   B,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb1, LD_C_RES_6_off_IX_IY_d    , 0                                 , "LD   C,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb2, LD_D_RES_6_off_IX_IY_d    , 0                                 , "LD   D,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb3, LD_E_RES_6_off_IX_IY_d    , 0                                 , "LD   E,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb4, LD_H_RES_6_off_IX_IY_d    , 0                                 , "LD   H,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb5, LD_L_RES_6_off_IX_IY_d    , 0                                 , "LD   L,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb6, RES_6_off_IX_IY_d         , 0                                 , "RES  6,(IY + %O)") \
+	OP(FDCB, 0xb7, LD_A_RES_6_off_IX_IY_d    , 0                                 , "LD   A,RES 6, (IY + %O)") \
+	OP(FDCB, 0xb8, LD_B_RES_7_off_IX_IY_d    , 0                                 , "LD   B,RES 7, (IY + %O)") \
+	OP(FDCB, 0xb9, LD_C_RES_7_off_IX_IY_d    , 0                                 , "LD   C,RES 7, (IY + %O)") \
+	OP(FDCB, 0xba, LD_D_RES_7_off_IX_IY_d    , 0                                 , "LD   D,RES 7, (IY + %O)") \
+	OP(FDCB, 0xbb, LD_E_RES_7_off_IX_IY_d    , 0                                 , "LD   E,RES 7, (IY + %O)") \
+	OP(FDCB, 0xbc, LD_H_RES_7_off_IX_IY_d    , 0                                 , "LD   H,RES 7, (IY + %O)") \
+	OP(FDCB, 0xbd, LD_L_RES_7_off_IX_IY_d    , 0                                 , "LD   L,RES 7, (IY + %O)") \
+	OP(FDCB, 0xbe, RES_7_off_IX_IY_d         , 0                                 , "RES  7,(IY + %O)") \
+	OP(FDCB, 0xbf, LD_A_RES_7_off_IX_IY_d    , 0                                 , "LD   A,RES 7, (IY + %O)") \
+	OP(FDCB, 0xc0, LD_B_SET_0_off_IX_IY_d    , 0                                 , "LD   B,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc1, LD_C_SET_0_off_IX_IY_d    , 0                                 , "LD   C,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc2, LD_D_SET_0_off_IX_IY_d    , 0                                 , "LD   D,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc3, LD_E_SET_0_off_IX_IY_d    , 0                                 , "LD   E,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc4, LD_H_SET_0_off_IX_IY_d    , 0                                 , "LD   H,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc5, LD_L_SET_0_off_IX_IY_d    , 0                                 , "LD   L,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc6, SET_0_off_IX_IY_d         , 0                                 , "SET  0,(IY + %O)") \
+	OP(FDCB, 0xc7, LD_A_SET_0_off_IX_IY_d    , 0                                 , "LD   A,SET 0, (IY + %O)") \
+	OP(FDCB, 0xc8, LD_B_SET_1_off_IX_IY_d    , 0                                 , "LD   B,SET 1, (IY + %O)") \
+	OP(FDCB, 0xc9, LD_C_SET_1_off_IX_IY_d    , 0                                 , "LD   C,SET 1, (IY + %O)") \
+	OP(FDCB, 0xca, LD_D_SET_1_off_IX_IY_d    , 0                                 , "LD   D,SET 1, (IY + %O)") \
+	OP(FDCB, 0xcb, LD_E_SET_1_off_IX_IY_d    , 0                                 , "LD   E,SET 1, (IY + %O)") \
+	OP(FDCB, 0xcc, LD_H_SET_1_off_IX_IY_d    , 0                                 , "LD   H,SET 1, (IY + %O)") \
+	OP(FDCB, 0xcd, LD_L_SET_1_off_IX_IY_d    , 0                                 , "LD   L,SET 1, (IY + %O)") \
+	OP(FDCB, 0xce, SET_1_off_IX_IY_d         , 0                                 , "SET 1,(IY + %O)") \
+	OP(FDCB, 0xcf, LD_A_SET_1_off_IX_IY_d    , 0                                 , "LD   A,SET 1, (IY + %O)") \
+	OP(FDCB, 0xd0, LD_B_SET_2_off_IX_IY_d    , 0                                 , "LD   B,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd1, LD_C_SET_2_off_IX_IY_d    , 0                                 , "LD   C,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd2, LD_D_SET_2_off_IX_IY_d    , 0                                 , "LD   D,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd3, LD_E_SET_2_off_IX_IY_d    , 0                                 , "LD   E,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd4, LD_H_SET_2_off_IX_IY_d    , 0                                 , "LD   H,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd5, LD_L_SET_2_off_IX_IY_d    , 0                                 , "LD   L,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd6, SET_2_off_IX_IY_d         , 0                                 , "SET  2,(IY + %O)") \
+	OP(FDCB, 0xd7, LD_A_SET_2_off_IX_IY_d    , 0                                 , "LD   A,SET 2, (IY + %O)") \
+	OP(FDCB, 0xd8, LD_B_SET_3_off_IX_IY_d    , 0                                 , "LD   B,SET 3, (IY + %O)") \
+	OP(FDCB, 0xd9, LD_C_SET_3_off_IX_IY_d    , 0                                 , "LD   C,SET 3, (IY + %O)") \
+	OP(FDCB, 0xda, LD_D_SET_3_off_IX_IY_d    , 0                                 , "LD   D,SET 3, (IY + %O)") \
+	OP(FDCB, 0xdb, LD_E_SET_3_off_IX_IY_d    , 0                                 , "LD   E,SET 3, (IY + %O)") \
+	OP(FDCB, 0xdc, LD_H_SET_3_off_IX_IY_d    , 0                                 , "LD   H,SET 3, (IY + %O)") \
+	OP(FDCB, 0xdd, LD_L_SET_3_off_IX_IY_d    , 0                                 , "LD   L,SET 3, (IY + %O)") \
+	OP(FDCB, 0xde, SET_3_off_IX_IY_d         , 0                                 , "SET  3,(IY + %O)") \
+	OP(FDCB, 0xdf, LD_A_SET_3_off_IX_IY_d    , 0                                 , "LD   A,SET 3, (IY + %O)") \
+	OP(FDCB, 0xe0, LD_B_SET_4_off_IX_IY_d    , 0                                 , "LD   B,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe1, LD_C_SET_4_off_IX_IY_d    , 0                                 , "LD   C,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe2, LD_D_SET_4_off_IX_IY_d    , 0                                 , "LD   D,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe3, LD_E_SET_4_off_IX_IY_d    , 0                                 , "LD   E,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe4, LD_H_SET_4_off_IX_IY_d    , 0                                 , "LD   H,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe5, LD_L_SET_4_off_IX_IY_d    , 0                                 , "LD   L,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe6, SET_4_off_IX_IY_d         , 0                                 , "SET  4,(IY + %O)") \
+	OP(FDCB, 0xe7, LD_A_SET_4_off_IX_IY_d    , 0                                 , "LD   A,SET 4, (IY + %O)") \
+	OP(FDCB, 0xe8, LD_B_SET_5_off_IX_IY_d    , 0                                 , "LD   B,SET 5, (IY + %O)") \
+	OP(FDCB, 0xe9, LD_C_SET_5_off_IX_IY_d    , 0                                 , "LD   C,SET 5, (IY + %O)") \
+	OP(FDCB, 0xea, LD_D_SET_5_off_IX_IY_d    , 0                                 , "LD   D,SET 5, (IY + %O)") \
+	OP(FDCB, 0xeb, LD_E_SET_5_off_IX_IY_d    , 0                                 , "LD   E,SET 5, (IY + %O)") \
+	OP(FDCB, 0xec, LD_H_SET_5_off_IX_IY_d    , 0                                 , "LD   H,SET 5, (IY + %O)") \
+	OP(FDCB, 0xed, LD_L_SET_5_off_IX_IY_d    , 0                                 , "LD   L,SET 5, (IY + %O)") \
+	OP(FDCB, 0xee, SET_5_off_IX_IY_d         , 0                                 , "SET  5,(IY + %O)") \
+	OP(FDCB, 0xef, LD_A_SET_5_off_IX_IY_d    , 0                                 , "LD   A,SET 5, (IY + %O)") \
+	OP(FDCB, 0xf0, LD_B_SET_6_off_IX_IY_d    , 0                                 , "LD   B,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf1, LD_C_SET_6_off_IX_IY_d    , 0                                 , "LD   C,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf2, LD_D_SET_6_off_IX_IY_d    , 0                                 , "LD   D,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf3, LD_E_SET_6_off_IX_IY_d    , 0                                 , "LD   E,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf4, LD_H_SET_6_off_IX_IY_d    , 0                                 , "LD   H,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf5, LD_L_SET_6_off_IX_IY_d    , 0                                 , "LD   L,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf6, SET_6_off_IX_IY_d         , 0                                 , "SET  6,(IY + %O)") \
+	OP(FDCB, 0xf7, LD_A_SET_6_off_IX_IY_d    , 0                                 , "LD   A,SET 6, (IY + %O)") \
+	OP(FDCB, 0xf8, LD_B_SET_7_off_IX_IY_d    , 0                                 , "LD   B,SET 7, (IY + %O)") \
+	OP(FDCB, 0xf9, LD_C_SET_7_off_IX_IY_d    , 0                                 , "LD   C,SET 7, (IY + %O)") \
+	OP(FDCB, 0xfa, LD_D_SET_7_off_IX_IY_d    , 0                                 , "LD   D,SET 7, (IY + %O)") \
+	OP(FDCB, 0xfb, LD_E_SET_7_off_IX_IY_d    , 0                                 , "LD   E,SET 7, (IY + %O)") \
+	OP(FDCB, 0xfc, LD_H_SET_7_off_IX_IY_d    , 0                                 , "LD   H,SET 7, (IY + %O)") \
+	OP(FDCB, 0xfd, LD_L_SET_7_off_IX_IY_d    , 0                                 , "LD   L,SET 7, (IY + %O)") \
+	OP(FDCB, 0xfe, SET_7_off_IX_IY_d         , 0                                 , "SET  7,(IY + %O)") \
+	OP(FDCB, 0xff, LD_A_SET_7_off_IX_IY_d    , 0                                 , "LD   A,SET 7, (IY + %O)") \
+
+//-----------------------------------------------------------------------------------------
+
+#endif
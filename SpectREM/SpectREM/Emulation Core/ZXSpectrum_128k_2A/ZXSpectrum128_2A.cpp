@@ -7,6 +7,7 @@
 //
 
 #include "ZXSpectrum128_2A.hpp"
+#include "../Z80_Core/Z80CoreImpl.h"
 
 #include <iostream>
 #include <fstream>
@@ -20,10 +21,14 @@ static const char *cDEFAULT_ROM_0 = "plus3-41-0.rom";
 static const char *cDEFAULT_ROM_1 = "plus3-41-1.rom";
 static const char *cDEFAULT_ROM_2 = "plus3-41-2.rom";
 static const char *cDEFAULT_ROM_3 = "plus3-41-3.rom";
+
+// RAM pages 4 - 7 are contended on the +2A/+3
+static const bool cRAM_PAGE_CONTENDED[8] = { false, false, false, false, true, true, true, true };
+
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Destructor
 
-ZXSpectrum128_2A::ZXSpectrum128_2A(Tape *t) : ZXSpectrum()
+ZXSpectrum128_2A::ZXSpectrum128_2A(Tape *t) : ZXSpectrum(z80Core128_2A), z80Core128_2A(ZXSpectrum128_2ABus{ this })
 {
     std::cout << "ZXSpectrum128_2A::Constructor" << "\n";
     if (t)
@@ -53,8 +58,8 @@ void ZXSpectrum128_2A::initialise(std::string romPath)
     
     machineInfo = machines[ eZXSpectrum128_2A ];
     ZXSpectrum::initialise(romPath);
-    z80Core.setCPUMan(CZ80Core::eCPUMAN_Zilog);
-    z80Core.setCPUType(CZ80Core::eCPUTYPE_NMOS);
+    z80Core.setCPUMan(CZ80CoreBase::eCPUMAN_Zilog);
+    z80Core.setCPUType(CZ80CoreBase::eCPUTYPE_NMOS);
 
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
@@ -67,11 +72,12 @@ void ZXSpectrum128_2A::initialise(std::string romPath)
 
     emuROMNumber = 0;
     emuRAMPage = 0;
-    emuSpecialPagingMode = true;
+    emuSpecialPagingMode = false;
     emuDisplayPage = 5;
     emuDisablePaging = false;
     ULAPort7FFDValue = 0;
 
+    memoryMapUpdate();
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -80,13 +86,7 @@ void ZXSpectrum128_2A::initialise(std::string romPath)
 
 uint8_t ZXSpectrum128_2A::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 5 || (memoryPage == 3 && (emuRAMPage == 4 || emuRAMPage == 5 || emuRAMPage == 6 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
     
     ZXSpectrum::ULAApplyIOContention(address, contended);
     
@@ -132,7 +132,7 @@ uint8_t ZXSpectrum128_2A::coreIORead(uint16_t address)
         }
     }
 
-    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapePlayer->inputBit << 6));
+    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapeLevel() << 6));
     
     return result;
 }
@@ -141,15 +141,12 @@ uint8_t ZXSpectrum128_2A::coreIORead(uint16_t address)
 
 void ZXSpectrum128_2A::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 5 || (memoryPage == 3 && (emuRAMPage == 4 || emuRAMPage == 5 || emuRAMPage == 6 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
 
     ZXSpectrum::ULAApplyIOContention(address, contended);
+
+    // Bring the audio output up to date before this write can change the beeper, AY or SpecDRUM levels
+    audioCatchUp();
     
     // Port: 0xFE
     //   7   6   5   4   3   2   1   0
@@ -211,6 +208,8 @@ void ZXSpectrum128_2A::updatePort7FFD(uint8_t data)
     updateROMNumber();
     emuRAMPage = (data & 0x07);
     emuDisplayPage = ((data & 0x08) == 0x08) ? 7 : 5;
+
+    memoryMapUpdate();
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -238,7 +237,8 @@ void ZXSpectrum128_2A::updatePort1FFD(uint8_t data)
     {
         emuPagingMode = (data & 0x06) >> 1;
     }
-    
+
+    memoryMapUpdate();
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -248,124 +248,82 @@ void ZXSpectrum128_2A::updateROMNumber()
     emuROMNumber = emuROMHiBit | emuROMLoBit;
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Memory Map
+
+void ZXSpectrum128_2A::memoryMapUpdate()
+{
+    if (emuSpecialPagingMode)
+    {
+        // All RAM configurations selected by bits 1 and 2 of port 0x1FFD
+        static const uint8_t cSPECIAL_PAGING[4][4] = {
+            { 0, 1, 2, 3 },
+            { 4, 5, 6, 7 },
+            { 4, 5, 6, 3 },
+            { 4, 7, 6, 3 }
+        };
+
+        for (uint32_t slot = 0; slot < 4; slot++)
+        {
+            const uint8_t page = cSPECIAL_PAGING[emuPagingMode][slot];
+            memoryMapRAM(slot, page, cRAM_PAGE_CONTENDED[page]);
+        }
+        return;
+    }
+
+    memoryMapROM(0, emuROMNumber);
+    memoryMapRAM(1, 5, cRAM_PAGE_CONTENDED[5]);
+    memoryMapRAM(2, 2, cRAM_PAGE_CONTENDED[2]);
+    memoryMapRAM(3, emuRAMPage, cRAM_PAGE_CONTENDED[emuRAMPage]);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Memory Read/Write
 
 void ZXSpectrum128_2A::coreMemoryWrite(uint16_t address, uint8_t data)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    switch (page) {
-        case 0:
-            return;
-            break;
-            
-        case 1:
-            displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset);
-            memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        case 2:
-            memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        case 3:
-            memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        default:
-            break;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
+    address &= (cMEMORY_PAGE_SIZE - 1);
+
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
+    {
+        memoryUnshareSlot(slot);
     }
+
+    if ((memoryPageFlags[slot] & cMEMORY_PAGE_SCREEN) && address < cBITMAP_SIZE + cATTR_SIZE)
+    {
+        displayUpdateForScreenWrite(address);
+    }
+
+    memoryWritePages[slot][address] = data;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128_2A::coreMemoryRead(uint16_t address)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    switch (page) {
-        case 0:
-            return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 1:
-            return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 2:
-            return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 3:
-            return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        default:
-            return 0;
-            break;
-    }
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 // ------------------------------------------------------------------------------------------------------------
 // - Debug Memory Read/Write
 
 void ZXSpectrum128_2A::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
     
-    switch (page) {
-        case 0:
-            return;
-            break;
-            
-        case 1:
-            memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        case 2:
-            memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        case 3:
-            memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        default:
-            break;
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
+    {
+        memoryUnshareSlot(slot);
     }
+    
+    memoryWritePages[slot][address & (cMEMORY_PAGE_SIZE - 1)] = byte;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128_2A::coreDebugRead(uint16_t address, void *)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-    
-    switch (page) {
-        case 0:
-            return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 1:
-            return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 2:
-            return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 3:
-            return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        default:
-            return 0;
-            break;
-    }
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -373,15 +331,20 @@ uint8_t ZXSpectrum128_2A::coreDebugRead(uint16_t address, void *)
 
 void ZXSpectrum128_2A::coreMemoryContention(uint16_t address, uint32_t)
 {
-    const uint32_t memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (memoryPage == 5 || (memoryPage == 3 &&
-          (emuRAMPage == 4 || emuRAMPage == 5 || emuRAMPage == 6 || emuRAMPage == 7)))
+    if (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED)
     {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates()] );
     }
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Fork
+
+ZXSpectrum *ZXSpectrum128_2A::forkInstance(Tape *tape)
+{
+    return new ZXSpectrum128_2A(tape);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Release/Reset
 
@@ -393,10 +356,15 @@ void ZXSpectrum128_2A::release()
 void ZXSpectrum128_2A::resetMachine(bool hard)
 {
     emuROMNumber = 0;
+    emuROMHiBit = 0;
+    emuROMLoBit = 0;
     emuRAMPage = 0;
     emuDisplayPage = 5;
     emuDisablePaging = false;
+    emuSpecialPagingMode = false;
+    emuPagingMode = 0;
     ULAPort7FFDValue = 0;
+    ULAPort1FFDValue = 0;
     ZXSpectrum::resetMachine(hard);
 }
 
@@ -430,8 +398,52 @@ bool ZXSpectrum128_2A::opcodeCallback(uint8_t opcode, uint16_t address, void *pa
         }
     }
     
+    // Run custom and turbo loaders forward to the next edge on the tape
+    if (machine->emuTapeFlashLoad && machine->tapePlayer && machine->tapePlayer->playing)
+    {
+        machine->tapeLoaderOpcode(opcode, address);
+    }
+
     machine->emuSaveTrapTriggered = false;
     machine->emuLoadTrapTriggered = false;
     
     return false;
 }
+
+// ------------------------------------------------------------------------------------------------------------
+// - Z80 Core
+
+uint8_t ZXSpectrum128_2ABus::Read(uint16_t address)
+{
+    return machine->ZXSpectrum128_2A::coreMemoryRead(address);
+}
+
+void ZXSpectrum128_2ABus::Write(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128_2A::coreMemoryWrite(address, data);
+}
+
+uint8_t ZXSpectrum128_2ABus::IORead(uint16_t address)
+{
+    return machine->ZXSpectrum128_2A::coreIORead(address);
+}
+
+void ZXSpectrum128_2ABus::IOWrite(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128_2A::coreIOWrite(address, data);
+}
+
+void ZXSpectrum128_2ABus::Contention(uint16_t address, uint32_t tStates)
+{
+    machine->ZXSpectrum128_2A::coreMemoryContention(address, tStates);
+}
+
+template class CZ80Core<ZXSpectrum128_2ABus>;
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t ZXSpectrum128_2A::coreExecute(uint32_t numTStates, uint32_t intTStates)
+{
+    return z80Core128_2A.Execute(numTStates, intTStates);
+}
+
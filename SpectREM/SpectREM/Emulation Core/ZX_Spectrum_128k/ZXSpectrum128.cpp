@@ -7,6 +7,7 @@
 //
 
 #include "ZXSpectrum128.hpp"
+#include "../Z80_Core/Z80CoreImpl.h"
 
 #include <iostream>
 #include <fstream>
@@ -18,10 +19,13 @@
 static const char *cDEFAULT_ROM_0 = "128-0.ROM";
 static const char *cDEFAULT_ROM_1 = "128-1.ROM";
 
+// Odd RAM pages are contended on the 128k
+static const bool cRAM_PAGE_CONTENDED[8] = { false, true, false, true, false, true, false, true };
+
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Destructor
 
-ZXSpectrum128::ZXSpectrum128(Tape *t) : ZXSpectrum()
+ZXSpectrum128::ZXSpectrum128(Tape *t) : ZXSpectrum(z80Core128), z80Core128(ZXSpectrum128Bus{ this })
 {
     std::cout << "ZXSpectrum128::Constructor" << "\n";
     if (t)
@@ -51,8 +55,8 @@ void ZXSpectrum128::initialise(std::string romPath)
     
     machineInfo = machines[ eZXSpectrum128 ];
     ZXSpectrum::initialise(romPath);
-    z80Core.setCPUMan(CZ80Core::eCPUMAN_Zilog);
-    z80Core.setCPUType(CZ80Core::eCPUTYPE_NMOS);
+    z80Core.setCPUMan(CZ80CoreBase::eCPUMAN_Zilog);
+    z80Core.setCPUType(CZ80CoreBase::eCPUTYPE_NMOS);
 
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
@@ -74,13 +78,7 @@ void ZXSpectrum128::initialise(std::string romPath)
 
 uint8_t ZXSpectrum128::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
     
     ZXSpectrum::ULAApplyIOContention(address, contended);
     
@@ -130,7 +128,7 @@ uint8_t ZXSpectrum128::coreIORead(uint16_t address)
         }
     }
 
-    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapePlayer->inputBit << 6));
+    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapeLevel() << 6));
     
     return result;
 }
@@ -139,15 +137,12 @@ uint8_t ZXSpectrum128::coreIORead(uint16_t address)
 
 void ZXSpectrum128::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
 
     ZXSpectrum::ULAApplyIOContention(address, contended);
+
+    // Bring the audio output up to date before this write can change the beeper, AY or SpecDRUM levels
+    audioCatchUp();
     
     // Port: 0xFE
     //   7   6   5   4   3   2   1   0
@@ -202,60 +197,46 @@ void ZXSpectrum128::updatePort7FFD(uint8_t data)
     emuROMNumber = ((data & 0x10) == 0x10) ? 1 : 0;
     emuRAMPage = (data & 0x07);
     emuDisplayPage = ((data & 0x08) == 0x08) ? 7 : 5;
-    
+
+    memoryMapUpdate();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Memory Map
+
+void ZXSpectrum128::memoryMapUpdate()
+{
+    memoryMapROM(0, emuROMNumber);
+    memoryMapRAM(1, 5, cRAM_PAGE_CONTENDED[5]);
+    memoryMapRAM(2, 2, cRAM_PAGE_CONTENDED[2]);
+    memoryMapRAM(3, emuRAMPage, cRAM_PAGE_CONTENDED[emuRAMPage]);
 }
 
 // - Memory Read/Write
 
 void ZXSpectrum128::coreMemoryWrite(uint16_t address, uint8_t data)
 {
-    const uint32_t memoryPage = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
+    address &= (cMEMORY_PAGE_SIZE - 1);
 
-    if (memoryPage == 0)
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
     {
-        return;
+        memoryUnshareSlot(slot);
     }
-    else if (memoryPage == 1)
-    {
-        displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset);
-        memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = data;
-    }
-    else if (memoryPage == 2)
-    {
-        memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = data;
-    }
-    else if (memoryPage == 3)
+
+    if ((memoryPageFlags[slot] & cMEMORY_PAGE_SCREEN) && address < cBITMAP_SIZE + cATTR_SIZE)
     {
-        memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = data;
+        displayUpdateForScreenWrite(address);
     }
+
+    memoryWritePages[slot][address] = data;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128::coreMemoryRead(uint16_t address)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    if (page == 0)
-    {
-        return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 1)
-    {
-        return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 2)
-    {
-        return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 3)
-    {
-        return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    
-    return 0;
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -263,52 +244,21 @@ uint8_t ZXSpectrum128::coreMemoryRead(uint16_t address)
 
 void ZXSpectrum128::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
-    const uint32_t memoryPage = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
     
-    if (memoryPage == 0)
-    {
-        return;
-    }
-    else if (memoryPage == 1)
-    {
-        memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = byte;
-    }
-    else if (memoryPage == 2)
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
     {
-        memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = byte;
-    }
-    else if (memoryPage == 3)
-    {
-        memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = byte;
+        memoryUnshareSlot(slot);
     }
+    
+    memoryWritePages[slot][address & (cMEMORY_PAGE_SIZE - 1)] = byte;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128::coreDebugRead(uint16_t address, void *)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-    
-    if (page == 0)
-    {
-        return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 1)
-    {
-        return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 2)
-    {
-        return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 3)
-    {
-        return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    
-    return 0;
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -316,16 +266,20 @@ uint8_t ZXSpectrum128::coreDebugRead(uint16_t address, void *)
 
 void ZXSpectrum128::coreMemoryContention(uint16_t address, uint32_t)
 {
-    const uint32_t memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (memoryPage == 1 ||
-        (memoryPage == 3 &&
-          (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7)))
+    if (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED)
     {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates()] );
     }
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Fork
+
+ZXSpectrum *ZXSpectrum128::forkInstance(Tape *tape)
+{
+    return new ZXSpectrum128(tape);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Release/Reset
 
@@ -374,12 +328,52 @@ bool ZXSpectrum128::opcodeCallback(uint8_t opcode, uint16_t address, void *param
         }
     }
     
+    // Run custom and turbo loaders forward to the next edge on the tape
+    if (machine->emuTapeFlashLoad && machine->tapePlayer && machine->tapePlayer->playing)
+    {
+        machine->tapeLoaderOpcode(opcode, address);
+    }
+
     machine->emuSaveTrapTriggered = false;
     machine->emuLoadTrapTriggered = false;
     
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Z80 Core
+
+uint8_t ZXSpectrum128Bus::Read(uint16_t address)
+{
+    return machine->ZXSpectrum128::coreMemoryRead(address);
+}
+
+void ZXSpectrum128Bus::Write(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128::coreMemoryWrite(address, data);
+}
 
+uint8_t ZXSpectrum128Bus::IORead(uint16_t address)
+{
+    return machine->ZXSpectrum128::coreIORead(address);
+}
 
+void ZXSpectrum128Bus::IOWrite(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128::coreIOWrite(address, data);
+}
+
+void ZXSpectrum128Bus::Contention(uint16_t address, uint32_t tStates)
+{
+    machine->ZXSpectrum128::coreMemoryContention(address, tStates);
+}
+
+template class CZ80Core<ZXSpectrum128Bus>;
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t ZXSpectrum128::coreExecute(uint32_t numTStates, uint32_t intTStates)
+{
+    return z80Core128.Execute(numTStates, intTStates);
+}
 
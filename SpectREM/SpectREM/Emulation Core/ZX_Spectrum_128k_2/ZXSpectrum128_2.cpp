@@ -7,6 +7,7 @@
 //
 
 #include "ZXSpectrum128_2.hpp"
+#include "../Z80_Core/Z80CoreImpl.h"
 
 #include <iostream>
 #include <fstream>
@@ -17,10 +18,14 @@
 //static const int cROM_SIZE = 16384;
 static const char *cDEFAULT_ROM_0 = "plus2-0.ROM";
 static const char *cDEFAULT_ROM_1 = "plus2-1.ROM";
+
+// Odd RAM pages are contended on the 128k
+static const bool cRAM_PAGE_CONTENDED[8] = { false, true, false, true, false, true, false, true };
+
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Destructor
 
-ZXSpectrum128_2::ZXSpectrum128_2(Tape *t) : ZXSpectrum()
+ZXSpectrum128_2::ZXSpectrum128_2(Tape *t) : ZXSpectrum(z80Core128_2), z80Core128_2(ZXSpectrum128_2Bus{ this })
 {
     std::cout << "ZXSpectrum128_2::Constructor" << "\n";
     if (t)
@@ -50,8 +55,8 @@ void ZXSpectrum128_2::initialise(std::string romPath)
     
     machineInfo = machines[ eZXSpectrum128_2 ];
     ZXSpectrum::initialise(romPath);
-    z80Core.setCPUMan(CZ80Core::eCPUMAN_Zilog);
-    z80Core.setCPUType(CZ80Core::eCPUTYPE_NMOS);
+    z80Core.setCPUMan(CZ80CoreBase::eCPUMAN_Zilog);
+    z80Core.setCPUType(CZ80CoreBase::eCPUTYPE_NMOS);
 
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
@@ -74,13 +79,7 @@ void ZXSpectrum128_2::initialise(std::string romPath)
 
 uint8_t ZXSpectrum128_2::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
     
     ZXSpectrum::ULAApplyIOContention(address, contended);
     
@@ -130,7 +129,7 @@ uint8_t ZXSpectrum128_2::coreIORead(uint16_t address)
         }
     }
 
-    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapePlayer->inputBit << 6));
+    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapeLevel() << 6));
     
     return result;
 }
@@ -139,15 +138,12 @@ uint8_t ZXSpectrum128_2::coreIORead(uint16_t address)
 
 void ZXSpectrum128_2::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
 
     ZXSpectrum::ULAApplyIOContention(address, contended);
+
+    // Bring the audio output up to date before this write can change the beeper, AY or SpecDRUM levels
+    audioCatchUp();
     
     // Port: 0xFE
     //   7   6   5   4   3   2   1   0
@@ -202,7 +198,19 @@ void ZXSpectrum128_2::updatePort7FFD(uint8_t data)
     emuROMNumber = ((data & 0x10) == 0x10) ? 1 : 0;
     emuRAMPage = (data & 0x07);
     emuDisplayPage = ((data & 0x08) == 0x08) ? 7 : 5;
-    
+
+    memoryMapUpdate();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Memory Map
+
+void ZXSpectrum128_2::memoryMapUpdate()
+{
+    memoryMapROM(0, emuROMNumber);
+    memoryMapRAM(1, 5, cRAM_PAGE_CONTENDED[5]);
+    memoryMapRAM(2, 2, cRAM_PAGE_CONTENDED[2]);
+    memoryMapRAM(3, emuRAMPage, cRAM_PAGE_CONTENDED[emuRAMPage]);
 }
     
 // ------------------------------------------------------------------------------------------------------------
@@ -210,60 +218,27 @@ void ZXSpectrum128_2::updatePort7FFD(uint8_t data)
 
 void ZXSpectrum128_2::coreMemoryWrite(uint16_t address, uint8_t data)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    switch (page) {
-        case 0:
-            return;
-            break;
-            
-        case 1:
-            displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset);
-            memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        case 2:
-            memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        case 3:
-            memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = data;
-            break;
-            
-        default:
-            break;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
+    address &= (cMEMORY_PAGE_SIZE - 1);
+
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
+    {
+        memoryUnshareSlot(slot);
+    }
+
+    if ((memoryPageFlags[slot] & cMEMORY_PAGE_SCREEN) && address < cBITMAP_SIZE + cATTR_SIZE)
+    {
+        displayUpdateForScreenWrite(address);
     }
+
+    memoryWritePages[slot][address] = data;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128_2::coreMemoryRead(uint16_t address)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    switch (page) {
-        case 0:
-            return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 1:
-            return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 2:
-            return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 3:
-            return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        default:
-            return 0;
-            break;
-    }
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -271,59 +246,21 @@ uint8_t ZXSpectrum128_2::coreMemoryRead(uint16_t address)
 
 void ZXSpectrum128_2::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
     
-    switch (page) {
-        case 0:
-            return;
-            break;
-            
-        case 1:
-            memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        case 2:
-            memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        case 3:
-            memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = byte;
-            break;
-            
-        default:
-            break;
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
+    {
+        memoryUnshareSlot(slot);
     }
+    
+    memoryWritePages[slot][address & (cMEMORY_PAGE_SIZE - 1)] = byte;
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
 uint8_t ZXSpectrum128_2::coreDebugRead(uint16_t address, void *)
 {
-    const uint32_t page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-    
-    switch (page) {
-        case 0:
-            return (memoryRom[(emuROMNumber * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 1:
-            return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 2:
-            return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        case 3:
-            return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-            break;
-            
-        default:
-            return 0;
-            break;
-    }
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -331,16 +268,20 @@ uint8_t ZXSpectrum128_2::coreDebugRead(uint16_t address, void *)
 
 void ZXSpectrum128_2::coreMemoryContention(uint16_t address, uint32_t)
 {
-    const uint32_t memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (memoryPage == 1 ||
-        (memoryPage == 3 &&
-          (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7)))
+    if (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED)
     {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates()] );
     }
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Fork
+
+ZXSpectrum *ZXSpectrum128_2::forkInstance(Tape *tape)
+{
+    return new ZXSpectrum128_2(tape);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Release/Reset
 
@@ -389,8 +330,52 @@ bool ZXSpectrum128_2::opcodeCallback(uint8_t opcode, uint16_t address, void *par
         }
     }
     
+    // Run custom and turbo loaders forward to the next edge on the tape
+    if (machine->emuTapeFlashLoad && machine->tapePlayer && machine->tapePlayer->playing)
+    {
+        machine->tapeLoaderOpcode(opcode, address);
+    }
+
     machine->emuSaveTrapTriggered = false;
     machine->emuLoadTrapTriggered = false;
     
     return false;
 }
+
+// ------------------------------------------------------------------------------------------------------------
+// - Z80 Core
+
+uint8_t ZXSpectrum128_2Bus::Read(uint16_t address)
+{
+    return machine->ZXSpectrum128_2::coreMemoryRead(address);
+}
+
+void ZXSpectrum128_2Bus::Write(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128_2::coreMemoryWrite(address, data);
+}
+
+uint8_t ZXSpectrum128_2Bus::IORead(uint16_t address)
+{
+    return machine->ZXSpectrum128_2::coreIORead(address);
+}
+
+void ZXSpectrum128_2Bus::IOWrite(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum128_2::coreIOWrite(address, data);
+}
+
+void ZXSpectrum128_2Bus::Contention(uint16_t address, uint32_t tStates)
+{
+    machine->ZXSpectrum128_2::coreMemoryContention(address, tStates);
+}
+
+template class CZ80Core<ZXSpectrum128_2Bus>;
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t ZXSpectrum128_2::coreExecute(uint32_t numTStates, uint32_t intTStates)
+{
+    return z80Core128_2.Execute(numTStates, intTStates);
+}
+
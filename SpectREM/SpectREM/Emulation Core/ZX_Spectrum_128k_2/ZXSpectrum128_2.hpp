@@ -11,6 +11,21 @@
 
 #include "../ZX_Spectrum_Core/ZXSpectrum.hpp"
 
+class ZXSpectrum128_2;
+
+// Bus given to the Z80 core. Calls go straight to the ZXSpectrum128_2 handlers rather than through the virtual
+// core functions so the compiler can inline them into the opcodes
+struct ZXSpectrum128_2Bus
+{
+    ZXSpectrum128_2 *machine;
+
+    uint8_t                 Read(uint16_t address);
+    void                    Write(uint16_t address, uint8_t data);
+    uint8_t                 IORead(uint16_t address);
+    void                    IOWrite(uint16_t address, uint8_t data);
+    void                    Contention(uint16_t address, uint32_t tStates);
+};
+
 class ZXSpectrum128_2 : public ZXSpectrum
 {
     
@@ -23,6 +38,9 @@ public:
     virtual void            release() override;
     virtual void            resetMachine(bool hard = true) override;
 
+    virtual uint32_t        coreExecute(uint32_t numTStates, uint32_t intTStates) override;
+    virtual void            memoryMapUpdate() override;
+
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) override;
     virtual uint8_t         coreMemoryRead(uint16_t address) override;
     virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) override;
@@ -33,6 +51,9 @@ public:
     virtual void            coreDebugWrite(uint16_t address, uint8_t byte, void *data) override;
     
     static bool             opcodeCallback(uint8_t opcode, uint16_t address, void *param);
+    virtual ZXSpectrum      *forkInstance(Tape *tape) override;
+
+    CZ80Core<ZXSpectrum128_2Bus> z80Core128_2;
 
     void                    updatePort7FFD(uint8_t data);
     
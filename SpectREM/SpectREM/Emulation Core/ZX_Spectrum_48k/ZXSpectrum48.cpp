@@ -7,6 +7,7 @@
 //
 
 #include "ZXSpectrum48.hpp"
+#include "../Z80_Core/Z80CoreImpl.h"
 
 #include <iostream>
 #include <fstream>
@@ -21,15 +22,12 @@ static const char *cDEFAULT_ROM = "48.ROM";
 // SmartCard ROM and sundries
 static const uint8_t cFAFB_ROM_SWITCHOUT = 0x40;
 static const uint8_t cFAF3_SRAM_ENABLE = 0x80;
-
-static uint8_t smartCardPortFAF3 = 0;
-static uint8_t smartCardPortFAFB = 0;
-static uint8_t smartCardSRAM[8 * 64 * 1024];		// 8 * 8k banks, mapped @ $2000-$3FFF
+static const uint32_t cSMART_CARD_SRAM_SIZE = 8 * 8192;		// 8 * 8k banks, mapped @ $2000-$3FFF
 
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Destructor
 
-ZXSpectrum48::ZXSpectrum48(Tape *t) : ZXSpectrum()
+ZXSpectrum48::ZXSpectrum48(Tape *t) : ZXSpectrum(z80Core48), z80Core48(ZXSpectrum48Bus{ this })
 {
     std::cout << "ZXSpectrum48::Constructor" << "\n";
     if (t)
@@ -59,8 +57,8 @@ void ZXSpectrum48::initialise(std::string romPath)
     
     machineInfo = machines[ eZXSpectrum48 ];
     ZXSpectrum::initialise( romPath );
-    z80Core.setCPUMan(CZ80Core::eCPUMAN_Zilog);
-    z80Core.setCPUType(CZ80Core::eCPUTYPE_NMOS);
+    z80Core.setCPUMan(CZ80CoreBase::eCPUMAN_Zilog);
+    z80Core.setCPUType(CZ80CoreBase::eCPUTYPE_NMOS);
 
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
@@ -74,12 +72,7 @@ void ZXSpectrum48::initialise(std::string romPath)
 
 uint8_t ZXSpectrum48::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    if (memoryPage == 1)
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
     
     ZXSpectrum::ULAApplyIOContention(address, contended);
         
@@ -133,7 +126,7 @@ uint8_t ZXSpectrum48::coreIORead(uint16_t address)
         }
     }
     
-    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapePlayer->inputBit << 6));
+    result = static_cast<uint8_t>((result & 191) | (audioEarBit << 6) | (tapeLevel() << 6));
     
     return result;
 }
@@ -142,15 +135,13 @@ uint8_t ZXSpectrum48::coreIORead(uint16_t address)
 
 void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    if (memoryPage == 1)
-    {
-        contended = true;
-    }
+    const bool contended = (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED) != 0;
     
     ZXSpectrum::ULAApplyIOContention(address, contended);
 
+    // Bring the audio output up to date before this write can change the beeper, AY or SpecDRUM levels
+    audioCatchUp();
+
     // ULA owned ports
     if (!(address & 0x01))
     {
@@ -191,6 +182,12 @@ void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
 		if(address == 0xfaf3)
 		{
 			smartCardPortFAF3 = data;
+
+			// The SRAM is only allocated once something enables it
+			if ((data & cFAF3_SRAM_ENABLE) && smartCardSRAM.empty())
+			{
+				smartCardSRAM.resize(cSMART_CARD_SRAM_SIZE);
+			}
 		}
 		else if(address == 0xfafb)
 		{
@@ -199,6 +196,17 @@ void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
 	}
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Memory Map
+
+void ZXSpectrum48::memoryMapUpdate()
+{
+    memoryMapROM(0, 0);
+    memoryMapRAM(1, 1, true);
+    memoryMapRAM(2, 2, false);
+    memoryMapRAM(3, 3, false);
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Memory Read/Write
 
@@ -214,8 +222,15 @@ void ZXSpectrum48::coreMemoryWrite(uint16_t address, uint8_t data)
         return;
     }
     
-    if (address >= cROM_SIZE && address < cBITMAP_ADDRESS + cBITMAP_SIZE + cATTR_SIZE){
-        displayUpdateWithTs(static_cast<int32_t>((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset));
+    const uint32_t slot = address / cMEMORY_PAGE_SIZE;
+    if (memoryPageFlags[slot] & cMEMORY_PAGE_SHARED)
+    {
+        memoryUnshareSlot(slot);
+    }
+
+    if ((memoryPageFlags[slot] & cMEMORY_PAGE_SCREEN) && (address & (cMEMORY_PAGE_SIZE - 1)) < cBITMAP_SIZE + cATTR_SIZE)
+    {
+        displayUpdateForScreenWrite(address & (cMEMORY_PAGE_SIZE - 1));
     }
 
     if (debugOpCallbackBlock != nullptr)
@@ -228,7 +243,7 @@ void ZXSpectrum48::coreMemoryWrite(uint16_t address, uint8_t data)
     
     breakpointHit = false;
 
-    memoryRam[ address ] = static_cast<char>(data);
+    memoryWritePages[slot][address & (cMEMORY_PAGE_SIZE - 1)] = data;
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -247,8 +262,8 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
 			{
                 smartCardPortFAFB &= ~cFAFB_ROM_SWITCHOUT;
                 smartCardPortFAF3 &= ~cFAF3_SRAM_ENABLE;
-                uint8_t retOpCode = static_cast<uint8_t>(memoryRom[ address ]);
-                loadROM( cDEFAULT_ROM, 0 );
+                uint8_t retOpCode = memoryRomRead(address);
+                smartCardSelectDefaultROM();
 				return retOpCode;
 			}
 		}
@@ -262,7 +277,7 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
         }
 
         breakpointHit = false;
-        return static_cast<uint8_t>(memoryRom[address]);
+        return memoryRomRead(address);
     }
 
     if (debugOpCallbackBlock != nullptr)
@@ -270,7 +285,7 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
         debugOpCallbackBlock( address, E_DEBUGOPERATION::READ );
     }
 
-    return static_cast<uint8_t>(memoryRam[ address ]);
+    return memoryReadPages[address / cMEMORY_PAGE_SIZE][address & (cMEMORY_PAGE_SIZE - 1)];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -280,10 +295,10 @@ uint8_t ZXSpectrum48::coreDebugRead(uint16_t address, void *)
 {
     if (address < cROM_SIZE)
     {
-        return static_cast<uint8_t>(memoryRom[address]);
+        return memoryRomRead(address);
     }
     
-    return static_cast<uint8_t>(memoryRam[address]);
+    return memoryRamRead(address);
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -292,11 +307,11 @@ void ZXSpectrum48::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
     if (address < cROM_SIZE)
     {
-        memoryRom[address] = static_cast<char>(byte);
+        memoryRomPage(0)[address] = byte;
     }
     else
     {
-        memoryRam[address] = static_cast<char>(byte);
+        memoryRamWrite(address, byte);
     }
 }
 
@@ -305,12 +320,84 @@ void ZXSpectrum48::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 
 void ZXSpectrum48::coreMemoryContention(uint16_t address, uint32_t)
 {
-    if (address >= 16384 && address <= 32767)
+    if (memoryPageFlags[address / cMEMORY_PAGE_SIZE] & cMEMORY_PAGE_CONTENDED)
     {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates()] );
     }
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Fork
+
+ZXSpectrum *ZXSpectrum48::forkInstance(Tape *tape)
+{
+    // The smart card's ports come across with the rest of the state, but its SRAM is memory and so is left out
+    ZXSpectrum48 *machine = new ZXSpectrum48(tape);
+    machine->smartCardSRAM = smartCardSRAM;
+    machine->smartCardROM = smartCardROM;
+    return machine;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Save State
+
+void ZXSpectrum48::machineStateTransfer(StateStream &stream)
+{
+    // Retroleum Smart Card
+    stream.field(smartCardPortFAF3);
+    stream.field(smartCardPortFAFB);
+
+    // Only which ROM is in place is saved. The default one is reloaded and the card's is put back from where it was
+    // kept when the card switched it out
+    uint8_t defaultROM = smartCardROM != nullptr;
+    stream.field(defaultROM);
+    if (stream.loading && !stream.failed)
+    {
+        if (defaultROM && !smartCardROM)
+        {
+            smartCardSelectDefaultROM();
+        }
+        else if (!defaultROM && smartCardROM)
+        {
+            memoryRomPages[ 0 ] = smartCardROM;
+            smartCardROM.reset();
+            memoryMapUpdate();
+        }
+    }
+
+    if (!stream.memory)
+    {
+        return;
+    }
+
+    uint32_t sramSize = static_cast<uint32_t>(smartCardSRAM.size());
+    stream.field(sramSize);
+    if (stream.loading)
+    {
+        if (sramSize > cSMART_CARD_SRAM_SIZE)
+        {
+            stream.failed = true;
+            return;
+        }
+        smartCardSRAM.resize(sramSize);
+    }
+    stream.bytes(smartCardSRAM.data(), smartCardSRAM.size());
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Retroleum Smart Card
+
+void ZXSpectrum48::smartCardSelectDefaultROM()
+{
+    // Whatever ROM was in place is held on to, sharing its page, until a savestate from before the switch asks for it
+    // back or the machine is hard reset
+    if (!smartCardROM)
+    {
+        smartCardROM = memoryRomPages[ 0 ];
+    }
+    loadROM( cDEFAULT_ROM, 0 );
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Release/Reset
 
@@ -328,6 +415,7 @@ void ZXSpectrum48::resetMachine(bool hard)
         // If a hard reset is requested, reload the default ROM and make sure that the smart card
         // ROM switch is disabled along with the smart card SRAM
         loadROM( cDEFAULT_ROM, 0 );
+        smartCardROM.reset();
         smartCardPortFAFB &= ~cFAFB_ROM_SWITCHOUT;
         smartCardPortFAF3 &= ~cFAF3_SRAM_ENABLE;
     }
@@ -366,11 +454,52 @@ bool ZXSpectrum48::opcodeCallback(uint8_t opcode, uint16_t address, void *param)
         }
     }
 
+    // Run custom and turbo loaders forward to the next edge on the tape
+    if (machine->emuTapeFlashLoad && machine->tapePlayer && machine->tapePlayer->playing)
+    {
+        machine->tapeLoaderOpcode(opcode, address);
+    }
+
     machine->emuSaveTrapTriggered = false;
     machine->emuLoadTrapTriggered = false;
 
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Z80 Core
 
+uint8_t ZXSpectrum48Bus::Read(uint16_t address)
+{
+    return machine->ZXSpectrum48::coreMemoryRead(address);
+}
+
+void ZXSpectrum48Bus::Write(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum48::coreMemoryWrite(address, data);
+}
+
+uint8_t ZXSpectrum48Bus::IORead(uint16_t address)
+{
+    return machine->ZXSpectrum48::coreIORead(address);
+}
+
+void ZXSpectrum48Bus::IOWrite(uint16_t address, uint8_t data)
+{
+    machine->ZXSpectrum48::coreIOWrite(address, data);
+}
+
+void ZXSpectrum48Bus::Contention(uint16_t address, uint32_t tStates)
+{
+    machine->ZXSpectrum48::coreMemoryContention(address, tStates);
+}
+
+template class CZ80Core<ZXSpectrum48Bus>;
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t ZXSpectrum48::coreExecute(uint32_t numTStates, uint32_t intTStates)
+{
+    return z80Core48.Execute(numTStates, intTStates);
+}
 
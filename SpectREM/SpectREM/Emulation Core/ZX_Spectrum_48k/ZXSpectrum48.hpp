@@ -11,6 +11,21 @@
 
 #include "../ZX_Spectrum_Core/ZXSpectrum.hpp"
 
+class ZXSpectrum48;
+
+// Bus given to the Z80 core. Calls go straight to the ZXSpectrum48 handlers rather than through the virtual
+// core functions so the compiler can inline them into the opcodes
+struct ZXSpectrum48Bus
+{
+    ZXSpectrum48 *machine;
+
+    uint8_t                 Read(uint16_t address);
+    void                    Write(uint16_t address, uint8_t data);
+    uint8_t                 IORead(uint16_t address);
+    void                    IOWrite(uint16_t address, uint8_t data);
+    void                    Contention(uint16_t address, uint32_t tStates);
+};
+
 class ZXSpectrum48 : public ZXSpectrum
 {
     
@@ -23,6 +38,9 @@ public:
     virtual void            release() override;
     virtual void            resetMachine(bool hard = true) override;
     
+    virtual uint32_t        coreExecute(uint32_t numTStates, uint32_t intTStates) override;
+    virtual void            memoryMapUpdate() override;
+
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) override;
     virtual uint8_t         coreMemoryRead(uint16_t address) override;
     virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) override;
@@ -33,6 +51,19 @@ public:
     virtual void            coreDebugWrite(uint16_t address, uint8_t byte, void *data) override;
     
     static bool             opcodeCallback(uint8_t opcode, uint16_t address, void *param);
+    virtual ZXSpectrum      *forkInstance(Tape *tape) override;
+    virtual void            machineStateTransfer(StateStream &stream) override;
+
+    CZ80Core<ZXSpectrum48Bus> z80Core48;
+
+private:
+    void                    smartCardSelectDefaultROM();
+
+    // Retroleum Smart Card. smartCardROM holds the card's ROM while it is switched out for the default one
+    uint8_t                 smartCardPortFAF3 = 0;
+    uint8_t                 smartCardPortFAFB = 0;
+    std::vector<uint8_t>    smartCardSRAM;
+    std::shared_ptr<MemoryPage> smartCardROM;
 };
 
 #endif /* ZXSpectrum48_h */
@@ -9,9 +9,27 @@
 #include "ZXSpectrum.hpp"
 #include <math.h>
 #include <iomanip>
+#include <algorithm>
 
 static const float cBEEPER_VOLUME_MULTIPLIER = 8192;
 
+// Largest change a host may make to the number of samples per frame to keep its audio queue at the latency it wants
+static const double cAUDIO_MAX_RATE_ADJUST = 0.01;
+
+// Band-limited steps. Each level change is spread over cBLEP_TAPS output samples using a windowed sinc impulse picked
+// from one of cBLEP_PHASES sub-sample offsets. Integrating the impulses when the frame is rendered gives a step free of
+// the aliasing a hard edge would produce, and because the phase comes from the exact t-state of the edge this also
+// resamples the CPU clock to whatever the host rate is. Output is delayed by half the kernel so every tap lands on a sample
+static const uint32_t cBLEP_TAPS = 16;
+static const uint32_t cBLEP_PHASES = 64;
+static const double cBLEP_CUTOFF = 0.45;
+static const double cBLEP_PI = 3.14159265358979323846;
+
+struct BlepTable
+{
+    float   kernel[ cBLEP_PHASES + 1 ][ cBLEP_TAPS ];
+};
+
 // AY chip envelope flag type
 enum
 {
@@ -38,31 +56,103 @@ void ZXSpectrum::audioBuildAYVolumesTable()
 
 // ------------------------------------------------------------------------------------------------------------
 
-void ZXSpectrum::audioSetup(double sampleRate, double fps)
+static const BlepTable & audioBlepTable()
 {
-    audioBufferSize = static_cast<uint32_t>((sampleRate / fps) * 4.0);
-    audioBuffer = new int16_t[ audioBufferSize ]();
-    audioBeeperTsStep = machineInfo.tsPerFrame / (sampleRate / fps);
+    static const BlepTable table = []
+    {
+        BlepTable blep{};
+        
+        for (uint32_t phase = 0; phase <= cBLEP_PHASES; phase++)
+        {
+            double sum = 0;
+            
+            for (uint32_t tap = 0; tap < cBLEP_TAPS; tap++)
+            {
+                // Distance in samples from the edge to this tap, and where that falls in the Blackman window
+                const double x = static_cast<double>(tap) - (cBLEP_TAPS / 2 - 1) - static_cast<double>(phase) / cBLEP_PHASES;
+                const double w = (x + cBLEP_TAPS / 2) / cBLEP_TAPS;
+                const double window = 0.42 - 0.5 * cos(2 * cBLEP_PI * w) + 0.08 * cos(4 * cBLEP_PI * w);
+                const double sinc = (x == 0) ? 1.0 : sin(2 * cBLEP_PI * cBLEP_CUTOFF * x) / (2 * cBLEP_PI * cBLEP_CUTOFF * x);
+                
+                blep.kernel[ phase ][ tap ] = static_cast<float>(sinc * window);
+                sum += sinc * window;
+            }
+            
+            // Normalise so that every step ends up at exactly the new level
+            for (uint32_t tap = 0; tap < cBLEP_TAPS; tap++)
+            {
+                blep.kernel[ phase ][ tap ] = static_cast<float>(blep.kernel[ phase ][ tap ] / sum);
+            }
+        }
+        
+        return blep;
+    }();
+    
+    return table;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::audioSetup()
+{
+    // Samples per frame come from the real frame rate of the machine rather than a rounded 50Hz. The fractional part is
+    // carried from frame to frame so over time exactly audioSampleRate samples are produced per emulated second
+    audioSetRateAdjustment(audioRateAdjustment);
     audioAYTsStep = 32;
+    
+    const uint32_t maxSamplesPerFrame = static_cast<uint32_t>(audioSampleRate * machineInfo.tsPerFrame / machineInfo.cpuSpeed * (1.0 + cAUDIO_MAX_RATE_ADJUST)) + 1;
+    
+    delete[] audioBuffer;
+    audioBufferSize = maxSamplesPerFrame * 4;
+    audioBuffer = new int16_t[ audioBufferSize ]();
+    
+    // Room for a frame of samples, the kernel tail carried over from the last frame and the instruction that overruns
+    // the end of the frame
+    audioBlepBuffer.assign(maxSamplesPerFrame + cBLEP_TAPS * 2 + 2, 0);
+    audioEdges.reserve(4096);
 }
 
 // ------------------------------------------------------------------------------------------------------------
 
-void ZXSpectrum::audioReset()
+void ZXSpectrum::audioSetSampleRate(double sampleRate)
 {
+    audioSampleRate = sampleRate;
+    
+    // Until the machine is initialised there is nothing to rebuild
     if (audioBuffer)
     {
-        delete audioBuffer;
+        audioSetup();
+        audioReset();
     }
-    
-    audioBuffer = new int16_t[ audioBufferSize ]();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::audioSetRateAdjustment(double ratio)
+{
+    // Takes effect from the next frame. Edges are placed on the sample grid when the frame ends so a frame is never
+    // rendered with a mix of rates
+    audioRateAdjustment = std::max(1.0 - cAUDIO_MAX_RATE_ADJUST, std::min(1.0 + cAUDIO_MAX_RATE_ADJUST, ratio));
+    audioSamplesPerFrame = audioSampleRate * machineInfo.tsPerFrame / machineInfo.cpuSpeed * audioRateAdjustment;
+    audioTsPerSample = machineInfo.tsPerFrame / audioSamplesPerFrame;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::audioReset()
+{
+    std::fill(audioBuffer, audioBuffer + audioBufferSize, 0);
     audioBufferIndex = 0;
-    audioTsCounter = 0;
-    audioTsStepCounter = 0;
-    audioOutputLevelLeft = 0;
-    audioOutputLevelRight = 0;
-    audioAYLevelLeft = 0;
-    audioAYLevelRight = 0;
+    audioLastIndex = 0;
+    audioCurrentTs = 0;
+    audioEdges.clear();
+    std::fill(audioBlepBuffer.begin(), audioBlepBuffer.end(), 0);
+    audioSampleOffset = 0;
+    audioOutputLevel = 0;
+    audioBlepLevel = 0;
+    audioBeeperLevel = 0;
+    audioAYLevel = 0;
+    audioAYNextTs = audioAYTsStep;
     audioAYOutput = 0;
     audioAYrandom = 1;
     audioAYChannelOutput[0] = 0;
@@ -86,72 +176,307 @@ void ZXSpectrum::audioReset()
 // ------------------------------------------------------------------------------------------------------------
 // - Generate audio output from Beeper and AY chip
 
-void ZXSpectrum::audioUpdateWithTs(int32_t tStates)
+void ZXSpectrum::audioCatchUp()
 {
-    if (emuPaused)
+    // Audio is generated lazily. Anything that changes the beeper, AY or SpecDRUM output calls this first, so the level
+    // seen here is the one that has been in effect since the previous catch up and that is when the edge happened
+    const uint32_t currentTs = z80Core.GetTStates();
+
+    // While audio is skipped the AY is held where it is and picks up again from the current t-state
+    if (!emuRenderAudio)
     {
+        audioCurrentTs = currentTs;
+        audioAYNextTs = currentTs;
         return;
     }
     
-    // Grab the current state of the audio ear output & the tapeLevel which is used to register input when loading tapes.
-    // Only need to do this once per audio update
-    float audioEarLevel = (audioEarBit | tapePlayer->inputBit) ? cBEEPER_VOLUME_MULTIPLIER : 0;
-    
-    // Add in any output from SpecDRUM if it's being used
-    if (emuUseSpecDRUM)
+    if (currentTs > audioCurrentTs)
+    {
+        // The tape input is heard through the beeper while loading
+        audioBeeperLevel = (audioEarBit | (tapePlayer ? tapePlayer->inputBit : 0)) ? cBEEPER_VOLUME_MULTIPLIER : 0;
+        
+        if (emuUseSpecDRUM)
+        {
+            audioBeeperLevel += specdrumDACValue;
+        }
+        
+        audioAddEdge(audioCurrentTs, audioBeeperLevel + audioAYLevel);
+        
+        if (emuUseAYSound)
+        {
+            audioAYUpdateToTs(currentTs);
+        }
+        
+        audioCurrentTs = currentTs;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::audioAYUpdateToTs(uint32_t ts)
+{
+    if (audioAYNextTs >= ts)
     {
-        audioEarLevel += specdrumDACValue;
+        return;
     }
     
-    // Loop over each tState so that the necessary audio samples can be generated
-    for(int i = 0; i < tStates; i++)
+    uint32_t ticks = (ts - audioAYNextTs + audioAYTsStep - 1) / audioAYTsStep;
+    
+    // The output only changes on ticks where a tone flips, the noise shifts or the envelope steps, so the ticks in
+    // between are skipped in one go. When no channel can be heard changing the tones don't need stepping through at all
+    const bool includeTones = !audioAYOutputFixed();
+    
+    // The first tick is always run as it picks up whatever register write caused this update
+    uint32_t step = 1;
+    
+    while (ticks > 0)
     {
-        // If we have done more cycles now than the audio step counter, generate a new sample
-        audioTsCounter += 1.0f;
-        audioOutputLevelLeft += audioEarLevel;
-        audioOutputLevelRight += audioEarLevel;
-        audioOutputLevelLeft += audioAYLevelLeft;
-        audioOutputLevelRight += audioAYLevelRight;
+        audioAYAdvance(step - 1);
+        audioAYNextTs += (step - 1) * audioAYTsStep;
+        
+        audioAYUpdate();
+        
+        audioAYLevel = audioAYChannelOutput[0] + audioAYChannelOutput[1] + audioAYChannelOutput[2];
+        audioAYChannelOutput[0] = 0;
+        audioAYChannelOutput[1] = 0;
+        audioAYChannelOutput[2] = 0;
+        
+        audioAddEdge(audioAYNextTs, audioBeeperLevel + audioAYLevel);
+        audioAYNextTs += audioAYTsStep;
+        
+        ticks -= step;
+        step = std::min(ticks, audioAYTicksToNextEvent(includeTones));
+    }
+}
 
-        // Loop over each tState so that the necessary audio samples can be generated
-       if (emuUseAYSound)
-       {
-           audioAYTs += 1.0f;
-           if (audioAYTs >= audioAYTsStep)
-           {
-               audioAYUpdate();
+// ------------------------------------------------------------------------------------------------------------
 
-               audioAYLevelLeft = audioAYChannelOutput[0];      // A - Left
-               audioAYLevelLeft += audioAYChannelOutput[1];     // B - Left
-               audioAYLevelLeft += audioAYChannelOutput[2];     // C - Left
+uint32_t ZXSpectrum::audioAYTicksToNextEvent(bool includeTones)
+{
+    uint32_t ticks = UINT32_MAX;
+    
+    if (!audioAYEnvelopeHolding)
+    {
+        const uint32_t period = audioAYRegisters[ E_AYREGISTER::E_FINE ] | (audioAYRegisters[ E_AYREGISTER::E_COARSE ] << 8);
+        ticks = (audioAYEnvelopeCount + 1u >= period) ? 1 : period - audioAYEnvelopeCount;
+    }
+    
+    if ((audioAYRegisters[ E_AYREGISTER::ENABLE ] & 0x38) != 0x38)
+    {
+        const uint32_t period = std::max<uint32_t>(audioAYRegisters[ E_AYREGISTER::NOISEPER ], 1);
+        ticks = std::min(ticks, (audioAYNoiseCount + 1 >= period) ? 1 : period - audioAYNoiseCount);
+    }
+    
+    if (includeTones)
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            const uint32_t period = std::max<uint32_t>(audioAYRegisters[ E_AYREGISTER::A_FINE + i * 2 ] | (audioAYRegisters[ E_AYREGISTER::A_COARSE + i * 2 ] << 8), 1);
+            ticks = std::min(ticks, (audioAYChannelCount[i] + 2 >= period) ? 1 : (period - audioAYChannelCount[i] + 1) / 2);
+        }
+    }
+    
+    return ticks;
+}
 
-               audioAYLevelRight = audioAYChannelOutput[0];     // A - Right
-               audioAYLevelRight += audioAYChannelOutput[1];    // B - Right
-               audioAYLevelRight += audioAYChannelOutput[2];    // C - Right
+// ------------------------------------------------------------------------------------------------------------
 
-               audioAYChannelOutput[0] = 0;
-               audioAYChannelOutput[1] = 0;
-               audioAYChannelOutput[2] = 0;
-               
-               audioAYTs -= audioAYTsStep;
-           }
-       }
+void ZXSpectrum::audioAYAdvance(uint32_t ticks)
+{
+    // Moves the counters on by a number of ticks in which the noise and envelope have no events. Tones may flip in
+    // that time, which happens when their output can't be heard
+    if (ticks == 0)
+    {
+        return;
+    }
+    
+    if (!audioAYEnvelopeHolding)
+    {
+        audioAYEnvelopeCount += ticks;
+    }
+    
+    if ((audioAYRegisters[ E_AYREGISTER::ENABLE ] & 0x38) != 0x38)
+    {
+        audioAYNoiseCount += ticks;
+    }
+    
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const uint32_t period = std::max<uint32_t>(audioAYRegisters[ E_AYREGISTER::A_FINE + i * 2 ] | (audioAYRegisters[ E_AYREGISTER::A_COARSE + i * 2 ] << 8), 1);
+        uint32_t count = audioAYChannelCount[i];
+        uint32_t remaining = ticks;
+        uint32_t flips = 0;
         
-        if (audioTsCounter >= audioBeeperTsStep)
+        if (period <= 2)
+        {
+            // The count never drops back below the period so the tone flips every tick
+            flips = remaining;
+            count += remaining * (2 - period);
+        }
+        else
         {
-            // Scale down
-            audioOutputLevelLeft /= audioTsCounter;
-            audioOutputLevelRight /= audioTsCounter;
+            // A count left above a period that has just been shortened drains one flip per tick
+            while (remaining > 0 && count >= period)
+            {
+                count = count + 2 - period;
+                flips++;
+                remaining--;
+            }
             
-            // Load the buffer with the sample for both left and right channels
-            audioBuffer[ audioBufferIndex++ ] = static_cast< int16_t >(audioOutputLevelLeft);
-            audioBuffer[ audioBufferIndex++ ] = static_cast< int16_t >(audioOutputLevelRight);
+            if (remaining > 0)
+            {
+                count += remaining * 2;
+                flips += count / period;
+                count %= period;
+            }
+        }
+        
+        audioAYChannelCount[i] = count;
+        
+        if (flips & 1)
+        {
+            audioAYOutput ^= (1 << i);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool ZXSpectrum::audioAYOutputFixed()
+{
+    // True when no channel's output can change until a register is written: each one is either silent or has its tone
+    // and noise disabled, and isn't following a moving envelope
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const uint8_t vol = audioAYRegisters[ E_AYREGISTER::A_VOL + i ];
+        const bool envelope = (vol & 0x10) != 0;
+        
+        if (envelope && !audioAYEnvelopeHolding)
+        {
+            return false;
+        }
+        
+        const uint8_t level = envelope ? audioAYAttackEndVol : vol;
+        const bool mixed = ((audioAYRegisters[ E_AYREGISTER::ENABLE ] >> i) & 0x09) != 0x09;
+        
+        if (level != 0 && mixed)
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::audioAddEdge(uint32_t ts, float level)
+{
+    if (level != audioOutputLevel)
+    {
+        audioEdges.push_back({ ts, level - audioOutputLevel });
+        audioOutputLevel = level;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
 
-            audioTsCounter -= audioBeeperTsStep;
-            audioOutputLevelLeft = (audioEarLevel + audioAYLevelLeft) * audioTsCounter;
-            audioOutputLevelRight = (audioEarLevel + audioAYLevelRight) * audioTsCounter;
+void ZXSpectrum::audioFrameEnd()
+{
+    if (!emuRenderAudio)
+    {
+        // No samples for this frame. The output level and kernel tails are left alone so the next rendered frame
+        // carries on from them without a click
+        audioEdges.clear();
+        audioCurrentTs -= machineInfo.tsPerFrame;
+        audioAYNextTs = audioCurrentTs;
+        return;
+    }
+    
+    const BlepTable &blep = audioBlepTable();
+    float *buffer = audioBlepBuffer.data();
+    
+    // Spread each edge over the samples around it
+    for (const AudioEdge &edge : audioEdges)
+    {
+        const double position = audioSampleOffset + edge.ts / audioTsPerSample;
+        const uint32_t sample = static_cast<uint32_t>(position);
+        const float *kernel = blep.kernel[ static_cast<uint32_t>((position - sample) * cBLEP_PHASES + 0.5) ];
+        
+        for (uint32_t tap = 0; tap < cBLEP_TAPS; tap++)
+        {
+            buffer[ sample + tap ] += kernel[ tap ] * edge.delta;
         }
     }
+    audioEdges.clear();
+    
+    // Integrate to get the output level. The beeper and AY are mixed to mono so both channels get the same sample
+    const double frameSamples = audioSampleOffset + audioSamplesPerFrame;
+    const uint32_t samples = static_cast<uint32_t>(frameSamples);
+    
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        audioBlepLevel += buffer[ i ];
+        const int16_t sample = static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, audioBlepLevel)));
+        audioBuffer[ audioBufferIndex++ ] = sample;
+        audioBuffer[ audioBufferIndex++ ] = sample;
+    }
+    
+    // Keep the kernel tails that fall into the next frame
+    std::copy(audioBlepBuffer.begin() + samples, audioBlepBuffer.end(), audioBlepBuffer.begin());
+    std::fill(audioBlepBuffer.end() - samples, audioBlepBuffer.end(), 0);
+    audioSampleOffset = frameSamples - samples;
+    
+    // Everything still pending moves to the start of the next frame
+    audioCurrentTs -= machineInfo.tsPerFrame;
+    audioAYNextTs = (audioAYNextTs > machineInfo.tsPerFrame) ? audioAYNextTs - machineInfo.tsPerFrame : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Save State
+
+void ZXSpectrum::audioStateTransfer(StateStream &stream)
+{
+    stream.field(audioEarBit);
+    stream.field(audioMicBit);
+    stream.field(audioCurrentTs);
+    stream.field(audioSampleOffset);
+    stream.field(audioOutputLevel);
+    stream.field(audioBlepLevel);
+    stream.field(audioBeeperLevel);
+    stream.field(audioAYLevel);
+    stream.field(specdrumDACValue);
+    
+    stream.field(audioAYChannelOutput);
+    stream.field(audioAYChannelCount);
+    stream.field(audioAYrandom);
+    stream.field(audioAYOutput);
+    stream.field(audioAYNoiseCount);
+    stream.field(audioAYEnvelopeCount);
+    stream.field(audioAYRegisters);
+    stream.field(audioAYCurrentRegister);
+    stream.field(audioAYFloatingRegister);
+    stream.field(audioAYEnvelopeHolding);
+    stream.field(audioAYEnvelopeHold);
+    stream.field(audioAYEnvelopeAlt);
+    stream.field(audioAYEnvelopeContinue);
+    stream.field(audioAYEnvelope);
+    stream.field(audioAYOneShot);
+    stream.field(audioAYEnvelopeAttack);
+    stream.field(audioAYAttackEndVol);
+    stream.field(audioAYNextTs);
+    
+    // Edges waiting for the end of the frame, and the kernel tails carried in from the last one. Edges are only
+    // rendered when a frame ends so the tails never reach past the first two kernels' worth of samples
+    uint32_t edgeCount = static_cast<uint32_t>(audioEdges.size());
+    stream.field(edgeCount);
+    
+    if (stream.loading)
+    {
+        audioEdges.resize(std::min<size_t>(edgeCount, stream.remaining() / sizeof(AudioEdge)));
+    }
+    stream.bytes(audioEdges.data(), edgeCount * sizeof(AudioEdge));
+    stream.bytes(audioBlepBuffer.data(), cBLEP_TAPS * 2 * sizeof(float));
 }
 
 // ------------------------------------------------------------------------------------------------------------
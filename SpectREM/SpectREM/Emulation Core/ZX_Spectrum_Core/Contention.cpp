@@ -29,68 +29,63 @@ const uint32_t ZXSpectrum::ULAAltContentionValues[] = { 1, 0, 7, 6, 5, 4, 3, 2};
  **/
 void ZXSpectrum::ULAApplyIOContention(uint16_t address, bool contended)
 {
-    if (contended)
-    {
-        if ((address & 0x01) == 0)
-        {
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(3);
-        }
-        else
-        {
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(1);
-        }
-    } else {
-        if ((address & 0x01) == 0)
-        {
-            z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-            z80Core.AddTStates(3);
-        }
-        else
-        {
-            z80Core.AddTStates(4);
-        }
-    }
+    const uint32_t pattern = (contended ? 2 : 0) | (address & 0x01);
+    z80Core.AddContentionTStates( ULAIOContentionTable[ pattern ][ z80Core.GetTStates() ] );
 }
 
 // ------------------------------------------------------------------------------------------------------------
 // - Build Contention Table
 
-void ZXSpectrum::ULABuildContentionTable(bool alt)
+void ZXSpectrum::ULABuildContentionTable(const MachineInfo &info, ModelTables &tables)
 {
-    for (int i = 0; i < machineInfo.tsPerFrame; i++)
+    const uint32_t *contentionValues = (info.altContention) ? ULAAltContentionValues : ULAContentionValues;
+    const uint32_t tableLength = info.tsPerFrame + cULA_TABLE_OVERRUN;
+
+    for (uint32_t i = 0; i < tableLength; i++)
     {
-        ULAMemoryContentionTable[i] = 0;
-        ULAIOContentionTable[i] = 0;
+        // Entries past the end of the frame repeat the start of the next one
+        const uint32_t frameTs = (i < info.tsPerFrame) ? i : i - info.tsPerFrame;
+        tables.memoryContention[i] = 0;
         
-        if (i >= machineInfo.tsToOrigin)
+        if (frameTs >= info.tsToOrigin)
         {
-            uint32_t line = (i - machineInfo.tsToOrigin) / machineInfo.tsPerLine;
-            uint32_t ts = (i - machineInfo.tsToOrigin) % machineInfo.tsPerLine;
+            uint32_t line = (frameTs - info.tsToOrigin) / info.tsPerLine;
+            uint32_t ts = (frameTs - info.tsToOrigin) % info.tsPerLine;
             
-            if (line < machineInfo.pxVerticalDisplay && ts < 128)
+            if (line < info.pxVerticalDisplay && ts < 128)
             {
-                if (!alt)
-                {
-                    ULAMemoryContentionTable[i] = ULAContentionValues[ ts & 0x07 ];
-                    ULAIOContentionTable[i] = ULAContentionValues[ ts & 0x07 ];
-                }
-                else
-                {
-                    ULAMemoryContentionTable[i] = ULAAltContentionValues[ ts & 0x07 ];
-                    ULAIOContentionTable[i] = ULAAltContentionValues[ ts & 0x07 ];
-                }
+                tables.memoryContention[i] = static_cast<uint8_t>(contentionValues[ ts & 0x07 ]);
             }
         }
     }
+
+    // Total t-states taken by each IO contention pattern starting at every t-state, so a port access costs a
+    // single lookup. The pattern can run a few t-states past the end of the table so wrap back into the frame
+    auto contentionAt = [&info, &tables](uint32_t ts) { return tables.memoryContention[ ts % info.tsPerFrame ]; };
+
+    for (uint32_t i = 0; i < tableLength; i++)
+    {
+        uint32_t ts = i;
+        ts += 1;
+        ts += contentionAt(ts);
+        ts += 3;
+        tables.ioContention[ IO_N1_C3 ][i] = static_cast<uint8_t>(ts - i);
+
+        tables.ioContention[ IO_N4 ][i] = 4;
+
+        ts = i;
+        ts += contentionAt(ts);
+        ts += 1;
+        ts += contentionAt(ts);
+        ts += 3;
+        tables.ioContention[ IO_C1_C3 ][i] = static_cast<uint8_t>(ts - i);
+
+        ts = i;
+        for (uint32_t j = 0; j < 4; j++)
+        {
+            ts += contentionAt(ts);
+            ts += 1;
+        }
+        tables.ioContention[ IO_C1_C1_C1_C1 ][i] = static_cast<uint8_t>(ts - i);
+    }
 }
@@ -7,6 +7,7 @@
 //
 
 #include "ZXSpectrum.hpp"
+#include <algorithm>
 
 // - Spectrum displayPalette
 
@@ -22,7 +23,43 @@ enum
 
 void ZXSpectrum::displaySetup()
 {
-    displayBuffer = new uint8_t[ screenBufferSize ]();
+    displayDirtyRows.resize( screenHeight );
+    
+    // A headless machine leaves allocating the frame buffers until a frame is asked for
+    if (!emuHeadless)
+    {
+        displayAllocateBuffers();
+    }
+    displayInvalidate();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::displayAllocateBuffers()
+{
+    // The frame buffers live as long as the machine so a frame held by the renderer is never freed underneath it
+    for (uint8_t *&buffer : displayBuffers)
+    {
+        delete[] buffer;
+        buffer = new uint8_t[ screenBufferSize ]();
+    }
+    displayBuffer = displayBuffers[ displayWriteIndex ];
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::setHeadless(bool headless, bool keepAudio)
+{
+    emuHeadless = headless;
+    emuHeadlessAudio = keepAudio;
+    
+    // Coming out of headless mode the next frame needs somewhere to be drawn. Before the machine is initialised the
+    // buffers are allocated by displaySetup
+    if (!headless && !displayBuffer && screenBufferSize)
+    {
+        displayAllocateBuffers();
+        displayInvalidate();
+    }
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -30,44 +67,77 @@ void ZXSpectrum::displaySetup()
 
 void ZXSpectrum::displayUpdateWithTs(int32_t tStates)
 {
-    const uint8_t *memoryAddress = reinterpret_cast<uint8_t *>( memoryRam.data() + emuDisplayPage * cBITMAP_ADDRESS );
+    if (tStates <= 0 || !emuRenderDisplay)
+    {
+        return;
+    }
+    
+    const uint8_t *memoryAddress = memoryRamPages[ emuDisplayPage ]->data();
     const uint32_t yAdjust = ( machineInfo.pxVerticalBlank + machineInfo.pxVertBorder );
     
     // By creating a new buffer which is interpreting the display buffer as 64bits rather than 8, on 64 bit machines an
     // entire display character is copied in a single assignment
     uint64_t *displayBuffer8 = reinterpret_cast<uint64_t*>( displayBuffer ) + displayBufferIndex;
     
+    // The buffer being drawn holds an older frame, so changes are measured against the last published frame instead
+    const uint64_t *previousBuffer8 = reinterpret_cast<const uint64_t*>( displayBuffers[ displayPublishedIndex ] ) + displayBufferIndex;
+    
     const uint8_t flashMask = ( emuFrameCounter & 16 ) ? 0xff : 0x7f;
+    const uint32_t cellsPerRow = screenWidth / 8;
     
-    while (tStates > 0)
+    // A character cell that has only partly elapsed is drawn in full
+    uint32_t cells = ( static_cast<uint32_t>( tStates ) + machineInfo.tsPerChar - 1 ) / machineInfo.tsPerChar;
+    emuCurrentDisplayTs += cells * machineInfo.tsPerChar;
+    
+    // The beam walks the spans of each line, drawing every cell in a span with the same loop. Anything after the
+    // last line of the frame is not drawn
+    while (cells > 0 && displayBeamLine < machineInfo.pxVerticalTotal)
     {
-        uint32_t line = emuCurrentDisplayTs / machineInfo.tsPerLine;
-        uint32_t ts = emuCurrentDisplayTs % machineInfo.tsPerLine;
-
-        uint32_t action = displayTstateTable[ line ][ ts ];
-
-        switch ( action ) {
+        const DisplaySpan *span = displaySpans[ displayBeamLine ];
+        while (span->tsEnd <= displayBeamTs)
+        {
+            span++;
+        }
+        
+        // A cell belongs to the span it starts in
+        const uint32_t spanCells = std::min( cells, ( span->tsEnd - displayBeamTs + machineInfo.tsPerChar - 1 ) / machineInfo.tsPerChar );
+        
+        // Each cell is XOR'd with the same cell in the previous frame so any difference marks the row as dirty
+        uint64_t changed = 0;
+        
+        switch ( span->type ) {
                 
             case eDisplayBorder:
             {
-                uint64_t *colour8 = displayCLUT + ( displayBorderColor * 2048 );
-                *displayBuffer8++ = *colour8;
+                const uint64_t colour8 = displayCLUT[ displayBorderColor * 2048 ];
+                
+                for (uint32_t i = 0; i < spanCells; i++)
+                {
+                    changed |= previousBuffer8[ i ] ^ colour8;
+                    displayBuffer8[ i ] = colour8;
+                }
+                displayBuffer8 += spanCells;
+                previousBuffer8 += spanCells;
                 break;
             }
-
+                
             case eDisplayPaper:
             {
-                const uint32_t y = line - yAdjust;
-                const uint32_t x = ( ts >> 2 ) - 4;
+                const uint32_t y = displayBeamLine - yAdjust;
+                const uint32_t x = ( displayBeamTs >> 2 ) - 4;
                 
-                uint32_t pixelAddress = displayLineAddrTable[ y ] + x;
-                uint32_t attributeAddress = cBITMAP_SIZE + ( ( y >> 3 ) << 5 ) + x;
+                const uint8_t *pixelBytes = memoryAddress + displayLineAddrTable[ y ] + x;
+                const uint8_t *attributeBytes = memoryAddress + cBITMAP_SIZE + ( ( y >> 3 ) << 5 ) + x;
                 
-                const uint8_t pixelByte = memoryAddress[ pixelAddress ];
-                uint8_t attributeByte = displayALUT[ memoryAddress[ attributeAddress ] & flashMask ];
-
-                uint64_t *colour8 = displayCLUT + ( ( attributeByte & 0x7f ) * 256 ) + pixelByte;
-                *displayBuffer8++ = *colour8;
+                for (uint32_t i = 0; i < spanCells; i++)
+                {
+                    const uint8_t attributeByte = displayALUT[ attributeBytes[ i ] & flashMask ];
+                    const uint64_t colour8 = displayCLUT[ ( ( attributeByte & 0x7f ) * 256 ) + pixelBytes[ i ] ];
+                    changed |= previousBuffer8[ i ] ^ colour8;
+                    displayBuffer8[ i ] = colour8;
+                }
+                displayBuffer8 += spanCells;
+                previousBuffer8 += spanCells;
                 break;
             }
                 
@@ -75,10 +145,60 @@ void ZXSpectrum::displayUpdateWithTs(int32_t tStates)
                 break;
         }
         
-        displayBufferIndex += static_cast<uint32_t>( displayBuffer8 - ( reinterpret_cast<uint64_t*>( displayBuffer ) + displayBufferIndex ) );
-        emuCurrentDisplayTs += machineInfo.tsPerChar;
-        tStates -= machineInfo.tsPerChar;
+        if (changed)
+        {
+            // Spans never cross a row of the display buffer, so the last cell written gives the row
+            const uint32_t row = static_cast<uint32_t>( ( displayBuffer8 - reinterpret_cast<uint64_t*>( displayBuffer ) - 1 ) / cellsPerRow );
+            displayDirtyRows[ row ] = 1;
+            displayDirty = true;
+        }
+        
+        cells -= spanCells;
+        displayBeamTs += spanCells * machineInfo.tsPerChar;
+        
+        if (displayBeamTs >= machineInfo.tsPerLine)
+        {
+            displayBeamTs = 0;
+            displayBeamLine++;
+        }
+    }
+    
+    displayBufferIndex = static_cast<uint32_t>( displayBuffer8 - reinterpret_cast<uint64_t*>( displayBuffer ) );
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+const uint8_t *ZXSpectrum::displayRenderFrame()
+{
+    if (!displayBuffer)
+    {
+        displayAllocateBuffers();
     }
+    
+    // The beam is taken back to the top for the whole frame and then put back where it was, so a frame in progress
+    // carries on as if nothing happened
+    const uint32_t currentDisplayTs = emuCurrentDisplayTs;
+    const uint32_t beamLine = displayBeamLine;
+    const uint32_t beamTs = displayBeamTs;
+    const uint32_t bufferIndex = displayBufferIndex;
+    const bool renderDisplay = emuRenderDisplay;
+    
+    emuCurrentDisplayTs = 0;
+    displayBeamLine = 0;
+    displayBeamTs = 0;
+    displayBufferIndex = 0;
+    emuRenderDisplay = true;
+    
+    displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame));
+    displaySwapBuffers();
+    
+    emuCurrentDisplayTs = currentDisplayTs;
+    displayBeamLine = beamLine;
+    displayBeamTs = beamTs;
+    displayBufferIndex = bufferIndex;
+    emuRenderDisplay = renderDisplay;
+    
+    return displayBuffers[ displayPublishedIndex ];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -87,7 +207,10 @@ void ZXSpectrum::displayUpdateWithTs(int32_t tStates)
 void ZXSpectrum::displayFrameReset()
 {
     emuCurrentDisplayTs = 0;
+    displayBeamLine = 0;
+    displayBeamTs = 0;
     displayBufferIndex = 0;
+    displayFramePublished = false;
     audioBufferIndex = 0;
 }
 
@@ -97,14 +220,136 @@ void ZXSpectrum::displayClear()
 {
     if (displayBuffer)
     {
-        displaySetup();
+        std::fill( displayBuffer, displayBuffer + screenBufferSize, 0 );
+        displaySwapBuffers();
+        displayInvalidate();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Frame Handoff
+
+void ZXSpectrum::displayPublishFrame()
+{
+    // A frame completed by the debugger is published when it is finished, not again when the frame ends
+    if (!displayFramePublished)
+    {
+        displayFramePublished = true;
+        displaySwapBuffers();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::displaySwapBuffers()
+{
+    // The finished buffer replaces the one waiting for the renderer, which becomes the next buffer to draw into. If the
+    // renderer never picked it up that frame is simply dropped
+    displayPublishedIndex = displayWriteIndex;
+    displayWriteIndex = displayReadyFrame.exchange( displayWriteIndex | cDISPLAY_FRAME_NEW, std::memory_order_acq_rel ) & cDISPLAY_FRAME_INDEX;
+    displayBuffer = displayBuffers[ displayWriteIndex ];
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+const uint8_t *ZXSpectrum::displayAcquireFrame()
+{
+    // Only swap when a new frame is waiting, handing back the buffer the renderer was holding
+    if (displayReadyFrame.load( std::memory_order_acquire ) & cDISPLAY_FRAME_NEW)
+    {
+        displayFrontIndex = displayReadyFrame.exchange( displayFrontIndex, std::memory_order_acq_rel ) & cDISPLAY_FRAME_INDEX;
+    }
+    
+    return displayBuffers[ displayFrontIndex ];
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Dirty Tracking
+
+void ZXSpectrum::displayInvalidate()
+{
+    std::fill( displayDirtyRows.begin(), displayDirtyRows.end(), 1 );
+    displayDirty = true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool ZXSpectrum::displayTakeDirtyRects(std::vector<DisplayRect> &rects)
+{
+    rects.clear();
+    
+    if (!displayDirty)
+    {
+        return false;
+    }
+    
+    for (uint32_t row = 0; row < displayDirtyRows.size(); row++)
+    {
+        if (!displayDirtyRows[ row ])
+        {
+            continue;
+        }
+        
+        // Extend the previous rectangle if it ends on the row above
+        if (!rects.empty() && rects.back().y + rects.back().height == row)
+        {
+            rects.back().height++;
+        }
+        else
+        {
+            rects.push_back( { 0, row, screenWidth, 1 } );
+        }
+        
+        displayDirtyRows[ row ] = 0;
+    }
+    
+    displayDirty = false;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Save State
+
+void ZXSpectrum::displayStateTransfer(StateStream &stream)
+{
+    stream.field(displayBorderColor);
+    stream.field(displayBeamLine);
+    stream.field(displayBeamTs);
+    stream.field(displayBufferIndex);
+    stream.field(displayFramePublished);
+    
+    // Part way through a frame the lines already drawn are kept so the frame is finished off as it was started. A
+    // frame the debugger has already completed lives in the published buffer, so it is saved from there and published
+    // again on load. A headless machine has nothing to save and skips over anything it is given
+    uint32_t drawnBytes = displayBuffer ? displayBufferIndex * sizeof(uint64_t) : 0;
+    stream.field(drawnBytes);
+    
+    if (displayBuffer && drawnBytes <= screenBufferSize)
+    {
+        if (stream.loading || !displayFramePublished)
+        {
+            stream.bytes(displayBuffer, drawnBytes);
+        }
+        else
+        {
+            stream.bytes(displayBuffers[ displayPublishedIndex ], drawnBytes);
+        }
+        
+        if (stream.loading && displayFramePublished)
+        {
+            displaySwapBuffers();
+        }
+    }
+    else
+    {
+        stream.skip(drawnBytes);
     }
 }
 
 // ------------------------------------------------------------------------------------------------------------
 // - Build Display Tables
 
-void ZXSpectrum::displayBuildLineAddressTable()
+void ZXSpectrum::displayBuildLineAddressTable(DisplayTables &tables)
 {
     for(uint32_t i = 0; i < 3; i++)
     {
@@ -112,7 +357,7 @@ void ZXSpectrum::displayBuildLineAddressTable()
         {
             for(uint32_t k = 0; k < 8; k++)
             {
-                displayLineAddrTable[ ( i << 6 ) + ( j << 3 ) + k ] = static_cast<uint16_t>(( i << 11 ) + ( j << 5 ) + ( k << 8 ));
+                tables.lineAddr[ ( i << 6 ) + ( j << 3 ) + k ] = static_cast<uint16_t>(( i << 11 ) + ( j << 5 ) + ( k << 8 ));
             }
         }
     }
@@ -120,39 +365,44 @@ void ZXSpectrum::displayBuildLineAddressTable()
 
 // ------------------------------------------------------------------------------------------------------------
 
-void ZXSpectrum::displayBuildTsTable()
+void ZXSpectrum::displayBuildSpanTable(const MachineInfo &info, ModelTables &tables)
 {
-    uint32_t tsRightBorderStart = ( machineInfo.pxEmuBorder / 2 ) + machineInfo.tsHorizontalDisplay;
-    uint32_t tsRightBorderEnd = ( machineInfo.pxEmuBorder / 2 ) + machineInfo.tsHorizontalDisplay + ( machineInfo.pxEmuBorder / 2 );
+    uint32_t tsRightBorderStart = ( info.pxEmuBorder / 2 ) + info.tsHorizontalDisplay;
+    uint32_t tsRightBorderEnd = ( info.pxEmuBorder / 2 ) + info.tsHorizontalDisplay + ( info.pxEmuBorder / 2 );
     uint32_t tsLeftBorderStart = 0;
-    uint32_t tsLeftBorderEnd = machineInfo.pxEmuBorder / 2;
+    uint32_t tsLeftBorderEnd = info.pxEmuBorder / 2;
     
-    uint32_t pxLineTopBorderStart = machineInfo.pxVerticalBlank;
-    uint32_t pxLineTopBorderEnd = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder;
-    uint32_t pxLinePaperStart = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder;
-    uint32_t pxLinePaperEnd = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder + machineInfo.pxVerticalDisplay;
-    uint32_t pxLineBottomBorderEnd = machineInfo.pxVerticalTotal - ( machineInfo.pxVertBorder - machineInfo.pxEmuBorder );
+    uint32_t pxLineTopBorderStart = info.pxVerticalBlank;
+    uint32_t pxLineTopBorderEnd = info.pxVerticalBlank + info.pxVertBorder;
+    uint32_t pxLinePaperStart = info.pxVerticalBlank + info.pxVertBorder;
+    uint32_t pxLinePaperEnd = info.pxVerticalBlank + info.pxVertBorder + info.pxVerticalDisplay;
+    uint32_t pxLineBottomBorderEnd = info.pxVerticalTotal - ( info.pxVertBorder - info.pxEmuBorder );
     
-    for (uint32_t line = 0; line < machineInfo.pxVerticalTotal; line++)
+    for (uint32_t line = 0; line < info.pxVerticalTotal; line++)
     {
-        for (uint32_t ts = 0 ; ts < machineInfo.tsPerLine; ts++)
+        // Work out what the beam is doing at each t-state of the line
+        uint8_t lineTypes[ 228 ];
+        
+        for (uint32_t ts = 0 ; ts < info.tsPerLine; ts++)
         {
+            lineTypes[ ts ] = eDisplayRetrace;
+
             // Screen Retrace
-            if (line < machineInfo.pxVerticalBlank)
+            if (line < info.pxVerticalBlank)
             {
-                displayTstateTable[ line ][ ts ] = eDisplayRetrace;
+                lineTypes[ ts ] = eDisplayRetrace;
             }
             
             // Top Border
             if (line >= pxLineTopBorderStart && line < pxLineTopBorderEnd)
             {
-                if ( ( ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine ) || line < pxLinePaperStart - machineInfo.pxEmuBorder )
+                if ( ( ts >= tsRightBorderEnd && ts < info.tsPerLine ) || line < pxLinePaperStart - info.pxEmuBorder )
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
+                    lineTypes[ ts ] = eDisplayRetrace;
                 }
                 else
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
+                    lineTypes[ ts ] = eDisplayBorder;
                 }
             }
             
@@ -161,31 +411,74 @@ void ZXSpectrum::displayBuildTsTable()
             {
                 if ( ( ts >= tsLeftBorderStart && ts < tsLeftBorderEnd ) || ( ts >= tsRightBorderStart && ts < tsRightBorderEnd ) )
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
+                    lineTypes[ ts ] = eDisplayBorder;
                 }
-                else if (ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine)
+                else if (ts >= tsRightBorderEnd && ts < info.tsPerLine)
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
+                    lineTypes[ ts ] = eDisplayRetrace;
                 }
                 else
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayPaper;
+                    lineTypes[ ts ] = eDisplayPaper;
                 }
             }
             
             // Bottom Border
             if (line >= pxLinePaperEnd && line < pxLineBottomBorderEnd)
             {
-                if (ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine)
+                if (ts >= tsRightBorderEnd && ts < info.tsPerLine)
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
+                    lineTypes[ ts ] = eDisplayRetrace;
                 }
                 else
                 {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
+                    lineTypes[ ts ] = eDisplayBorder;
                 }
             }
         }
+        
+        // Then merge runs of the same type into the spans for the line
+        uint32_t spanIndex = 0;
+        
+        for (uint32_t ts = 0; ts < info.tsPerLine; ts++)
+        {
+            if (ts > 0 && lineTypes[ ts ] != lineTypes[ ts - 1 ])
+            {
+                spanIndex++;
+            }
+            
+            tables.displaySpans[ line ][ spanIndex ].type = lineTypes[ ts ];
+            tables.displaySpans[ line ][ spanIndex ].tsEnd = static_cast<uint16_t>( ts + 1 );
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::displayBuildFetchTable(const MachineInfo &info, ModelTables &tables)
+{
+    const uint32_t yAdjust = ( info.pxVerticalBlank + info.pxVertBorder );
+    
+    for (uint32_t y = 0; y < info.pxVerticalDisplay; y++)
+    {
+        // Same screen layout as displayBuildLineAddressTable
+        const uint32_t lineAddress = ( ( y & 0xc0 ) << 5 ) + ( ( y & 0x07 ) << 8 ) + ( ( y & 0x38 ) << 2 );
+        const uint32_t attributeAddress = cBITMAP_SIZE + ( ( y >> 3 ) << 5 );
+        
+        for (uint32_t x = 0; x < 32; x++)
+        {
+            // Matches the cell position used by displayUpdateWithTs, where x = ( ts >> 2 ) - 4
+            const uint32_t ts = ( ( y + yAdjust ) * info.tsPerLine ) + ( ( x + 4 ) * info.tsPerChar );
+            
+            tables.displayFetch[ lineAddress + x ].firstTs = ts;
+            tables.displayFetch[ lineAddress + x ].lastTs = ts;
+            
+            if ((y & 0x07) == 0)
+            {
+                tables.displayFetch[ attributeAddress + x ].firstTs = ts;
+            }
+            tables.displayFetch[ attributeAddress + x ].lastTs = ts;
+        }
     }
 }
 
@@ -195,10 +488,10 @@ void ZXSpectrum::displayBuildTsTable()
  used to populate an 8bit display buffer with an index to the colour to be used for each pixel rather than the colour data itself. The actual
  colour to be used is worked out in the Fragment Shader using a 1D lookup texture that contains the actual colour information.
  **/
-void ZXSpectrum::displayBuildCLUT()
+void ZXSpectrum::displayBuildCLUT(DisplayTables &tables)
 {
     int32_t tableIdx = 0;
-    uint8_t *displayCLUT8 = reinterpret_cast<uint8_t *>( displayCLUT );
+    uint8_t *displayCLUT8 = reinterpret_cast<uint8_t *>( tables.clut );
     
     // Bitmap LUT
     for (uint32_t bright = 0; bright < 2; bright++)
@@ -221,7 +514,7 @@ void ZXSpectrum::displayBuildCLUT()
     // Attribute LUT
     for (uint32_t alutIdx = 0; alutIdx < 256; ++alutIdx)
     {
-        displayALUT[ alutIdx ] = static_cast<uint8_t>(alutIdx & 0x80 ? ( ( alutIdx & 0xc0 ) | ( ( alutIdx & 0x07 ) << 3 ) | ( ( alutIdx & 0x38) >> 3 ) ) : alutIdx);
+        tables.alut[ alutIdx ] = static_cast<uint8_t>(alutIdx & 0x80 ? ( ( alutIdx & 0xc0 ) | ( ( alutIdx & 0x07 ) << 3 ) | ( ( alutIdx & 0x38) >> 3 ) ) : alutIdx);
     }
 }
 
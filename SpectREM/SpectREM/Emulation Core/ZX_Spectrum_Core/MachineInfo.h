@@ -56,17 +56,19 @@ typedef struct
     
     uint32_t    machineType;            // 26
     
+    uint32_t    cpuSpeed;               // 27 - Z80 clock in Hz, which with tsPerFrame gives the true frame rate
+    
 } MachineInfo;
 
 static const MachineInfo machines[] = {
-    //1   2      3      4    5      6     7      8    9  10 11  12   13   14   15   16  17     18      19  20  21     22      23  24    25                    26
-    { 32, 69888, 14335, 224, 12544, 1792, 43008, 128, 4, 56, 8, 256, 192, 448, 312, 32, false, false,  10, 16, 16384, 65536,  0, false,"ZXSpectrum 48k",     eZXSpectrum48 },
+    //1   2      3      4    5      6     7      8    9  10 11  12   13   14   15   16  17     18      19  20  21     22      23  24    25                    26                   27
+    { 32, 69888, 14335, 224, 12544, 1792, 43008, 128, 4, 56, 8, 256, 192, 448, 312, 32, false, false,  10, 16, 16384, 65536,  0, false,"ZXSpectrum 48k",     eZXSpectrum48,       3500000 },
     
-    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, false,"ZXSpectrum 128k",    eZXSpectrum128 },
-    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, false,"ZXSpectrum 128k +2", eZXSpectrum128_2 },
+    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, false,"ZXSpectrum 128k",    eZXSpectrum128,      3546900 },
+    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, false,"ZXSpectrum 128k +2", eZXSpectrum128_2,    3546900 },
     
-    { 32, 70908, 14364, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 65536, 131072,  1,  true,"ZXSpectrum 128k +2A",eZXSpectrum128_2A },
-    { 32, 70908, 14364, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 65536, 131072,  1,  true,"ZXSpectrum 128k +3", eZXSpectrum128_3 }
+    { 32, 70908, 14364, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 65536, 131072,  1,  true,"ZXSpectrum 128k +2A",eZXSpectrum128_2A,   3546900 },
+    { 32, 70908, 14364, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 65536, 131072,  1,  true,"ZXSpectrum 128k +3", eZXSpectrum128_3,    3546900 }
 };
 
 #endif /* MachineInfo_h */
@@ -0,0 +1,159 @@
+//
+//  SaveState.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "ZXSpectrum.hpp"
+#include <cstddef>
+#include <cstring>
+
+// - Constants
+
+static const uint32_t       cSTATE_MAGIC = 0x54535253;     // "SRST"
+static const uint32_t       cSTATE_VERSION = 5;
+
+struct StateHeader
+{
+    uint32_t                magic;
+    uint32_t                version;
+    uint32_t                machineType;
+    uint32_t                ramSize;
+    uint64_t                size;
+};
+
+// ------------------------------------------------------------------------------------------------------------
+// - Save/Load
+
+size_t ZXSpectrum::stateSize()
+{
+    StateStream stream(static_cast<uint8_t *>(nullptr), 0);
+    stateTransfer(stream);
+    return stream.position;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+size_t ZXSpectrum::saveState(uint8_t *buffer, size_t size)
+{
+    if (!buffer)
+    {
+        return 0;
+    }
+
+    StateStream stream(buffer, size);
+    stateTransfer(stream);
+
+    if (stream.failed)
+    {
+        return 0;
+    }
+
+    // The size is only known once everything has been written. The caller's buffer need not be aligned for it
+    const uint64_t stateSize = stream.position;
+    memcpy(buffer + offsetof(StateHeader, size), &stateSize, sizeof(uint64_t));
+    return stream.position;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool ZXSpectrum::loadState(const uint8_t *buffer, size_t size, bool keepDisplay)
+{
+    // Nothing is touched unless the whole state is there and belongs to this type of machine
+    if (!buffer || size < sizeof(StateHeader))
+    {
+        return false;
+    }
+
+    StateHeader header;
+    memcpy(&header, buffer, sizeof(StateHeader));
+
+    if (header.magic != cSTATE_MAGIC || header.version != cSTATE_VERSION || header.size != size ||
+        header.machineType != static_cast<uint32_t>(machineInfo.machineType) || header.ramSize != memoryRamSize())
+    {
+        return false;
+    }
+
+    StateStream stream(buffer, size);
+    stateTransfer(stream);
+
+    // The memory map and anything derived from the loaded state is rebuilt rather than saved
+    memoryMapUpdate();
+    tapeLoaderReset();
+
+    if (!keepDisplay)
+    {
+        displayInvalidate();
+    }
+
+    return !stream.failed;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::stateTransfer(StateStream &stream)
+{
+    StateHeader header{ cSTATE_MAGIC, cSTATE_VERSION, static_cast<uint32_t>(machineInfo.machineType), memoryRamSize(), 0 };
+    stream.field(header);
+
+    // CPU
+    CZ80CoreBase::Z80SavedState cpuState;
+    if (!stream.loading)
+    {
+        z80Core.GetState(cpuState);
+    }
+    stream.field(cpuState);
+    if (stream.loading)
+    {
+        z80Core.SetState(cpuState);
+    }
+
+    // Tape position, if there is a tape player attached
+    Tape::PlaybackState tapeState{};
+    uint8_t hasTape = tapePlayer ? 1 : 0;
+    if (tapePlayer && !stream.loading)
+    {
+        tapePlayer->getPlaybackState(tapeState);
+    }
+    stream.field(hasTape);
+    stream.field(tapeState);
+    if (tapePlayer && hasTape && stream.loading)
+    {
+        tapePlayer->setPlaybackState(tapeState);
+    }
+    stream.field(tapeCurrentTs);
+
+    // Machine
+    stream.field(emuCurrentDisplayTs);
+    stream.field(emuFrameCounter);
+    stream.field(emuRAMPage);
+    stream.field(emuROMNumber);
+    stream.field(emuDisplayPage);
+    stream.field(emuDisablePaging);
+    stream.field(emuLoadTrapTriggered);
+    stream.field(emuSaveTrapTriggered);
+    stream.field(emuSpecialPagingMode);
+    stream.field(emuPagingMode);
+    stream.field(emuROMHiBit);
+    stream.field(emuROMLoBit);
+    stream.field(emuRandom);
+    stream.field(ULAPort7FFDValue);
+    stream.field(ULAPort1FFDValue);
+    stream.field(keyboardMap);
+    stream.field(keyboardCapsLockFrames);
+    stream.field(keyboardCapsLockPressed);
+    stream.field(schedulerEventTs);
+
+    displayStateTransfer(stream);
+    audioStateTransfer(stream);
+    machineStateTransfer(stream);
+
+    // Memory is copied a page at a time. Loading replaces the contents of any page shared with a forked machine, so
+    // the page is not copied first
+    for (uint32_t page = 0; page < memoryRamPages.size() && stream.memory; page++)
+    {
+        stream.bytes(stream.loading ? memoryRamPage(page, false) : memoryRamPages[ page ]->data(), cMEMORY_PAGE_SIZE);
+    }
+}
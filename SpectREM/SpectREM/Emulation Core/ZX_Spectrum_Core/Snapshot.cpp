@@ -42,42 +42,42 @@ ZXSpectrum::SnapshotData ZXSpectrum::snapshotCreateSNA()
     snap.length = (48 * 1024) + cSNA_HEADER_SIZE;
     snap.data = new uint8_t[snap.length];
 
-    snap.data[0] = z80Core.GetRegister(CZ80Core::eREG_I);
-    snap.data[1] = z80Core.GetRegister(CZ80Core::eREG_ALT_HL) & 0xff;
-    snap.data[2] = z80Core.GetRegister(CZ80Core::eREG_ALT_HL) >> 8;
+    snap.data[0] = z80Core.GetRegister(CZ80CoreBase::eREG_I);
+    snap.data[1] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_HL) & 0xff;
+    snap.data[2] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_HL) >> 8;
 
-    snap.data[3] = z80Core.GetRegister(CZ80Core::eREG_ALT_DE) & 0xff;
-    snap.data[4] = z80Core.GetRegister(CZ80Core::eREG_ALT_DE) >> 8;
+    snap.data[3] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_DE) & 0xff;
+    snap.data[4] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_DE) >> 8;
 
-    snap.data[5] = z80Core.GetRegister(CZ80Core::eREG_ALT_BC) & 0xff;
-    snap.data[6] = z80Core.GetRegister(CZ80Core::eREG_ALT_BC) >> 8;
+    snap.data[5] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_BC) & 0xff;
+    snap.data[6] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_BC) >> 8;
 
-    snap.data[7] = z80Core.GetRegister(CZ80Core::eREG_ALT_AF) & 0xff;
-    snap.data[8] = z80Core.GetRegister(CZ80Core::eREG_ALT_AF) >> 8;
+    snap.data[7] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_AF) & 0xff;
+    snap.data[8] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_AF) >> 8;
 
-    snap.data[9] = z80Core.GetRegister(CZ80Core::eREG_HL) & 0xff;
-    snap.data[10] = z80Core.GetRegister(CZ80Core::eREG_HL) >> 8;
+    snap.data[9] = z80Core.GetRegister(CZ80CoreBase::eREG_HL) & 0xff;
+    snap.data[10] = z80Core.GetRegister(CZ80CoreBase::eREG_HL) >> 8;
 
-    snap.data[11] = z80Core.GetRegister(CZ80Core::eREG_DE) & 0xff;
-    snap.data[12] = z80Core.GetRegister(CZ80Core::eREG_DE) >> 8;
+    snap.data[11] = z80Core.GetRegister(CZ80CoreBase::eREG_DE) & 0xff;
+    snap.data[12] = z80Core.GetRegister(CZ80CoreBase::eREG_DE) >> 8;
 
-    snap.data[13] = z80Core.GetRegister(CZ80Core::eREG_BC) & 0xff;
-    snap.data[14] = z80Core.GetRegister(CZ80Core::eREG_BC) >> 8;
+    snap.data[13] = z80Core.GetRegister(CZ80CoreBase::eREG_BC) & 0xff;
+    snap.data[14] = z80Core.GetRegister(CZ80CoreBase::eREG_BC) >> 8;
 
-    snap.data[15] = z80Core.GetRegister(CZ80Core::eREG_IY) & 0xff;
-    snap.data[16] = z80Core.GetRegister(CZ80Core::eREG_IY) >> 8;
+    snap.data[15] = z80Core.GetRegister(CZ80CoreBase::eREG_IY) & 0xff;
+    snap.data[16] = z80Core.GetRegister(CZ80CoreBase::eREG_IY) >> 8;
 
-    snap.data[17] = z80Core.GetRegister(CZ80Core::eREG_IX) & 0xff;
-    snap.data[18] = z80Core.GetRegister(CZ80Core::eREG_IX) >> 8;
+    snap.data[17] = z80Core.GetRegister(CZ80CoreBase::eREG_IX) & 0xff;
+    snap.data[18] = z80Core.GetRegister(CZ80CoreBase::eREG_IX) >> 8;
 
     snap.data[19] = static_cast<uint8_t>( (z80Core.GetIFF1() & 1) << 2 );
-    snap.data[20] = z80Core.GetRegister(CZ80Core::eREG_R);
+    snap.data[20] = z80Core.GetRegister(CZ80CoreBase::eREG_R);
 
-    snap.data[21] = z80Core.GetRegister(CZ80Core::eREG_AF) & 0xff;
-    snap.data[22] = z80Core.GetRegister(CZ80Core::eREG_AF) >> 8;
+    snap.data[21] = z80Core.GetRegister(CZ80CoreBase::eREG_AF) & 0xff;
+    snap.data[22] = z80Core.GetRegister(CZ80CoreBase::eREG_AF) >> 8;
 
-    uint16_t pc = z80Core.GetRegister(CZ80Core::eREG_PC);
-    uint16_t sp = z80Core.GetRegister(CZ80Core::eREG_SP) - 2;
+    uint16_t pc = z80Core.GetRegister(CZ80CoreBase::eREG_PC);
+    uint16_t sp = z80Core.GetRegister(CZ80CoreBase::eREG_SP) - 2;
 
     snap.data[23] = sp & 0xff;
     snap.data[24] = sp >> 8;
@@ -135,19 +135,19 @@ Tape::FileResponse ZXSpectrum::snapshotSNALoadWithBuffer(const char *buffer, siz
     if (size > 0)
     {
         // Decode the header
-        z80Core.SetRegister(CZ80Core::eREG_I, buffer[0]);
-        z80Core.SetRegister(CZ80Core::eREG_R, buffer[20]);
-        z80Core.SetRegister(CZ80Core::eREG_ALT_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[1]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[2]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_AF, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[3]));
-        z80Core.SetRegister(CZ80Core::eREG_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[4]));
-        z80Core.SetRegister(CZ80Core::eREG_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[5]));
-        z80Core.SetRegister(CZ80Core::eREG_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[6]));
-        z80Core.SetRegister(CZ80Core::eREG_IY, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[7]));
-        z80Core.SetRegister(CZ80Core::eREG_IX, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[8]));
-        z80Core.SetRegister(CZ80Core::eREG_AF, (reinterpret_cast<uint16_t *>(&pFileBytes[21])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_SP, (reinterpret_cast<uint16_t *>(&pFileBytes[21])[1]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_I, buffer[0]);
+        z80Core.SetRegister(CZ80CoreBase::eREG_R, buffer[20]);
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[1]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[2]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_AF, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[3]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[4]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[5]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[6]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_IY, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[7]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_IX, (reinterpret_cast<uint16_t *>(&pFileBytes[1])[8]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_AF, (reinterpret_cast<uint16_t *>(&pFileBytes[21])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_SP, (reinterpret_cast<uint16_t *>(&pFileBytes[21])[1]));
 
         // Border colour
         displayBorderColor = pFileBytes[26] & 0x07;
@@ -164,14 +164,14 @@ Tape::FileResponse ZXSpectrum::snapshotSNALoadWithBuffer(const char *buffer, siz
             uint32_t snaAddr = cSNA_HEADER_SIZE;
             for (uint32_t i = 16384; i < (64 * 1024); i++)
             {
-                memoryRam[i] = static_cast<char>( pFileBytes[snaAddr++] );
+                memoryRamWrite(i, static_cast<uint8_t>( pFileBytes[snaAddr++] ));
             }
 
             // Set the PC
-            uint8_t pc_lsb = static_cast<uint8_t>(memoryRam[z80Core.GetRegister(CZ80Core::eREG_SP)]);
-            uint8_t pc_msb = static_cast<uint8_t>(memoryRam[(z80Core.GetRegister(CZ80Core::eREG_SP) + 1)]);
-            z80Core.SetRegister(CZ80Core::eREG_PC, static_cast<uint16_t>((pc_msb << 8) | pc_lsb));
-            z80Core.SetRegister(CZ80Core::eREG_SP, z80Core.GetRegister(CZ80Core::eREG_SP) + 2);
+            uint8_t pc_lsb = memoryRamRead(z80Core.GetRegister(CZ80CoreBase::eREG_SP));
+            uint8_t pc_msb = memoryRamRead(z80Core.GetRegister(CZ80CoreBase::eREG_SP) + 1);
+            z80Core.SetRegister(CZ80CoreBase::eREG_PC, static_cast<uint16_t>((pc_msb << 8) | pc_lsb));
+            z80Core.SetRegister(CZ80CoreBase::eREG_SP, z80Core.GetRegister(CZ80CoreBase::eREG_SP) + 2);
         }
     }
 
@@ -218,38 +218,38 @@ ZXSpectrum::SnapshotData ZXSpectrum::snapshotCreateZ80()
     snapData.data = new uint8_t[ snapshotSize ];
 
     // Header
-    snapData.data[0] = z80Core.GetRegister(CZ80Core::eREG_A);
-    snapData.data[1] = z80Core.GetRegister(CZ80Core::eREG_F);
-    snapData.data[2] = z80Core.GetRegister(CZ80Core::eREG_BC) & 0xff;
-    snapData.data[3] = z80Core.GetRegister(CZ80Core::eREG_BC) >> 8;
-    snapData.data[4] = z80Core.GetRegister(CZ80Core::eREG_HL) & 0xff;
-    snapData.data[5] = z80Core.GetRegister(CZ80Core::eREG_HL) >> 8;
+    snapData.data[0] = z80Core.GetRegister(CZ80CoreBase::eREG_A);
+    snapData.data[1] = z80Core.GetRegister(CZ80CoreBase::eREG_F);
+    snapData.data[2] = z80Core.GetRegister(CZ80CoreBase::eREG_BC) & 0xff;
+    snapData.data[3] = z80Core.GetRegister(CZ80CoreBase::eREG_BC) >> 8;
+    snapData.data[4] = z80Core.GetRegister(CZ80CoreBase::eREG_HL) & 0xff;
+    snapData.data[5] = z80Core.GetRegister(CZ80CoreBase::eREG_HL) >> 8;
     snapData.data[6] = 0x0; // PC
     snapData.data[7] = 0x0;
-    snapData.data[8] = z80Core.GetRegister(CZ80Core::eREG_SP) & 0xff;
-    snapData.data[9] = z80Core.GetRegister(CZ80Core::eREG_SP) >> 8;
-    snapData.data[10] = z80Core.GetRegister(CZ80Core::eREG_I);
-    snapData.data[11] = z80Core.GetRegister(CZ80Core::eREG_R) & 0x7f;
+    snapData.data[8] = z80Core.GetRegister(CZ80CoreBase::eREG_SP) & 0xff;
+    snapData.data[9] = z80Core.GetRegister(CZ80CoreBase::eREG_SP) >> 8;
+    snapData.data[10] = z80Core.GetRegister(CZ80CoreBase::eREG_I);
+    snapData.data[11] = z80Core.GetRegister(CZ80CoreBase::eREG_R) & 0x7f;
 
-    uint8_t byte12 = z80Core.GetRegister(CZ80Core::eREG_R) >> 7;
+    uint8_t byte12 = z80Core.GetRegister(CZ80CoreBase::eREG_R) >> 7;
     byte12 |= (displayBorderColor & 0x07) << 1;
     byte12 &= ~(1 << 5);
     snapData.data[12] = byte12;
 
-    snapData.data[13] = z80Core.GetRegister(CZ80Core::eREG_E);            // E
-    snapData.data[14] = z80Core.GetRegister(CZ80Core::eREG_D);            // D
-    snapData.data[15] = z80Core.GetRegister(CZ80Core::eREG_ALT_C);        // C'
-    snapData.data[16] = z80Core.GetRegister(CZ80Core::eREG_ALT_B);        // B'
-    snapData.data[17] = z80Core.GetRegister(CZ80Core::eREG_ALT_E);        // E'
-    snapData.data[18] = z80Core.GetRegister(CZ80Core::eREG_ALT_D);        // D'
-    snapData.data[19] = z80Core.GetRegister(CZ80Core::eREG_ALT_L);        // L'
-    snapData.data[20] = z80Core.GetRegister(CZ80Core::eREG_ALT_H);        // H'
-    snapData.data[21] = z80Core.GetRegister(CZ80Core::eREG_ALT_A);        // A'
-    snapData.data[22] = z80Core.GetRegister(CZ80Core::eREG_ALT_F);        // F'
-    snapData.data[23] = z80Core.GetRegister(CZ80Core::eREG_IY) & 0xff;    // IY
-    snapData.data[24] = z80Core.GetRegister(CZ80Core::eREG_IY) >> 8;      //
-    snapData.data[25] = z80Core.GetRegister(CZ80Core::eREG_IX) & 0xff;    // IX
-    snapData.data[26] = z80Core.GetRegister(CZ80Core::eREG_IX) >> 8;      //
+    snapData.data[13] = z80Core.GetRegister(CZ80CoreBase::eREG_E);            // E
+    snapData.data[14] = z80Core.GetRegister(CZ80CoreBase::eREG_D);            // D
+    snapData.data[15] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_C);        // C'
+    snapData.data[16] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_B);        // B'
+    snapData.data[17] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_E);        // E'
+    snapData.data[18] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_D);        // D'
+    snapData.data[19] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_L);        // L'
+    snapData.data[20] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_H);        // H'
+    snapData.data[21] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_A);        // A'
+    snapData.data[22] = z80Core.GetRegister(CZ80CoreBase::eREG_ALT_F);        // F'
+    snapData.data[23] = z80Core.GetRegister(CZ80CoreBase::eREG_IY) & 0xff;    // IY
+    snapData.data[24] = z80Core.GetRegister(CZ80CoreBase::eREG_IY) >> 8;      //
+    snapData.data[25] = z80Core.GetRegister(CZ80CoreBase::eREG_IX) & 0xff;    // IX
+    snapData.data[26] = z80Core.GetRegister(CZ80CoreBase::eREG_IX) >> 8;      //
     snapData.data[27] = (z80Core.GetIFF1()) ? 0xff : 0x0;
     snapData.data[28] = (z80Core.GetIFF2()) ? 0xff : 0x0;
     snapData.data[29] = z80Core.GetIMMode() & 0x03;                       // IM Mode
@@ -258,8 +258,8 @@ ZXSpectrum::SnapshotData ZXSpectrum::snapshotCreateZ80()
     snapData.data[30] = (cZ80_V3_ADD_HEADER_SIZE) & 0xff;                 // Additional Header Length
     snapData.data[31] = (cZ80_V3_ADD_HEADER_SIZE) >> 8;
 
-    snapData.data[32] = z80Core.GetRegister(CZ80Core::eREG_PC) & 0xff;    // PC
-    snapData.data[33] = z80Core.GetRegister(CZ80Core::eREG_PC) >> 8;
+    snapData.data[32] = z80Core.GetRegister(CZ80CoreBase::eREG_PC) & 0xff;    // PC
+    snapData.data[33] = z80Core.GetRegister(CZ80CoreBase::eREG_PC) >> 8;
 
     switch (machineInfo.machineType) {
         case eZXSpectrum48:
@@ -365,7 +365,7 @@ ZXSpectrum::SnapshotData ZXSpectrum::snapshotCreateZ80()
 
                 for (uint32_t memAddr = page * 0x4000ul; memAddr < (page * 0x4000ul) + 0x4000ul; memAddr++)
                 {
-                    snapData.data[snapPtr++] = static_cast<uint8_t>(memoryRam[static_cast<size_t>(memAddr)]);
+                    snapData.data[snapPtr++] = memoryRamRead(memAddr);
                 }
             }
             break;
@@ -438,14 +438,14 @@ Tape::FileResponse ZXSpectrum::snapshotZ80LoadWithBuffer(const char *buffer, siz
         }
         std::cout << "Loading Z80 snapshot v" << version << ": " << "\n";
 
-        z80Core.SetRegister(CZ80Core::eREG_A, pFileBytes[0]);
-        z80Core.SetRegister(CZ80Core::eREG_F, pFileBytes[1]);
-        z80Core.SetRegister(CZ80Core::eREG_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[2])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[2])[1]));
-        z80Core.SetRegister(CZ80Core::eREG_PC, pc);
-        z80Core.SetRegister(CZ80Core::eREG_SP, (reinterpret_cast<uint16_t *>(&pFileBytes[8])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_I, static_cast<uint8_t>(pFileBytes[10]));
-        z80Core.SetRegister(CZ80Core::eREG_R, static_cast<uint8_t>((pFileBytes[11] & 127) | ((pFileBytes[12] & 1) << 7)));
+        z80Core.SetRegister(CZ80CoreBase::eREG_A, pFileBytes[0]);
+        z80Core.SetRegister(CZ80CoreBase::eREG_F, pFileBytes[1]);
+        z80Core.SetRegister(CZ80CoreBase::eREG_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[2])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[2])[1]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_PC, pc);
+        z80Core.SetRegister(CZ80CoreBase::eREG_SP, (reinterpret_cast<uint16_t *>(&pFileBytes[8])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_I, static_cast<uint8_t>(pFileBytes[10]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_R, static_cast<uint8_t>((pFileBytes[11] & 127) | ((pFileBytes[12] & 1) << 7)));
 
         // Decode byte 12
         //    Bit 0  : Bit 7 of the R-register
@@ -461,14 +461,14 @@ Tape::FileResponse ZXSpectrum::snapshotZ80LoadWithBuffer(const char *buffer, siz
         displayBorderColor = (byte12 & 14) >> 1;
         bool compressed = (byte12 & 32) != 0 ? true : false;
 
-        z80Core.SetRegister(CZ80Core::eREG_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[1]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[2]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[3]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_A, static_cast<uint8_t>(pFileBytes[21]));
-        z80Core.SetRegister(CZ80Core::eREG_ALT_F, static_cast<uint8_t>(pFileBytes[22]));
-        z80Core.SetRegister(CZ80Core::eREG_IY, (reinterpret_cast<uint16_t *>(&pFileBytes[23])[0]));
-        z80Core.SetRegister(CZ80Core::eREG_IX, (reinterpret_cast<uint16_t *>(&pFileBytes[23])[1]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_BC, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[1]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_DE, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[2]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_HL, (reinterpret_cast<uint16_t *>(&pFileBytes[13])[3]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_A, static_cast<uint8_t>(pFileBytes[21]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_ALT_F, static_cast<uint8_t>(pFileBytes[22]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_IY, (reinterpret_cast<uint16_t *>(&pFileBytes[23])[0]));
+        z80Core.SetRegister(CZ80CoreBase::eREG_IX, (reinterpret_cast<uint16_t *>(&pFileBytes[23])[1]));
         z80Core.SetIFF1(static_cast<uint8_t>(pFileBytes[27] & 1));
         z80Core.SetIFF2(static_cast<uint8_t>(pFileBytes[28] & 1));
         z80Core.SetIMMode(static_cast<uint8_t>(pFileBytes[29] & 3));
@@ -530,6 +530,8 @@ Tape::FileResponse ZXSpectrum::snapshotZ80LoadWithBuffer(const char *buffer, siz
                 emuDisplayPage = 1;
             }
 
+            memoryMapUpdate();
+
             while (offset < size)
             {
                 uint32_t compressedLength = reinterpret_cast<uint16_t*>(&pFileBytes[offset])[0];
@@ -606,14 +608,14 @@ void ZXSpectrum::snapshotExtractMemoryBlock(const char *buffer, size_t bufferSiz
 
     if (!isCompressed)
     {
-        while (memoryPtr < unpackedLength + memAddr && memoryPtr + 1 < memoryRam.size())
+        while (memoryPtr < unpackedLength + memAddr && memoryPtr + 1 < memoryRamSize())
         {
-            memoryRam[memoryPtr++] = static_cast<int8_t>(fileBytes[filePtr++]);
+            memoryRamWrite(memoryPtr++, static_cast<uint8_t>(fileBytes[filePtr++]));
         }
     }
     else
     {
-        while (memoryPtr < unpackedLength + memAddr && memoryPtr < memoryRam.size())
+        while (memoryPtr < unpackedLength + memAddr && memoryPtr < memoryRamSize())
         {
             uint8_t byte1 = fileBytes[filePtr];
             
@@ -629,7 +631,7 @@ void ZXSpectrum::snapshotExtractMemoryBlock(const char *buffer, size_t bufferSiz
                         uint8_t value = fileBytes[filePtr + 3];
                         for (int i = 0; i < count; i++)
                         {
-                            memoryRam[memoryPtr++] = static_cast<int8_t>(value);
+                            memoryRamWrite(memoryPtr++, value);
                         }
                         filePtr += 4;
                         continue;
@@ -643,7 +645,7 @@ void ZXSpectrum::snapshotExtractMemoryBlock(const char *buffer, size_t bufferSiz
             }
             
             // Getting here means no compressed bytes were found, so just load the byte into memory
-            memoryRam[memoryPtr++] = static_cast<int8_t>(fileBytes.at(filePtr++));
+            memoryRamWrite(memoryPtr++, static_cast<uint8_t>(fileBytes.at(filePtr++)));
         }
     }
 }
@@ -0,0 +1,639 @@
+//
+//  TapeLoader.cpp
+//  SpectREM
+//
+//  Created by Michael Daley on 17/10/2026.
+//  Copyright © 2026 Mike Daley Ltd. All rights reserved.
+//
+
+#include "ZXSpectrum.hpp"
+#include <algorithm>
+
+/**
+ Flash loading
+
+ Tape loaders spend nearly all of their time in a short loop that reads the EAR bit from port 0xFE, checks whether it
+ has changed and counts how long it has been waiting, such as the ROM's LD-SAMPLE loop:
+
+    INC B, RET Z, LD A,$7F, IN A,($FE), RRA, RET NC, XOR C, AND $20, JR Z,LD-SAMPLE
+
+ Until the next edge arrives nothing changes from one time round to the next apart from the counter, R and the
+ t-states, so the loop can be run forward to the last time round before it would see that edge in one go.
+
+ A loop is found from the jump back to its start. Its instructions have to come from a short list that can't write to
+ memory, only reads even ports and only leaves the loop on a condition, and they are broken down into machine cycles
+ so the time each pass takes, contention included, is known without running the CPU. The CPU must then be seen going
+ round the loop once with nothing else changing, and the cycles must add up to exactly the time that pass took, before
+ the loop is run forward. It stops short of the pass that would read the EAR bit at or after the next edge, that would
+ make the counter give up, or that would run into the next scheduled event
+ **/
+
+// Byte registers in the order instructions encode them. Slot 6 is (HL), which is never accepted
+static const CZ80CoreBase::eZ80BYTEREGISTERS cLOADER_REGISTERS[8] =
+{
+    CZ80CoreBase::eREG_B, CZ80CoreBase::eREG_C, CZ80CoreBase::eREG_D, CZ80CoreBase::eREG_E,
+    CZ80CoreBase::eREG_H, CZ80CoreBase::eREG_L, CZ80CoreBase::eREG_F, CZ80CoreBase::eREG_A
+};
+
+// Flags tested by the conditions NZ/Z, NC/C, PO/PE and P/M
+static const uint8_t cCONDITION_FLAGS[4] = { CZ80CoreBase::FLAG_Z, CZ80CoreBase::FLAG_C, CZ80CoreBase::FLAG_P, CZ80CoreBase::FLAG_S };
+
+// Flags INC and DEC set from their result
+static const uint8_t cCOUNTER_FLAGS = CZ80CoreBase::FLAG_S | CZ80CoreBase::FLAG_Z | CZ80CoreBase::FLAG_H | CZ80CoreBase::FLAG_P |
+                                      CZ80CoreBase::FLAG_3 | CZ80CoreBase::FLAG_5;
+
+// A register's value as tracked through a loop: a fixed byte, the register's value at the start of the loop or unknown
+static const int16_t cVALUE_AT_HEAD = 0x100;
+static const int16_t cVALUE_UNKNOWN = -1;
+
+// ------------------------------------------------------------------------------------------------------------
+
+static uint8_t &loaderRegister(CZ80CoreBase::Z80SavedState &state, int32_t reg)
+{
+    switch (reg)
+    {
+        case 0: return state.registers.regs.regB;
+        case 1: return state.registers.regs.regC;
+        case 2: return state.registers.regs.regD;
+        case 3: return state.registers.regs.regE;
+        case 4: return state.registers.regs.regH;
+        case 5: return state.registers.regs.regL;
+        default: return state.registers.regs.regA;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+// The flags tested by a loop that depend on the value the counter was just counted to
+static uint8_t loaderCounterFlags(uint8_t value, int32_t step, uint8_t flags)
+{
+    uint8_t result = (value & 0x80) ? CZ80CoreBase::FLAG_S : 0;
+    result |= (value == 0) ? CZ80CoreBase::FLAG_Z : 0;
+    result |= (value == ((step > 0) ? 0x80 : 0x7f)) ? CZ80CoreBase::FLAG_P : 0;
+    return result & flags;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Finding loops
+
+void ZXSpectrum::tapeLoaderOpcode(uint8_t opcode, uint16_t address)
+{
+    if (tapeLoader.valid)
+    {
+        if (address == tapeLoader.headFetch)
+        {
+            tapeLoaderFastForward();
+            return;
+        }
+
+        // Once the loop has been left it has to be seen going round again before it can be run forward
+        if (address < tapeLoader.head || address > tapeLoader.jump)
+        {
+            tapeLoader.observed = false;
+        }
+        else if (address == tapeLoader.jump)
+        {
+            return;
+        }
+    }
+
+    // Only a jump backwards can close a loop
+    auto read = [this](uint16_t a) { return memoryReadPages[ a / cMEMORY_PAGE_SIZE ][ a & (cMEMORY_PAGE_SIZE - 1) ]; };
+    uint16_t target = 0;
+
+    if (opcode == 0x10 || opcode == 0x18 || (opcode & 0xe7) == 0x20)
+    {
+        target = static_cast<uint16_t>(address + 2 + static_cast<int8_t>(read(address + 1)));
+    }
+    else if (opcode == 0xc3 || (opcode & 0xc7) == 0xc2)
+    {
+        target = static_cast<uint16_t>(read(address + 1) | (read(address + 2) << 8));
+    }
+    else
+    {
+        return;
+    }
+
+    // The jump itself, at most three bytes long, has to fit in the copy of the loop
+    if (target >= address || static_cast<uint32_t>(address + 3 - target) > cTAPE_LOADER_MAX_LENGTH)
+    {
+        return;
+    }
+
+    uint16_t &rejected = tapeLoaderRejected[ address & 0x07 ];
+    if (rejected != address && !tapeLoaderAnalyse(target, address))
+    {
+        rejected = address;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool ZXSpectrum::tapeLoaderAnalyse(uint16_t head, uint16_t jump)
+{
+    auto read = [this](uint16_t a) { return memoryReadPages[ a / cMEMORY_PAGE_SIZE ][ a & (cMEMORY_PAGE_SIZE - 1) ]; };
+
+    TapeLoaderCycle cycles[cTAPE_LOADER_MAX_CYCLES];
+    uint32_t cycleCount = 0;
+    uint32_t headCycles = 0;
+
+    auto memoryCycle = [&](uint16_t address, uint8_t tStates, bool ir)
+    {
+        if (cycleCount < cTAPE_LOADER_MAX_CYCLES)
+        {
+            cycles[ cycleCount ] = TapeLoaderCycle{ false, ir, tStates, address, 0, 0 };
+        }
+        cycleCount++;
+    };
+
+    // IO cycles take all of their t-states from the contention table
+    auto ioCycle = [&](int16_t portHigh, int16_t portLow)
+    {
+        if (cycleCount < cTAPE_LOADER_MAX_CYCLES)
+        {
+            cycles[ cycleCount ] = TapeLoaderCycle{ true, false, 0, 0, portHigh, portLow };
+        }
+        cycleCount++;
+    };
+
+    int16_t value[8];
+    for (int16_t i = 0; i < 8; i++)
+    {
+        value[i] = cVALUE_AT_HEAD | i;
+    }
+
+    // Registers read or written by anything other than the counter's INC or DEC
+    uint8_t reads = 0;
+    uint8_t writes = 0;
+
+    int32_t counter = -1;
+    int32_t counterStep = 0;
+    uint8_t counterFlags = 0;
+    uint8_t tainted = 0;
+    bool sampled = false;
+    bool closed = false;
+    uint16_t pc = head;
+
+    while (!closed)
+    {
+        if (pc > jump)
+        {
+            return false;
+        }
+
+        const uint8_t opcode = read(pc);
+        const uint32_t r = (opcode >> 3) & 0x07;
+        const uint32_t s = opcode & 0x07;
+        uint16_t length = 1;
+        bool jumpBack = false;
+
+        memoryCycle(pc, 4, false);
+
+        if (opcode == 0x00)
+        {
+            // NOP
+        }
+        else if ((opcode & 0xc6) == 0x04)
+        {
+            // INC r, DEC r
+            if (r == 6 || counter >= 0)
+            {
+                return false;
+            }
+            counter = static_cast<int32_t>(r);
+            counterStep = (opcode & 0x01) ? -1 : 1;
+            tainted = cCOUNTER_FLAGS;
+            value[r] = cVALUE_UNKNOWN;
+        }
+        else if ((opcode & 0xc7) == 0x06)
+        {
+            // LD r,n
+            if (r == 6)
+            {
+                return false;
+            }
+            memoryCycle(pc + 1, 3, false);
+            value[r] = read(pc + 1);
+            writes |= 1 << r;
+            length = 2;
+        }
+        else if (opcode >= 0x40 && opcode < 0x80)
+        {
+            // LD r,r'
+            if (r == 6 || s == 6)
+            {
+                return false;
+            }
+            value[r] = value[s];
+            reads |= 1 << s;
+            writes |= 1 << r;
+        }
+        else if ((opcode & 0xe7) == 0x07)
+        {
+            // RLCA, RRCA, RLA, RRA
+            tainted &= ~(CZ80CoreBase::FLAG_H | CZ80CoreBase::FLAG_3 | CZ80CoreBase::FLAG_5);
+            value[7] = cVALUE_UNKNOWN;
+            reads |= 1 << 7;
+            writes |= 1 << 7;
+        }
+        else if ((opcode & 0xc0) == 0x80 || (opcode & 0xc7) == 0xc6)
+        {
+            // ALU A,r and ALU A,n. Everything but CP changes A
+            if (opcode & 0x40)
+            {
+                memoryCycle(pc + 1, 3, false);
+                length = 2;
+            }
+            else if (s == 6)
+            {
+                return false;
+            }
+            else
+            {
+                reads |= 1 << s;
+            }
+
+            reads |= 1 << 7;
+            if (r != 7)
+            {
+                value[7] = cVALUE_UNKNOWN;
+                writes |= 1 << 7;
+            }
+            tainted = 0;
+        }
+        else if (opcode == 0xdb)
+        {
+            // IN A,(n) with A giving the top half of the port
+            const uint8_t port = read(pc + 1);
+            if ((port & 0x01) || value[7] == cVALUE_UNKNOWN)
+            {
+                return false;
+            }
+            memoryCycle(pc + 1, 3, false);
+            ioCycle(value[7], port);
+            value[7] = cVALUE_UNKNOWN;
+            reads |= 1 << 7;
+            writes |= 1 << 7;
+            sampled = true;
+            length = 2;
+        }
+        else if (opcode == 0xed || opcode == 0xcb)
+        {
+            const uint8_t prefixed = read(pc + 1);
+            const uint32_t pr = (prefixed >> 3) & 0x07;
+            const uint32_t ps = prefixed & 0x07;
+
+            memoryCycle(pc + 1, 4, false);
+            length = 2;
+
+            if (opcode == 0xed && (prefixed & 0xc7) == 0x40)
+            {
+                // IN r,(C), or IN F,(C) which only sets the flags
+                if (value[0] == cVALUE_UNKNOWN || value[1] == cVALUE_UNKNOWN || (value[1] < cVALUE_AT_HEAD && (value[1] & 0x01)))
+                {
+                    return false;
+                }
+                ioCycle(value[0], value[1]);
+                reads |= 0x03;
+                if (pr != 6)
+                {
+                    value[pr] = cVALUE_UNKNOWN;
+                    writes |= 1 << pr;
+                }
+                tainted = 0;
+                sampled = true;
+            }
+            else if (opcode == 0xcb && (prefixed & 0xc0) == 0x40 && ps != 6)
+            {
+                // BIT b,r
+                reads |= 1 << ps;
+                tainted = 0;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else if ((opcode & 0xc7) == 0xc0)
+        {
+            // RET cc, which leaves the loop
+            memoryCycle(0, 1, true);
+            counterFlags |= tainted & cCONDITION_FLAGS[ r >> 1 ];
+        }
+        else if (opcode == 0x10 || opcode == 0x18 || (opcode & 0xe7) == 0x20)
+        {
+            // DJNZ, JR and JR cc. Only a conditional JR can leave the loop, anything else has to be the jump back
+            const uint16_t target = static_cast<uint16_t>(pc + 2 + static_cast<int8_t>(read(pc + 1)));
+            length = 2;
+            jumpBack = (pc == jump);
+
+            if (jumpBack ? target != head : (opcode < 0x20 || (target >= head && target <= jump)))
+            {
+                return false;
+            }
+
+            if (opcode == 0x10)
+            {
+                // DJNZ counts B itself and gives up when it reaches 0
+                if (counter >= 0)
+                {
+                    return false;
+                }
+                memoryCycle(0, 1, true);
+                counter = 0;
+                counterStep = -1;
+                counterFlags |= CZ80CoreBase::FLAG_Z;
+            }
+            else if (opcode >= 0x20)
+            {
+                counterFlags |= tainted & cCONDITION_FLAGS[ (r - 4) >> 1 ];
+            }
+
+            memoryCycle(pc + 1, 3, false);
+            if (jumpBack)
+            {
+                for (uint32_t i = 0; i < 5; i++)
+                {
+                    memoryCycle(pc + 1, 1, false);
+                }
+            }
+        }
+        else if (opcode == 0xc3 || (opcode & 0xc7) == 0xc2)
+        {
+            // JP and JP cc, with the same rules as JR
+            const uint16_t target = static_cast<uint16_t>(read(pc + 1) | (read(pc + 2) << 8));
+            length = 3;
+            jumpBack = (pc == jump);
+
+            if (jumpBack ? target != head : (opcode == 0xc3 || (target >= head && target <= jump)))
+            {
+                return false;
+            }
+
+            if (opcode != 0xc3)
+            {
+                counterFlags |= tainted & cCONDITION_FLAGS[ r >> 1 ];
+            }
+
+            memoryCycle(pc + 1, 3, false);
+            memoryCycle(pc + 2, 3, false);
+        }
+        else
+        {
+            return false;
+        }
+
+        if (pc == jump && !jumpBack)
+        {
+            return false;
+        }
+
+        if (pc == head)
+        {
+            headCycles = (opcode == 0xed || opcode == 0xcb) ? 2 : 1;
+        }
+
+        closed = jumpBack;
+        pc = static_cast<uint16_t>(pc + length);
+    }
+
+    // The loop has to read the tape. Apart from its INC or DEC, nothing may touch the counter, and any flags set from
+    // it must be gone by the end of the loop, otherwise the passes would differ by more than the counter
+    if (!sampled || cycleCount > cTAPE_LOADER_MAX_CYCLES)
+    {
+        return false;
+    }
+
+    if (counter >= 0 && (tainted || ((reads | writes) & (1 << counter))))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < cycleCount; i++)
+    {
+        const TapeLoaderCycle &cycle = cycles[i];
+        if (cycle.io && (cycle.portHigh == (cVALUE_AT_HEAD | counter) || cycle.portLow == (cVALUE_AT_HEAD | counter)))
+        {
+            return false;
+        }
+    }
+
+    // The CPU is stopped just after fetching the instruction at head, so the cycles are kept in the order they follow on
+    // from there
+    TapeLoaderLoop &loop = tapeLoader;
+    loop.valid = true;
+    loop.observed = false;
+    loop.head = head;
+    loop.headFetch = static_cast<uint16_t>(head + headCycles - 1);
+    loop.jump = jump;
+    loop.length = static_cast<uint32_t>(pc - head);
+    loop.cycleCount = cycleCount;
+    loop.counter = counter;
+    loop.counterStep = counterStep;
+    loop.counterFlags = counterFlags;
+
+    for (uint32_t i = 0; i < loop.length; i++)
+    {
+        loop.code[i] = read(static_cast<uint16_t>(head + i));
+    }
+
+    for (uint32_t i = 0; i < cycleCount; i++)
+    {
+        loop.cycles[i] = cycles[ (i + headCycles) % cycleCount ];
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Running loops forward
+
+void ZXSpectrum::tapeLoaderFastForward()
+{
+    TapeLoaderLoop &loop = tapeLoader;
+
+    // The loader may have loaded something new over the loop
+    for (uint32_t i = 0; i < loop.length; i++)
+    {
+        const uint16_t address = static_cast<uint16_t>(loop.head + i);
+        if (memoryReadPages[ address / cMEMORY_PAGE_SIZE ][ address & (cMEMORY_PAGE_SIZE - 1) ] != loop.code[i])
+        {
+            loop.valid = false;
+            return;
+        }
+    }
+
+    CZ80CoreBase::Z80SavedState state;
+    z80Core.GetState(state);
+
+    const uint64_t edgeTs = static_cast<uint64_t>(tapeCurrentTs) + tapePlayer->tsToNextEdge();
+    const bool repeated = loop.observed && loop.edgeTs == edgeTs && tapeLoaderRepeated(state);
+    const CZ80CoreBase::Z80SavedState previous = loop.state;
+
+    loop.observed = true;
+    loop.state = state;
+    loop.edgeTs = edgeTs;
+
+    // A request stays pending until it is accepted, which can't happen with interrupts disabled as the loop can't enable them
+    if (!repeated || state.registers.IFF1 || state.registers.NMIReq)
+    {
+        return;
+    }
+
+    // Contention for each cycle, using the registers as they are at the start of the loop to find the ports
+    for (uint32_t i = 0; i < loop.cycleCount; i++)
+    {
+        const TapeLoaderCycle &cycle = loop.cycles[i];
+        uint16_t address = cycle.ir ? static_cast<uint16_t>(state.registers.regI << 8) : cycle.address;
+
+        if (cycle.io)
+        {
+            auto portByte = [&state](int16_t source)
+            {
+                return (source < cVALUE_AT_HEAD) ? static_cast<uint8_t>(source) : loaderRegister(state, source & 0x07);
+            };
+            address = static_cast<uint16_t>((portByte(cycle.portHigh) << 8) | portByte(cycle.portLow));
+            if (address & 0x01)
+            {
+                return;
+            }
+        }
+
+        const bool contended = (memoryPageFlags[ address / cMEMORY_PAGE_SIZE ] & cMEMORY_PAGE_CONTENDED) != 0;
+        if (cycle.io)
+        {
+            tapeLoaderTables[i] = ULAIOContentionTable[ contended ? IO_C1_C3 : IO_N1_C3 ];
+        }
+        else
+        {
+            tapeLoaderTables[i] = contended ? ULAMemoryContentionTable : nullptr;
+        }
+    }
+
+    // The cycles have to account for the pass just made exactly, and that pass can't already have seen the edge
+    bool edgeSeen = false;
+    uint32_t sampleTs = 0;
+    if (tapeLoaderIteration(previous.registers.TStates, edgeTs, edgeSeen, sampleTs) != state.registers.TStates || sampleTs != tapeSampleTs)
+    {
+        loop.valid = false;
+        return;
+    }
+
+    if (edgeSeen)
+    {
+        return;
+    }
+
+    const uint32_t ts = state.registers.TStates;
+    const uint32_t limitTs = std::min(schedulerNextEventTs(), machineInfo.tsPerFrame);
+    const uint8_t counterValue = (loop.counter >= 0) ? loaderRegister(state, loop.counter) : 0;
+    const uint8_t counterFlags = loaderCounterFlags(counterValue, loop.counterStep, loop.counterFlags);
+
+    uint32_t passes = 0;
+    uint32_t passTs = ts;
+
+    while (passTs < limitTs)
+    {
+        const uint8_t nextValue = static_cast<uint8_t>(counterValue + (passes + 1) * loop.counterStep);
+        if (loaderCounterFlags(nextValue, loop.counterStep, loop.counterFlags) != counterFlags)
+        {
+            break;
+        }
+
+        const uint32_t nextTs = tapeLoaderIteration(passTs, edgeTs, edgeSeen, sampleTs);
+        if (edgeSeen || nextTs >= limitTs)
+        {
+            break;
+        }
+
+        passTs = nextTs;
+        passes++;
+    }
+
+    if (passes == 0)
+    {
+        return;
+    }
+
+    const uint8_t rStep = static_cast<uint8_t>((state.registers.regR - previous.registers.regR) & 0x7f);
+    const uint8_t r = state.registers.regR;
+
+    z80Core.AddTStates(passTs - ts);
+    z80Core.SetRegister(CZ80CoreBase::eREG_R, static_cast<uint8_t>((r & 0x80) | ((r + passes * rStep) & 0x7f)));
+    if (loop.counter >= 0)
+    {
+        z80Core.SetRegister(cLOADER_REGISTERS[ loop.counter ], static_cast<uint8_t>(counterValue + passes * loop.counterStep));
+    }
+
+    z80Core.GetState(loop.state);
+    emuTapeLoaderActive = true;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+// True when the only changes since the CPU was last at the head of the loop are one step of the counter, R and the
+// t-states
+bool ZXSpectrum::tapeLoaderRepeated(const CZ80CoreBase::Z80SavedState &state)
+{
+    CZ80CoreBase::Z80SavedState before = tapeLoader.state;
+    CZ80CoreBase::Z80SavedState after = state;
+
+    if (tapeLoader.counter >= 0)
+    {
+        uint8_t &counterBefore = loaderRegister(before, tapeLoader.counter);
+        uint8_t &counterAfter = loaderRegister(after, tapeLoader.counter);
+
+        if (static_cast<uint8_t>(counterBefore + tapeLoader.counterStep) != counterAfter)
+        {
+            return false;
+        }
+        counterBefore = counterAfter;
+    }
+
+    const auto &a = before.registers;
+    const auto &b = after.registers;
+
+    return memcmp(&a.reg_pairs, &b.reg_pairs, sizeof(a.reg_pairs)) == 0 &&
+        a.regSP == b.regSP && a.regPC == b.regPC && a.regI == b.regI && (a.regR & 0x80) == (b.regR & 0x80) &&
+        a.IFF1 == b.IFF1 && a.IFF2 == b.IFF2 && a.IM == b.IM && a.Halted == b.Halted && a.EIHandled == b.EIHandled &&
+        a.IntReq == b.IntReq && a.NMIReq == b.NMIReq && a.DDFDmultiByte == b.DDFDmultiByte &&
+        before.memptr == after.memptr && before.prevOpcodeFlags == after.prevOpcodeFlags &&
+        before.iff2Read == after.iff2Read && before.ldIA == after.ldIA;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+// Times one pass of the loop starting at ts and returns when the next one starts. sampleTs is when the EAR bit was
+// last read and edgeSeen is set if it was read at or after edgeTs
+uint32_t ZXSpectrum::tapeLoaderIteration(uint32_t ts, uint64_t edgeTs, bool &edgeSeen, uint32_t &sampleTs)
+{
+    for (uint32_t i = 0; i < tapeLoader.cycleCount; i++)
+    {
+        const uint8_t *table = tapeLoaderTables[i];
+        if (table)
+        {
+            ts += table[ts];
+        }
+        ts += tapeLoader.cycles[i].tStates;
+
+        if (tapeLoader.cycles[i].io)
+        {
+            sampleTs = ts;
+            edgeSeen = edgeSeen || ts >= edgeTs;
+        }
+    }
+
+    return ts;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::tapeLoaderReset()
+{
+    tapeLoader.observed = false;
+
+    for (uint16_t &rejected : tapeLoaderRejected)
+    {
+        rejected = 0;
+    }
+}
@@ -7,32 +7,27 @@
 //
 
 #include "ZXSpectrum.hpp"
+#include <algorithm>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
 // ------------------------------------------------------------------------------------------------------------
 // - Constants
 
-const uint32_t cSAMPLE_RATE = 44100;
-const uint32_t cFPS = 50;
 const uint32_t cROM_SIZE = 16384;
 
 // ------------------------------------------------------------------------------------------------------------
 // - Constructor/Deconstructor
 
-ZXSpectrum::ZXSpectrum()
+ZXSpectrum::ZXSpectrum(CZ80CoreBase &core) : z80Core(core)
 {
 	std::cout << "ZXSpectrum::Constructor" << "\n";
-
-	displayCLUT = new uint64_t[32 * 1024];
-	displayALUT = new uint8_t[256];
 }
 
 ZXSpectrum::~ZXSpectrum()
 {
 	std::cout << "ZXSpectrum::Destructor" << "\n";
-
-	delete[] displayCLUT;
-	delete[] displayALUT;
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -42,35 +37,97 @@ void ZXSpectrum::initialise(std::string romPath)
 {
 	std::cout << "ZXSpectrum::initialise(char *romPath)" << "\n";
 
-	z80Core.Initialise(zxSpectrumMemoryRead,
-		zxSpectrumMemoryWrite,
-		zxSpectrumIORead,
-		zxSpectrumIOWrite,
-		zxSpectrumMemoryContention,
-		zxSpectrumDebugRead,
+	emuROMPath = romPath;
+
+	memoryRomPages.clear();
+	for (uint32_t i = 0; i < machineInfo.romSize / cMEMORY_PAGE_SIZE; i++)
+	{
+		memoryRomPages.push_back(std::make_shared<MemoryPage>());
+	}
+
+	memoryRamPages.clear();
+	for (uint32_t i = 0; i < machineInfo.ramSize / cMEMORY_PAGE_SIZE; i++)
+	{
+		memoryRamPages.push_back(std::make_shared<MemoryPage>());
+	}
+
+	initialiseComponents();
+	resetMachine(true);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::initialiseComponents()
+{
+	z80Core.Initialise(zxSpectrumDebugRead,
 		zxSpectrumDebugWrite,
 		this);
 
-	emuROMPath = romPath;
-
 	screenWidth = machineInfo.pxEmuBorder + machineInfo.pxHorizontalDisplay + machineInfo.pxEmuBorder;
 	screenHeight = machineInfo.pxEmuBorder + machineInfo.pxVerticalDisplay + machineInfo.pxEmuBorder;
 	screenBufferSize = screenHeight * screenWidth;
 
-	memoryRom.resize(machineInfo.romSize);
-	memoryRam.resize(machineInfo.ramSize);
-
 	displaySetup();
-	displayBuildLineAddressTable();
-	displayBuildTsTable();
-	displayBuildCLUT();
-
-	ULABuildContentionTable(machineInfo.altContention);
-
-	audioSetup(cSAMPLE_RATE, cFPS);
+	const ModelTables &modelTables = modelTablesForMachine(machineInfo);
+	ULAMemoryContentionTable = modelTables.memoryContention;
+	ULAIOContentionTable = modelTables.ioContention;
+	displaySpans = modelTables.displaySpans;
+	displayFetchTable = modelTables.displayFetch;
+
+	const DisplayTables &sharedDisplayTables = displayTables();
+	displayLineAddrTable = sharedDisplayTables.lineAddr;
+	displayCLUT = sharedDisplayTables.clut;
+	displayALUT = sharedDisplayTables.alut;
+
+	audioSetup();
 	audioBuildAYVolumesTable();
+}
 
-	resetMachine(true);
+// ------------------------------------------------------------------------------------------------------------
+// - Fork
+
+ZXSpectrum *ZXSpectrum::fork(Tape *tape)
+{
+	ZXSpectrum *machine = forkInstance(tape);
+
+	machine->machineInfo = machineInfo;
+	machine->emuBasePath = emuBasePath;
+	machine->emuROMPath = emuROMPath;
+	machine->emuHeadless = true;
+	machine->emuPaused = emuPaused;
+	machine->emuTapeInstantLoad = emuTapeInstantLoad;
+	machine->emuUseAYSound = emuUseAYSound;
+	machine->emuUseSpecDRUM = emuUseSpecDRUM;
+	machine->audioSampleRate = audioSampleRate;
+	machine->audioRateAdjustment = audioRateAdjustment;
+
+	machine->z80Core.setCPUMan(static_cast<CZ80CoreBase::eCPUMANUFACTURER>(z80Core.getCPUMan()));
+	machine->z80Core.setCPUType(static_cast<CZ80CoreBase::eCPUTYPE>(z80Core.getCPUType()));
+	machine->z80Core.RegisterOpcodeCallback(z80Core.getOpcodeCallback());
+
+	// Both machines now share every page, so this machine's map is rebuilt to flag its slots as shared too
+	machine->memoryRomPages = memoryRomPages;
+	machine->memoryRamPages = memoryRamPages;
+	memoryMapUpdate();
+
+	machine->initialiseComponents();
+
+	// Everything else is copied through a savestate that leaves out memory
+	StateStream measure(static_cast<uint8_t *>(nullptr), 0);
+	measure.memory = false;
+	stateTransfer(measure);
+
+	std::vector<uint8_t> state(measure.position);
+	StateStream save(state.data(), state.size());
+	save.memory = false;
+	stateTransfer(save);
+
+	StateStream load(static_cast<const uint8_t *>(state.data()), state.size());
+	load.memory = false;
+	machine->stateTransfer(load);
+	machine->memoryMapUpdate();
+
+	return machine;
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -80,28 +137,94 @@ void ZXSpectrum::registerDebugOpCallback(std::function<bool(uint16_t, uint8_t)>
 	this->debugOpCallbackBlock = debugOpCallbackBlock;
 }
 
+// ------------------------------------------------------------------------------------------------------------
+// - Shared Tables
+
+const ZXSpectrum::ModelTables & ZXSpectrum::modelTablesForMachine(const MachineInfo &info)
+{
+	static const size_t cMODEL_COUNT = sizeof(machines) / sizeof(machines[0]);
+	static std::unique_ptr<ModelTables> tables[ cMODEL_COUNT ];
+	static std::once_flag tablesBuilt[ cMODEL_COUNT ];
+
+	std::call_once(tablesBuilt[ info.machineType ], [&info]()
+	{
+		std::unique_ptr<ModelTables> modelTables(new ModelTables());
+		ULABuildContentionTable(info, *modelTables);
+		displayBuildSpanTable(info, *modelTables);
+		displayBuildFetchTable(info, *modelTables);
+		tables[ info.machineType ] = std::move(modelTables);
+	});
+
+	return *tables[ info.machineType ];
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+const ZXSpectrum::DisplayTables & ZXSpectrum::displayTables()
+{
+	static const std::unique_ptr<DisplayTables> tables = []()
+	{
+		std::unique_ptr<DisplayTables> displayTables(new DisplayTables());
+		displayBuildLineAddressTable(*displayTables);
+		displayBuildCLUT(*displayTables);
+		return displayTables;
+	}();
+
+	return *tables;
+}
+
 // ------------------------------------------------------------------------------------------------------------
 // - Generate a frame
 
-void ZXSpectrum::generateFrame()
+void ZXSpectrum::generateFrame(bool renderDisplay, bool renderAudio)
 {
-	uint32_t currentFrameTstates = machineInfo.tsPerFrame;
+	emuRenderDisplay = renderDisplay && !emuHeadless;
+	emuRenderAudio = renderAudio && (!emuHeadless || emuHeadlessAudio);
+	emuTapeLoaderActive = false;
 
-	while (currentFrameTstates > 0 && !emuPaused && !breakpointHit)
+	schedulerAddEvent(EVENT_FRAME_END, machineInfo.tsPerFrame);
+
+	while (!emuPaused && !breakpointHit)
 	{
 		if (debugOpCallbackBlock)
 		{
-			if (debugOpCallbackBlock(z80Core.GetRegister(CZ80Core::eREG_PC), E_DEBUGOPERATION::EXECUTE) || emuPaused)
+			if (debugOpCallbackBlock(z80Core.GetRegister(CZ80CoreBase::eREG_PC), E_DEBUGOPERATION::EXECUTE) || emuPaused)
 			{
 				return;
 			}
 		}
 
-		uint32_t tStates = z80Core.Execute(1, machineInfo.intLength);
+		// The tape is caught up to now and then left alone until its next edge. The debugger still needs to see
+		// every instruction, so while it is active it schedules itself one t-state ahead which stops the CPU after
+		// the next instruction
+		const uint32_t currentTs = z80Core.GetTStates();
 
+		tapeCatchUp();
 		if (tapePlayer && tapePlayer->playing)
 		{
-			tapePlayer->updateWithTs(tStates);
+			schedulerAddEvent(EVENT_TAPE, currentTs + std::min(tapePlayer->tsToNextEdge(), machineInfo.tsPerFrame));
+		}
+		else
+		{
+			schedulerRemoveEvent(EVENT_TAPE);
+		}
+
+		if (debugOpCallbackBlock)
+		{
+			schedulerAddEvent(EVENT_DEBUG_STEP, currentTs + 1);
+		}
+		else
+		{
+			schedulerRemoveEvent(EVENT_DEBUG_STEP);
+		}
+
+		const uint32_t nextEventTs = schedulerNextEventTs();
+		coreExecute((nextEventTs > currentTs) ? nextEventTs - currentTs : 1, machineInfo.intLength);
+
+		if (schedulerEventDue(EVENT_TAPE))
+		{
+			audioCatchUp();
+			tapeCatchUp();
 		}
 
 		if (tapePlayer && emuSaveTrapTriggered)
@@ -112,44 +235,128 @@ void ZXSpectrum::generateFrame()
 		{
 			tapePlayer->loadBlockWithMachine(this);
 		}
-		else
+		else if (schedulerEventDue(EVENT_FRAME_END))
 		{
-			currentFrameTstates -= tStates;
+			audioCatchUp();
+			tapeCatchUp();
 
-			audioUpdateWithTs(tStates);
+			z80Core.ResetTStates(machineInfo.tsPerFrame);
+			tapeCurrentTs = z80Core.GetTStates();
+			z80Core.SignalInterrupt();
+			audioFrameEnd();
 
-			if (z80Core.GetTStates() >= machineInfo.tsPerFrame)
+			// A skipped frame is never drawn, so the last published frame stays with the renderer
+			if (emuRenderDisplay)
 			{
-				z80Core.ResetTStates(machineInfo.tsPerFrame);
-				z80Core.SignalInterrupt();
-
 				displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame - emuCurrentDisplayTs));
+				displayPublishFrame();
+			}
 
-				emuFrameCounter++;
+			emuFrameCounter++;
 
-				audioLastIndex = audioBufferIndex;
-				displayFrameReset();
-				keyboardCheckCapsLockStatus();
-				audioDecayAYFloatingRegister();
+			audioLastIndex = audioBufferIndex;
+			displayFrameReset();
+			keyboardCheckCapsLockStatus();
+			audioDecayAYFloatingRegister();
 
-				currentFrameTstates = 0;
-			}
+			schedulerReset();
+			tapeLoaderReset();
+			return;
 		}
 	}
 }
 
 // ------------------------------------------------------------------------------------------------------------
-// - Debug
+// - Scheduler
 
-void ZXSpectrum::step()
+void ZXSpectrum::schedulerReset()
+{
+	for (uint32_t i = 0; i < E_SCHEDULEREVENT::MAX_EVENTS; i++)
+	{
+		schedulerEventTs[i] = cSCHEDULER_IDLE;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::schedulerAddEvent(E_SCHEDULEREVENT event, uint32_t tStates)
+{
+	schedulerEventTs[event] = tStates;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::schedulerRemoveEvent(E_SCHEDULEREVENT event)
+{
+	schedulerEventTs[event] = cSCHEDULER_IDLE;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+bool ZXSpectrum::schedulerEventDue(E_SCHEDULEREVENT event)
+{
+	return schedulerEventTs[event] != cSCHEDULER_IDLE && z80Core.GetTStates() >= schedulerEventTs[event];
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint32_t ZXSpectrum::schedulerNextEventTs()
+{
+	uint32_t nextTs = cSCHEDULER_IDLE;
+
+	for (uint32_t i = 0; i < E_SCHEDULEREVENT::MAX_EVENTS; i++)
+	{
+		if (schedulerEventTs[i] < nextTs)
+		{
+			nextTs = schedulerEventTs[i];
+		}
+	}
+
+	return nextTs;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Tape
+
+void ZXSpectrum::tapeCatchUp()
 {
-	uint32_t tStates = z80Core.Execute(1, machineInfo.intLength);
+	const uint32_t currentTs = z80Core.GetTStates();
 
-	if (tapePlayer && tapePlayer->playing)
+	if (tapePlayer && tapePlayer->playing && currentTs > tapeCurrentTs)
 	{
-		tapePlayer->updateWithTs(tStates);
+		tapePlayer->advance(currentTs - tapeCurrentTs);
 	}
 
+	tapeCurrentTs = currentTs;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t ZXSpectrum::tapeLevel()
+{
+	if (!tapePlayer)
+	{
+		return 0;
+	}
+
+	const uint32_t currentTs = z80Core.GetTStates();
+	tapeSampleTs = currentTs;
+	return static_cast<uint8_t>(tapePlayer->levelIn((currentTs > tapeCurrentTs) ? currentTs - tapeCurrentTs : 0));
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Debug
+
+void ZXSpectrum::step()
+{
+	emuRenderDisplay = !emuHeadless;
+	emuRenderAudio = !emuHeadless || emuHeadlessAudio;
+
+	// Stepping has to show every pass of a loader loop, so none is ever seen often enough to be run forward
+	tapeLoaderReset();
+	coreExecute(1, machineInfo.intLength);
+	tapeCatchUp();
+
 	if (tapePlayer && emuSaveTrapTriggered)
 	{
 		tapePlayer->saveBlockWithMachine(this);
@@ -162,8 +369,12 @@ void ZXSpectrum::step()
 	{
 		if (z80Core.GetTStates() >= machineInfo.tsPerFrame)
 		{
+			audioCatchUp();
+
 			z80Core.ResetTStates(machineInfo.tsPerFrame);
+			tapeCurrentTs = z80Core.GetTStates();
 			z80Core.SignalInterrupt();
+			audioFrameEnd();
 
 			emuFrameCounter++;
 
@@ -175,31 +386,11 @@ void ZXSpectrum::step()
 	}
 
 	displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame - emuCurrentDisplayTs));
+	displayPublishFrame();
 }
 
 // ------------------------------------------------------------------------------------------------------------
-// - Memory Access
-
-uint8_t ZXSpectrum::zxSpectrumMemoryRead(uint16_t address, void* param)
-{
-	return static_cast<ZXSpectrum*>(param)->coreMemoryRead(address);
-}
-
-// ------------------------------------------------------------------------------------------------------------
-
-void ZXSpectrum::zxSpectrumMemoryWrite(uint16_t address, uint8_t data, void* param)
-{
-	static_cast<ZXSpectrum*>(param)->coreMemoryWrite(address, data);
-}
-
-// ------------------------------------------------------------------------------------------------------------
-
-void ZXSpectrum::zxSpectrumMemoryContention(uint16_t address, uint32_t tStates, void* param)
-{
-	static_cast<ZXSpectrum*>(param)->coreMemoryContention(address, tStates);
-}
-
-// ------------------------------------------------------------------------------------------------------------
+// - Debug Memory Access
 
 uint8_t ZXSpectrum::zxSpectrumDebugRead(uint16_t address, void* param, void* data)
 {
@@ -224,21 +415,6 @@ void ZXSpectrum::coreMemoryWriteWithBuffer(const char *buffer, size_t size, uint
     }
 }
 
-// ------------------------------------------------------------------------------------------------------------
-// - IO Access
-
-uint8_t ZXSpectrum::zxSpectrumIORead(uint16_t address, void* param)
-{
-	return static_cast<ZXSpectrum*>(param)->coreIORead(address);
-}
-
-// ------------------------------------------------------------------------------------------------------------
-
-void ZXSpectrum::zxSpectrumIOWrite(uint16_t address, uint8_t data, void* param)
-{
-	static_cast<ZXSpectrum*>(param)->coreIOWrite(address, data);
-}
-
 // ------------------------------------------------------------------------------------------------------------
 // - Pause/Resume
 
@@ -261,17 +437,22 @@ void ZXSpectrum::resetMachine(bool hard)
 {
 	if (hard)
 	{
-		for (int i = 0; i < machineInfo.ramSize; i++)
+		for (uint32_t page = 0; page < memoryRamPages.size(); page++)
 		{
-			memoryRam[i] = static_cast<char>(rand() % 255);
+			uint8_t *memory = memoryRamPage(page, false);
+			for (uint32_t i = 0; i < cMEMORY_PAGE_SIZE; i++)
+			{
+				memory[i] = static_cast<uint8_t>(emuRandom() % 255);
+			}
 		}
 	}
 
-	delete[] displayBuffer;
+	displayClear();
 
-	displaySetup();
+	memoryMapUpdate();
 
 	z80Core.Reset(hard);
+	schedulerReset();
 	emuReset();
 	keyboardMapReset();
 	displayFrameReset();
@@ -280,11 +461,95 @@ void ZXSpectrum::resetMachine(bool hard)
 
 // ------------------------------------------------------------------------------------------------------------
 
+void ZXSpectrum::setRandomSeed(uint32_t seed)
+{
+	emuRandom.seed(seed);
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
 void ZXSpectrum::emuReset()
 {
 	emuFrameCounter = 0;
 	emuSaveTrapTriggered = false;
 	emuLoadTrapTriggered = false;
+	tapeCurrentTs = 0;
+	tapeLoader.valid = false;
+	tapeLoaderReset();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+// - Memory Map
+
+void ZXSpectrum::memoryMapROM(uint32_t slot, uint32_t romPage)
+{
+	memoryReadPages[slot] = memoryRomPages[romPage]->data();
+	memoryWritePages[slot] = memoryWriteSink;
+	memoryPageFlags[slot] = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::memoryMapRAM(uint32_t slot, uint32_t ramPage, bool contended)
+{
+	memoryReadPages[slot] = memoryRamPages[ramPage]->data();
+	memoryWritePages[slot] = memoryReadPages[slot];
+	memoryPageFlags[slot] = (contended ? cMEMORY_PAGE_CONTENDED : 0) | ((ramPage == emuDisplayPage) ? cMEMORY_PAGE_SCREEN : 0);
+	memorySlotRamPage[slot] = static_cast<uint8_t>(ramPage);
+
+	if (memoryRamPages[ramPage].use_count() > 1)
+	{
+		memoryPageFlags[slot] |= cMEMORY_PAGE_SHARED;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t *ZXSpectrum::memoryRamPage(uint32_t page, bool keepContents)
+{
+	std::shared_ptr<MemoryPage> &memoryPage = memoryRamPages[page];
+
+	if (memoryPage.use_count() > 1)
+	{
+		memoryPage = keepContents ? std::make_shared<MemoryPage>(*memoryPage) : std::make_shared<MemoryPage>();
+		memoryMapUpdate();
+	}
+	else
+	{
+		// The other machine may have only just let go of the page on another thread
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+
+	return memoryPage->data();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+uint8_t *ZXSpectrum::memoryRomPage(uint32_t page, bool keepContents)
+{
+	std::shared_ptr<MemoryPage> &memoryPage = memoryRomPages[page];
+
+	if (memoryPage.use_count() > 1)
+	{
+		memoryPage = keepContents ? std::make_shared<MemoryPage>(*memoryPage) : std::make_shared<MemoryPage>();
+		memoryMapUpdate();
+	}
+	else
+	{
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+
+	return memoryPage->data();
+}
+
+// ------------------------------------------------------------------------------------------------------------
+
+void ZXSpectrum::memoryUnshareSlot(uint32_t slot)
+{
+	// Called on the first write to a slot flagged as shared. If the other machine has since let go of the page there is
+	// nothing to copy and the map just needs the flag cleared
+	memoryRamPage(memorySlotRamPage[slot]);
+	memoryMapUpdate();
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -292,9 +557,7 @@ void ZXSpectrum::emuReset()
 
 Tape::FileResponse ZXSpectrum::loadROM(const std::string rom, uint32_t page)
 {
-	size_t romAddress = cROM_SIZE * page;
-
-	if (memoryRom.size() < romAddress)
+	if (page >= memoryRomPages.size())
 	{
         std::cout << "ZXSpectrum::loadROM - Unable to load into ROM page " << page << "\n";
         return Tape::FileResponse{false, std::to_string(page) + " is an invalid ROM page" };
@@ -306,9 +569,9 @@ Tape::FileResponse ZXSpectrum::loadROM(const std::string rom, uint32_t page)
     std::ifstream romFile(romPath, std::ios::binary | std::ios::ate | std::ios::in);
 	if (romFile.good())
 	{
-		std::streampos fileSize = romFile.tellg();
+		std::streamsize fileSize = std::min<std::streamsize>(romFile.tellg(), cROM_SIZE);
         romFile.seekg(0, std::ios::beg);
-		romFile.read(memoryRom.data() + romAddress, fileSize);
+		romFile.read(reinterpret_cast<char *>(memoryRomPage(page, false)), fileSize);
 		romFile.close();
         return Tape::FileResponse{true, "Loaded successfully"};
 	}
@@ -326,16 +589,16 @@ Tape::FileResponse ZXSpectrum::scrLoadWithPath(const std::string path)
     std::ifstream scrFile(path, std::ios::binary | std::ios::ate | std::ios::in);
     if (scrFile.good())
     {
-        std::streampos fileSize = scrFile.tellg();
+        std::streamsize fileSize = std::min<std::streamsize>(scrFile.tellg(), cMEMORY_PAGE_SIZE);
         scrFile.seekg(0, std::ios::beg);
         
         switch (machineInfo.machineType) {
             case eZXSpectrum48:
-                scrFile.read(memoryRam.data() + cBITMAP_ADDRESS, fileSize);
+                scrFile.read(reinterpret_cast<char *>(memoryRamPage(1)), fileSize);
                 break;
             case eZXSpectrum128:
                 // Load the image data into memory page 5
-                scrFile.read(memoryRam.data() + (cBITMAP_ADDRESS * 5), fileSize);
+                scrFile.read(reinterpret_cast<char *>(memoryRamPage(5)), fileSize);
                 break;
                 
             default:
@@ -364,7 +627,7 @@ void ZXSpectrum::attachTapePlayer(Tape *tapePlayer)
 
 void* ZXSpectrum::getScreenBuffer()
 {
-	return displayBuffer;
+	return displayBuffers[displayPublishedIndex];
 }
 
 // ------------------------------------------------------------------------------------------------------------
@@ -373,7 +636,12 @@ void* ZXSpectrum::getScreenBuffer()
 void ZXSpectrum::release()
 {
     std::cout << "ZXSpectrum::Release" << "\n";
-    delete[] displayBuffer;
+    for (uint8_t *&buffer : displayBuffers)
+    {
+        delete[] buffer;
+        buffer = nullptr;
+    }
+    displayBuffer = nullptr;
 	delete[] audioBuffer;
 }
 
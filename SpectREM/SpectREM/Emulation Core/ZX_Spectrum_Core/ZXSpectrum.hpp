@@ -9,11 +9,16 @@
 #ifndef ZXSpectrum_hpp
 #define ZXSpectrum_hpp
 
+#include <array>
+#include <memory>
+#include <random>
 #include <vector>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <functional>
+#include <atomic>
+#include <cstring>
 
 #include "../Z80_Core/Z80Core.h"
 #include "MachineInfo.h"
@@ -29,6 +34,27 @@ public:
     static const uint16_t    cBITMAP_SIZE      = 6144;
     static const uint16_t    cATTR_SIZE        = 768;
     static const uint16_t    cMEMORY_PAGE_SIZE = 16384;
+
+    // ULA timing tables are indexed directly by the current t-state. They run past the end of the frame by
+    // cULA_TABLE_OVERRUN entries so that an instruction crossing the end of the frame never needs the index wrapped
+    static const uint32_t    cULA_TABLE_SIZE        = 80000;
+    static const uint32_t    cULA_TABLE_OVERRUN     = 1024;
+
+    // Maximum number of spans on a display line: left border, paper, right border and retrace
+    static const uint32_t    cDISPLAY_MAX_SPANS     = 4;
+
+    // The frame waiting for the renderer is stored as a buffer index with a flag set when it has not been picked up yet
+    static const uint32_t    cDISPLAY_FRAME_INDEX   = 0x03;
+    static const uint32_t    cDISPLAY_FRAME_NEW     = 0x04;
+
+    // Largest loader loop, in bytes and in machine cycles, that flash loading will run forward
+    static const uint32_t    cTAPE_LOADER_MAX_LENGTH = 32;
+    static const uint32_t    cTAPE_LOADER_MAX_CYCLES = 96;
+
+    // Memory map slot flags
+    static const uint8_t     cMEMORY_PAGE_CONTENDED = 0x01;     // Slot is subject to ULA contention
+    static const uint8_t     cMEMORY_PAGE_SCREEN    = 0x02;     // Slot holds the RAM page currently being displayed
+    static const uint8_t     cMEMORY_PAGE_SHARED    = 0x04;     // Slot holds a RAM page shared with a forked machine
     
     enum E_FILETYPE
     {
@@ -65,6 +91,17 @@ public:
         MAX_REGISTERS
     };
     
+    // IO contention patterns, indexed by (contended << 1) | (port & 0x01)
+    enum E_IOCONTENTION
+    {
+        IO_N1_C3 = 0,
+        IO_N4,
+        IO_C1_C3,
+        IO_C1_C1_C1_C1,
+        
+        MAX_IO_PATTERNS
+    };
+    
     // Debug operation type
     enum E_DEBUGOPERATION
     {
@@ -73,6 +110,17 @@ public:
         EXECUTE = 0x04
     };
     
+    // Events that generateFrame runs the CPU up to. The CPU executes without stopping until the earliest
+    // scheduled event is due
+    enum E_SCHEDULEREVENT
+    {
+        EVENT_FRAME_END = 0,
+        EVENT_TAPE,
+        EVENT_DEBUG_STEP,
+        
+        MAX_EVENTS
+    };
+    
     // Spectrum keyboard
     enum class eZXSpectrumKey
     {
@@ -155,12 +203,95 @@ public:
         uint8_t             *data = nullptr;
     };
 
+    // Area of the display buffer in pixels
+    struct DisplayRect {
+        uint32_t            x;
+        uint32_t            y;
+        uint32_t            width;
+        uint32_t            height;
+    };
+
     // Breakpoint information
     struct DebugBreakpoint {
         uint16_t            address;
         bool                breakPoint;
     };
     
+    // A run of character cells on a display line that are all drawn the same way. The run ends at tsEnd
+    struct DisplaySpan
+    {
+        uint16_t            tsEnd;
+        uint8_t             type;
+    };
+
+    // The first and last display t-state at which the ULA fetches a screen byte. Bitmap bytes are fetched once,
+    // attribute bytes once on each of the 8 lines of their character row
+    struct DisplayFetch
+    {
+        uint32_t            firstTs;
+        uint32_t            lastTs;
+    };
+
+    // A change in the audio output level at a t-state within the current frame
+    struct AudioEdge
+    {
+        uint32_t            ts;
+        float               delta;
+    };
+
+    // A machine cycle of a loader loop. Memory cycles are contended by the slot of their address, or of the IR register
+    // pair when ir is set. Each half of an IO cycle's port is either a fixed byte or, with 0x100 added, the number of the
+    // register holding it at the start of the loop
+    struct TapeLoaderCycle
+    {
+        bool                io;
+        bool                ir;
+        uint8_t             tStates;
+        uint16_t            address;
+        int16_t             portHigh;
+        int16_t             portLow;
+    };
+
+    // A loop in a tape loader that does nothing but count while it waits for the EAR bit to change. counter is the
+    // byte register it counts with, if any, and counterFlags the flags set by counting that decide when it gives up.
+    // The state of the CPU at head is kept from one time round to the next to prove nothing else changes
+    struct TapeLoaderLoop
+    {
+        bool                valid = false;
+        uint16_t            head = 0;
+        uint16_t            headFetch = 0;
+        uint16_t            jump = 0;
+        uint32_t            length = 0;
+        uint8_t             code[cTAPE_LOADER_MAX_LENGTH]{0};
+        TapeLoaderCycle     cycles[cTAPE_LOADER_MAX_CYCLES]{};
+        uint32_t            cycleCount = 0;
+        int32_t             counter = -1;
+        int32_t             counterStep = 0;
+        uint8_t             counterFlags = 0;
+
+        bool                observed = false;
+        CZ80CoreBase::Z80SavedState state{};
+        uint64_t            edgeTs = 0;
+    };
+
+    // Lookup tables that depend only on the machine model. They are built the first time a model is initialised
+    // and then shared, read only, by every instance of that model
+    struct ModelTables
+    {
+        uint8_t             memoryContention[cULA_TABLE_SIZE];
+        uint8_t             ioContention[ E_IOCONTENTION::MAX_IO_PATTERNS ][cULA_TABLE_SIZE];
+        DisplaySpan         displaySpans[312][cDISPLAY_MAX_SPANS];
+        DisplayFetch        displayFetch[cBITMAP_SIZE + cATTR_SIZE];
+    };
+
+    // Display lookup tables that are the same for every model
+    struct DisplayTables
+    {
+        uint64_t            clut[32 * 1024];
+        uint8_t             alut[256];
+        uint16_t            lineAddr[192];
+    };
+    
     typedef struct
     {
         float r;
@@ -169,9 +300,51 @@ public:
         float a;
     } Color;
 
+    // Savestates are saved and loaded by the same list of fields so the two can never disagree on the layout. Without
+    // a buffer the stream only measures. Running off the end of the buffer stops copying and marks the stream failed
+    class StateStream
+    {
+    public:
+        StateStream(uint8_t *buffer, size_t size) : destination(buffer), capacity(size) { }
+        StateStream(const uint8_t *buffer, size_t size) : source(buffer), capacity(size), loading(true) { }
+        
+        template <typename T>
+        void                field(T &value) { bytes(&value, sizeof(T)); }
+        
+        void                bytes(void *data, size_t size)
+        {
+            if (position + size > capacity)
+            {
+                failed = failed || destination || source;
+            }
+            else if (loading)
+            {
+                memcpy(data, source + position, size);
+            }
+            else if (destination)
+            {
+                memcpy(destination + position, data, size);
+            }
+            position += size;
+        }
+        
+        void                skip(size_t size) { position += size; failed = failed || position > capacity; }
+        size_t              remaining() const { return (position < capacity) ? capacity - position : 0; }
+        
+        uint8_t             *destination = nullptr;
+        const uint8_t       *source = nullptr;
+        size_t              capacity = 0;
+        size_t              position = 0;
+        bool                loading = false;
+        bool                failed = false;
+        bool                memory = true;
+    };
+    
+    typedef std::array<uint8_t, cMEMORY_PAGE_SIZE> MemoryPage;
+
     
 public:
-    ZXSpectrum();
+    ZXSpectrum(CZ80CoreBase &core);
     virtual ~ZXSpectrum();
 
 public:
@@ -183,8 +356,10 @@ public:
     virtual void            attachTapePlayer(Tape *tapePlayer);
 
     // Main function that when called generates an entire frame, which includes processing interrupts, beeper sound and AY Sound.
-    // On completion the displayBuffer member variable will contain RGBA formatted image data that can then be used to build a display image
-    void                    generateFrame();
+    // On completion the frame is published and can be picked up with displayAcquireFrame as RGBA formatted image data.
+    // When fast forwarding, frames that won't be presented can skip drawing the display and synthesising audio. The
+    // emulation itself, including contention and the floating bus, is unaffected
+    void                    generateFrame(bool renderDisplay = true, bool renderAudio = true);
     
     void                    keyboardKeyDown(eZXSpectrumKey key);
     void                    keyboardKeyUp(eZXSpectrumKey key);
@@ -205,52 +380,156 @@ public:
     void                    registerDebugOpCallback(std::function<bool(uint16_t, uint8_t)> debugOpCallbackBlock);
     std::function<bool(uint16_t, uint8_t)> debugOpCallbackBlock = nullptr;
     
+    // Returns the last frame the emulator completed. Only safe to use from the thread running the emulator
     void                    *getScreenBuffer();
+
+    // Frames are triple buffered so the renderer never waits on the emulator. Acquire returns the newest completed frame,
+    // which stays untouched by the emulator until the next acquire. Only a single thread should acquire frames
+    const uint8_t           *displayAcquireFrame();
+
+    // Returns the rows of the display buffer that have changed since the last call, merged into full width rectangles.
+    // Returns false when nothing has changed so the previously presented frame can be shown again
+    bool                    displayTakeDirtyRects(std::vector<DisplayRect> &rects);
+    bool                    displayFrameUnchanged() { return !displayDirty; }
+    void                    displayInvalidate();
     uint32_t                getLastAudioBufferIndex() { return audioLastIndex; }
 
+    // Audio is produced at the host's sample rate. Frames follow the machine's real frame rate, so the number of samples
+    // in a frame varies by one from frame to frame and getLastAudioBufferIndex gives the count for the last one
+    void                    audioSetSampleRate(double sampleRate);
+    
+    // Nudges the number of samples per frame by a ratio close to 1, used by hosts to hold their audio queue at a target
+    // latency when the emulation is not paced by the audio device
+    void                    audioSetRateAdjustment(double ratio);
+    double                  getAudioSampleRate() { return audioSampleRate; }
+    double                  getAudioSamplesPerFrame() { return audioSamplesPerFrame; }
+
+    // A headless machine never draws the display and, unless asked to keep it, produces no audio. Timing is unchanged
+    // as nothing the CPU can see depends on either. The display buffers aren't allocated until a frame is needed
+    void                    setHeadless(bool headless, bool keepAudio = false);
+    bool                    isHeadless() { return emuHeadless; }
+
+    // Savestates hold the complete machine, including a CPU part way through a frame, the AY, the beam and the tape
+    // position, so emulation carries on from a loaded state exactly as it would have from when it was saved. The buffer
+    // is the caller's. stateSize is the size of a state saved now, saveState returns the bytes used or 0 if the buffer
+    // is too small and loadState only accepts a state saved by the same type of machine. A load marks the whole display
+    // dirty unless asked to keep it, for when the published frame is still the one the host should be showing
+    size_t                  stateSize();
+    size_t                  saveState(uint8_t *buffer, size_t size);
+    bool                    loadState(const uint8_t *buffer, size_t size, bool keepDisplay = false);
+
+    // Draws a whole frame from the screen as it is in memory now, with the current border colour, and publishes it.
+    // Meant for taking screenshots of a headless machine as a running machine already publishes every frame
+    const uint8_t           *displayRenderFrame();
+
+    // Creates a machine of the same type that carries on from exactly where this one is. ROM and RAM pages are shared
+    // between the two until either of them writes to a page, so a fork costs a few KB however much memory the machine
+    // has. The new machine is headless and has its own tape player, or none. The caller owns it. Forking shares pages
+    // with this machine, so it must not be forked while it is running on another thread
+    ZXSpectrum              *fork(Tape *tape = nullptr);
+
+    // Anything random, such as the contents of memory at power on, comes from a generator owned by the machine, so
+    // machines on different threads share nothing and two machines given the same seed behave the same
+    void                    setRandomSeed(uint32_t seed);
+
 protected:
     void                    emuReset();
     Tape::FileResponse      loadROM(const std::string rom, uint32_t page);
+
+    void                    memoryMapROM(uint32_t slot, uint32_t romPage);
+    void                    memoryMapRAM(uint32_t slot, uint32_t ramPage, bool contended);
+    
+    // Pages are read directly, but anything writing to a page has to ask for it first so a shared page can be copied.
+    // The contents of a shared page are only copied if they are going to be kept
+    uint8_t                 *memoryRamPage(uint32_t page, bool keepContents = true);
+    uint8_t                 *memoryRomPage(uint32_t page, bool keepContents = true);
+    uint8_t                 memoryRamRead(uint32_t address) const { return (*memoryRamPages[ address / cMEMORY_PAGE_SIZE ])[ address & ( cMEMORY_PAGE_SIZE - 1 ) ]; }
+    uint8_t                 memoryRomRead(uint32_t address) const { return (*memoryRomPages[ address / cMEMORY_PAGE_SIZE ])[ address & ( cMEMORY_PAGE_SIZE - 1 ) ]; }
+    void                    memoryRamWrite(uint32_t address, uint8_t byte) { memoryRamPage( address / cMEMORY_PAGE_SIZE )[ address & ( cMEMORY_PAGE_SIZE - 1 ) ] = byte; }
+    uint32_t                memoryRamSize() const { return static_cast<uint32_t>( memoryRamPages.size() * cMEMORY_PAGE_SIZE ); }
+    void                    memoryUnshareSlot(uint32_t slot);
+    
+    // Each machine creates a new instance of itself for fork
+    virtual ZXSpectrum      *forkInstance(Tape *tape) = 0;
+    void                    initialiseComponents();
     
     void                    displayFrameReset();
     void                    displayUpdateWithTs(int32_t tStates);
+    inline void             displayUpdateForScreenWrite(uint32_t offset);
 
     void                    ULAApplyIOContention(uint16_t address, bool contended);
-    void                    ULABuildFloatingBusTable();
     uint8_t                 ULAFloatingBus();
 
     void                    audioAYSetRegister(uint8_t reg);
     void                    audioAYWriteData(uint8_t data);
     uint8_t                 audioAYReadData();
     void                    audioAYUpdate();
+    void                    audioAYAdvance(uint32_t ticks);
+    uint32_t                audioAYTicksToNextEvent(bool includeTones);
+    bool                    audioAYOutputFixed();
     void                    audioReset();
-    void                    audioUpdateWithTs(int32_t tStates);
+    void                    audioCatchUp();
+    void                    audioAYUpdateToTs(uint32_t ts);
+    void                    audioAddEdge(uint32_t ts, float level);
+    void                    audioFrameEnd();
     void                    audioDecayAYFloatingRegister();
+
+    // The tape only moves when the machine catches it up, which it does at each edge. In between, reads of the EAR
+    // bit ask the tape for its level at the current t-state
+    void                    tapeCatchUp();
+    uint8_t                 tapeLevel();
+
+    // Flash loading. Called by each machine's opcode callback while the tape is playing, it finds loops in a loader that
+    // only wait for the next edge and runs them forward to it in one go, exactly as the CPU would have. See TapeLoader.cpp
+    void                    tapeLoaderOpcode(uint8_t opcode, uint16_t address);
+    void                    tapeLoaderReset();
+    
+    void                    stateTransfer(StateStream &stream);
+    void                    audioStateTransfer(StateStream &stream);
+    void                    displayStateTransfer(StateStream &stream);
+
+    // Hardware only one model has, such as peripherals, is added to the state by that model
+    virtual void            machineStateTransfer(StateStream &) { }
     
 private:
-    void                    displayBuildTsTable();
-    void                    displayBuildLineAddressTable();
-    void                    displayBuildCLUT();
-    void                    ULABuildContentionTable(bool alt);
+    static const ModelTables   & modelTablesForMachine(const MachineInfo &info);
+    static const DisplayTables & displayTables();
+    static void             displayBuildSpanTable(const MachineInfo &info, ModelTables &tables);
+    static void             displayBuildFetchTable(const MachineInfo &info, ModelTables &tables);
+    static void             displayBuildLineAddressTable(DisplayTables &tables);
+    static void             displayBuildCLUT(DisplayTables &tables);
+    static void             ULABuildContentionTable(const MachineInfo &info, ModelTables &tables);
     void                    audioBuildAYVolumesTable();
     void                    keyboardCheckCapsLockStatus();
     void                    keyboardMapReset();
     std::string             snapshotHardwareTypeForVersion(uint32_t version, uint32_t hardwareType);
     void                    snapshotExtractMemoryBlock(const char *buffer, size_t bufferSize, uint32_t memAddr, uint32_t fileOffset, bool isCompressed, uint32_t unpackedLength);
     void                    displaySetup();
+    void                    displayAllocateBuffers();
     void                    displayClear();
-    void                    audioSetup(double sampleRate, double fps);
+    void                    displayPublishFrame();
+    void                    displaySwapBuffers();
+    void                    audioSetup();
+    void                    schedulerReset();
+    void                    schedulerAddEvent(E_SCHEDULEREVENT event, uint32_t tStates);
+    void                    schedulerRemoveEvent(E_SCHEDULEREVENT event);
+    bool                    schedulerEventDue(E_SCHEDULEREVENT event);
+    uint32_t                schedulerNextEventTs();
+    bool                    tapeLoaderAnalyse(uint16_t head, uint16_t jump);
+    void                    tapeLoaderFastForward();
+    bool                    tapeLoaderRepeated(const CZ80CoreBase::Z80SavedState &state);
+    uint32_t                tapeLoaderIteration(uint32_t ts, uint64_t edgeTs, bool &edgeSeen, uint32_t &sampleTs);
     
-    // Core memory/IO functions
-    static uint8_t          zxSpectrumMemoryRead(uint16_t address, void *param);
-    static void             zxSpectrumMemoryWrite(uint16_t address, uint8_t data, void *param);
-    static void             zxSpectrumMemoryContention(uint16_t address, uint32_t tStates, void *param);
+    // Core debug memory functions. Normal memory/IO access goes through the bus each machine gives its Z80 core
     static uint8_t          zxSpectrumDebugRead(uint16_t address, void *param, void *m);
     static void             zxSpectrumDebugWrite(uint16_t address, uint8_t byte, void *param, void *data);
-    static uint8_t          zxSpectrumIORead(uint16_t address, void *param);
-    static void             zxSpectrumIOWrite(uint16_t address, uint8_t data, void *param);
 
 public:
+    virtual uint32_t        coreExecute(uint32_t numTStates, uint32_t intTStates) = 0;
+
+    // Rebuilds the memory map from the current paging state. Must be called whenever the paging state changes
+    virtual void            memoryMapUpdate() = 0;
+
     virtual uint8_t         coreMemoryRead(uint16_t address) = 0;
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) = 0;
     virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) = 0;
@@ -262,10 +541,21 @@ public:
     
     void                    coreMemoryWriteWithBuffer(const char *buffer, size_t size, uint16_t address, void *param);
         
-    // Machine hardware
-    CZ80Core                z80Core;
-    std::vector<char>       memoryRom;
-    std::vector<char>       memoryRam;
+    // Machine hardware. The core itself is owned by the machine so it can be instantiated with that machine's bus
+    CZ80CoreBase          & z80Core;
+    
+    // ROM and RAM in 16k pages, which a forked machine shares with the machine it was forked from
+    std::vector<std::shared_ptr<MemoryPage>> memoryRomPages;
+    std::vector<std::shared_ptr<MemoryPage>> memoryRamPages;
+
+    // Memory map with one entry per 16k slot, so reads and writes are a single indexed access. Writes to ROM
+    // are sent to memoryWriteSink. A write to a slot flagged as shared has to copy the page first
+    uint8_t                 *memoryReadPages[4]{nullptr};
+    uint8_t                 *memoryWritePages[4]{nullptr};
+    uint8_t                 memoryPageFlags[4]{0};
+    uint8_t                 memorySlotRamPage[4]{0};
+    uint8_t                 memoryWriteSink[cMEMORY_PAGE_SIZE]{0};
+
     uint8_t                 keyboardMap[8]{0};
     static KEYBOARD_ENTRY   keyboardLookup[];
     uint32_t                keyboardCapsLockFrames  = 0;
@@ -282,25 +572,43 @@ public:
     std::string             emuROMPath;
     std::string             emuBasePath;
     bool                    emuTapeInstantLoad      = false;
+    bool                    emuTapeFlashLoad        = true;
+    bool                    emuTapeLoaderActive     = false;    // A loader loop was run forward during the last frame
     bool                    emuUseAYSound           = false;
     bool                    emuLoadTrapTriggered    = false;
     bool                    emuSaveTrapTriggered    = false;
     bool                    emuUseSpecDRUM          = false;
+    bool                    emuRenderDisplay        = true;
+    bool                    emuRenderAudio          = true;
+    bool                    emuHeadless             = false;
+    bool                    emuHeadlessAudio        = false;
     bool                    emuSpecialPagingMode    = false;
     uint8_t                 emuPagingMode           = 0;
     uint8_t                 emuROMHiBit             = 0;
     uint8_t                 emuROMLoBit             = 0;
+    std::minstd_rand        emuRandom;
 
     // Display
-    uint8_t                 *displayBuffer;
+    uint8_t                 *displayBuffer          = nullptr;
     uint32_t                displayBufferIndex      = 0;
+    uint8_t                 *displayBuffers[3]      = { nullptr, nullptr, nullptr };
+    uint32_t                displayWriteIndex       = 0;
+    uint32_t                displayPublishedIndex   = 2;
+    uint32_t                displayFrontIndex       = 1;
+    std::atomic<uint32_t>   displayReadyFrame       { 2 };
+    bool                    displayFramePublished   = false;
     uint32_t                screenWidth             = 48 + 256 + 48;
     uint32_t                screenHeight            = 48 + 192 + 48;
     uint32_t                screenBufferSize        = 0;
-    uint32_t                displayTstateTable[312][228]{{0}};
-    uint16_t                displayLineAddrTable[192]{0};
-    uint64_t                *displayCLUT            = nullptr;
-    uint8_t                 *displayALUT            = nullptr;
+    const DisplaySpan       (*displaySpans)[cDISPLAY_MAX_SPANS] = nullptr;
+    const DisplayFetch      *displayFetchTable      = nullptr;
+    uint32_t                displayBeamLine         = 0;
+    std::vector<uint8_t>    displayDirtyRows;
+    bool                    displayDirty            = true;
+    uint32_t                displayBeamTs           = 0;
+    const uint16_t          *displayLineAddrTable   = nullptr;
+    const uint64_t          *displayCLUT            = nullptr;
+    const uint8_t           *displayALUT            = nullptr;
     uint32_t                displayBorderColor      = 0;
     bool                    displayReady            = false;
     Color                   clutBuffer[64];
@@ -311,15 +619,21 @@ public:
     int8_t                  audioMicBit             = 0;
     uint32_t                audioBufferSize         = 0;
     uint32_t                audioBufferIndex        = 0;
-    float                   audioTsCounter          = 0;
-    float                   audioTsStepCounter      = 0;
     uint32_t                audioLastIndex          = 0;
+    uint32_t                audioCurrentTs          = 0;
 
-    float                   audioBeeperTsStep       = 0;
-    float                   audioOutputLevelLeft    = 0;
-    float                   audioOutputLevelRight   = 0;
-    float                   audioAYLevelLeft           = 0;
-    float                   audioAYLevelRight          = 0;
+    // Level changes are collected during the frame and turned into band-limited steps when the frame ends
+    std::vector<AudioEdge>  audioEdges;
+    std::vector<float>      audioBlepBuffer;
+    double                  audioSampleRate         = 44100;
+    double                  audioRateAdjustment     = 1.0;
+    double                  audioTsPerSample        = 0;
+    double                  audioSamplesPerFrame    = 0;
+    double                  audioSampleOffset       = 0;
+    float                   audioOutputLevel        = 0;
+    float                   audioBlepLevel          = 0;
+    float                   audioBeeperLevel        = 0;
+    float                   audioAYLevel            = 0;
     
     float                   audioAYChannelOutput[3]{0};
     uint32_t                audioAYChannelCount[3]{0};
@@ -340,8 +654,8 @@ public:
     bool                    audioAYOneShot          = false;
     bool                    audioAYEnvelopeAttack   = false;
     uint8_t                 audioAYAttackEndVol     = 0;
-    float                   audioAYTsStep           = 0;
-    float                   audioAYTs               = 0;
+    uint32_t                audioAYTsStep           = 0;
+    uint32_t                audioAYNextTs           = 0;
 
     //Specdrum Peripheral
     int                     specdrumDACValue        = 0;
@@ -349,10 +663,9 @@ public:
     // Keyboard
     bool                    keyboardCapsLockPressed = false;
     
-    // ULA
-    uint32_t                ULAMemoryContentionTable[80000]{0};
-    uint32_t                ULAIOContentionTable[80000]{0};
-    uint32_t                ULAFloatingBusTable[80000]{0};
+    // ULA. The tables point into the shared ModelTables for this machine
+    const uint8_t           *ULAMemoryContentionTable = nullptr;
+    const uint8_t           (*ULAIOContentionTable)[cULA_TABLE_SIZE] = nullptr;
     const static uint32_t   ULAContentionValues[];
     const static uint32_t   ULAAltContentionValues[];
     uint8_t                 ULAPort7FFDValue        = 0;
@@ -363,12 +676,44 @@ public:
     
     // Tape object
     Tape                    *tapePlayer              = nullptr;
+    uint32_t                tapeCurrentTs           = 0;        // Frame t-state the tape has been played up to
+    uint32_t                tapeSampleTs            = 0;        // Frame t-state the EAR bit was last read at
+
+    // Flash loading. The loop being run forward and the jumps recently found not to close one
+    TapeLoaderLoop          tapeLoader;
+    uint16_t                tapeLoaderRejected[8]{0};
+    const uint8_t           *tapeLoaderTables[cTAPE_LOADER_MAX_CYCLES]{};
 
     // Debugger
     bool                    breakpointHit           = false;
 
+    // Scheduler. Holds the frame t-state each event is due at, or cSCHEDULER_IDLE if it is not scheduled
+    static const uint32_t   cSCHEDULER_IDLE         = 0xffffffff;
+    uint32_t                schedulerEventTs[ E_SCHEDULEREVENT::MAX_EVENTS ]{0};
+
 };
 
+// ------------------------------------------------------------------------------------------------------------
+
+// Called before a write to the bitmap or attribute byte at offset in the screen currently being displayed. The display
+// only needs catching up if that byte is fetched between the beam's current position and now. If the beam has already
+// passed it, or won't reach it during this catch-up, the output is the same without one
+void ZXSpectrum::displayUpdateForScreenWrite(uint32_t offset)
+{
+    if (!emuRenderDisplay)
+    {
+        return;
+    }
+    
+    const uint32_t displayTs = z80Core.GetTStates() + machineInfo.paperDrawingOffset;
+    const DisplayFetch &fetch = displayFetchTable[ offset ];
+
+    if (fetch.lastTs >= emuCurrentDisplayTs && fetch.firstTs < displayTs)
+    {
+        displayUpdateWithTs(static_cast<int32_t>(displayTs - emuCurrentDisplayTs));
+    }
+}
+
 #endif /* ZXSpectrum_hpp */
 
 
@@ -131,7 +131,7 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
     [self.emulationViewController stopAudioCore];
 
     Debug *debugger = self.emulationController->getDebugger();
-    int pc = debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC);
+    int pc = debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC);
     debugger->disassemble(pc , 0xffff - pc, self.hexFormat);
     
     [self.commandTextField becomeFirstResponder];
@@ -504,7 +504,7 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
             }
         }
 
-        if (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC) == dop.address)
+        if (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC) == dop.address)
         {
             rowColor = cHIGHLIGHT_COLOR;
         }
@@ -774,7 +774,7 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
         }
         else if ( [[commandList[1] uppercaseString]isEqualToString:@"PC"] )
         {
-            self.disassembleAddress = machine->z80Core.GetRegister(CZ80Core::eREG_PC);
+            self.disassembleAddress = machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC);
             debugger->disassemble(self.disassembleAddress, 0xffff - self.disassembleAddress, self.hexFormat);
         }
         else if ( [[commandList[1] uppercaseString]isEqualToString:@"SP"] )
@@ -918,7 +918,7 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
             {
                 Debug::DisassembledOpcode dop = debugger->disassembly(static_cast<unsigned int>(i));
 
-                if (dop.address == debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC))
+                if (dop.address == debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC))
                 {
                     debugger->disassemble(self.disassembleAddress, 0xffff - self.disassembleAddress, self.hexFormat);
                     [self reloadDisassemblyData];
@@ -928,7 +928,7 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
                 }
             }
         }
-        self.disassembleAddress = debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC);
+        self.disassembleAddress = debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC);
         debugger->disassemble(self.disassembleAddress, 0xffff - self.disassembleAddress, self.hexFormat);
         [self reloadDisassemblyData];
         [self.disassemblyTableview scrollRowToVisible:0];
@@ -952,45 +952,45 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
 
         if (self.hexFormat)
         {
-            self.pc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC)];
-            self.sp = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_SP)];
+            self.pc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC)];
+            self.sp = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_SP)];
             
-            self.af = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_AF)];
-            self.bc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_BC)];
-            self.de = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_DE)];
-            self.hl = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_HL)];
+            self.af = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_AF)];
+            self.bc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_BC)];
+            self.de = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_DE)];
+            self.hl = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_HL)];
             
-            self.a_af = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_AF)];
-            self.a_bc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_BC)];
-            self.a_de = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_DE)];
-            self.a_hl = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_HL)];
+            self.a_af = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_AF)];
+            self.a_bc = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_BC)];
+            self.a_de = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_DE)];
+            self.a_hl = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_HL)];
             
-            self.i = [NSString stringWithFormat:@"$%02X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_I)];
-            self.r = [NSString stringWithFormat:@"$%02X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_R)];
+            self.i = [NSString stringWithFormat:@"$%02X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_I)];
+            self.r = [NSString stringWithFormat:@"$%02X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_R)];
             
-            self.ix = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_IX)];
-            self.iy = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_IY)];
+            self.ix = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_IX)];
+            self.iy = [NSString stringWithFormat:@"$%04X", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_IY)];
         }
         else
         {
-            self.pc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_PC)];
-            self.sp = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_SP)];
+            self.pc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_PC)];
+            self.sp = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_SP)];
             
-            self.af = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_AF)];
-            self.bc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_BC)];
-            self.de = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_DE)];
-            self.hl = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_HL)];
+            self.af = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_AF)];
+            self.bc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_BC)];
+            self.de = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_DE)];
+            self.hl = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_HL)];
             
-            self.a_af = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_AF)];
-            self.a_bc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_BC)];
-            self.a_de = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_DE)];
-            self.a_hl = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_ALT_HL)];
+            self.a_af = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_AF)];
+            self.a_bc = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_BC)];
+            self.a_de = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_DE)];
+            self.a_hl = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_ALT_HL)];
             
-            self.i = [NSString stringWithFormat:@"%02i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_I)];
-            self.r = [NSString stringWithFormat:@"%02i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_R)];
+            self.i = [NSString stringWithFormat:@"%02i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_I)];
+            self.r = [NSString stringWithFormat:@"%02i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_R)];
             
-            self.ix = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_IX)];
-            self.iy = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80Core::eREG_IY)];
+            self.ix = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_IX)];
+            self.iy = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_IY)];
         }
         
         self.currentRom = [NSString stringWithFormat:@"%02i", debugger->machine->emuROMNumber];
@@ -1001,14 +1001,14 @@ static NSColor * const cRDWR_BREAKPOINT_COLOR = [NSColor colorWithRed:0.6 green:
         
         self.tStates = [NSString stringWithFormat:@"%04i", debugger->machine->z80Core.GetTStates()];
         
-        self.fs = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_S) ? @"1" : @"-";
-        self.fz = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_Z) ? @"1" : @"-";
-        self.f5 = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_5) ? @"1" : @"-";
-        self.fh = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_H) ? @"1" : @"-";
-        self.f3 = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_3) ? @"1" : @"-";
-        self.fpv = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_P) ? @"1" : @"-";
-        self.fn = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_N) ? @"1" : @"-";
-        self.fc = (debugger->machine->z80Core.GetRegister(CZ80Core::eREG_F) & debugger->machine->z80Core.FLAG_C) ? @"1" : @"-";
+        self.fs = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_S) ? @"1" : @"-";
+        self.fz = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_Z) ? @"1" : @"-";
+        self.f5 = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_5) ? @"1" : @"-";
+        self.fh = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_H) ? @"1" : @"-";
+        self.f3 = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_3) ? @"1" : @"-";
+        self.fpv = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_P) ? @"1" : @"-";
+        self.fn = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_N) ? @"1" : @"-";
+        self.fc = (debugger->machine->z80Core.GetRegister(CZ80CoreBase::eREG_F) & debugger->machine->z80Core.FLAG_C) ? @"1" : @"-";
     });
     
 
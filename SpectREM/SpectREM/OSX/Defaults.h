@@ -21,6 +21,9 @@ extern NSString * const MachineSelectedModel;
 extern NSString * const MachineTapeInstantLoad;
 @property (nonatomic, assign) BOOL machineTapeInstantLoad;
 
+extern NSString * const MachineTapeFlashLoad;
+@property (nonatomic, assign) BOOL machineTapeFlashLoad;
+
 extern NSString * const MachineUseAYSound;
 @property(nonatomic, assign) BOOL machineUseAYSound;
 
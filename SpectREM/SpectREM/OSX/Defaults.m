@@ -13,6 +13,7 @@
 NSString * const MachineAcceleration = @"machineAcceleration";
 NSString * const MachineSelectedModel = @"machineSelectedModel";
 NSString * const MachineTapeInstantLoad = @"machineTapeInstantLoad";
+NSString * const MachineTapeFlashLoad = @"machineTapeFlashLoad";
 NSString * const MachineUseAYSound = @"machineUseAYSound";
 NSString * const MachineUseSpecDRUM = @"machineUseSpecDRUM";
 
@@ -53,6 +54,7 @@ NSString * const SPIPort = @"spiPort";
                                MachineAcceleration : @(1),
                                MachineSelectedModel : @(0),
                                MachineTapeInstantLoad : @YES,
+                               MachineTapeFlashLoad : @YES,
                                MachineUseAYSound: @YES,
                                MachineUseSpecDRUM: @NO,
                                
@@ -127,6 +129,7 @@ NSString * const SPIPort = @"spiPort";
     _machineAcceleration = [[userDefaults valueForKey:MachineAcceleration] floatValue];
     _machineSelectedModel = [[userDefaults valueForKey:MachineSelectedModel] integerValue];
     _machineTapeInstantLoad = [[userDefaults valueForKey:MachineTapeInstantLoad] boolValue];
+    _machineTapeFlashLoad = [[userDefaults valueForKey:MachineTapeFlashLoad] boolValue];
     _machineUseAYSound = [[userDefaults valueForKey:MachineUseAYSound] boolValue];
     _machineUseSpecDRUM = [[userDefaults valueForKey:MachineUseSpecDRUM] boolValue];
 
@@ -172,6 +175,12 @@ NSString * const SPIPort = @"spiPort";
     [[NSUserDefaults standardUserDefaults] setBool:machineTapeInstantLoad forKey:MachineTapeInstantLoad];
 }
 
+- (void)setMachineTapeFlashLoad:(BOOL)machineTapeFlashLoad
+{
+    _machineTapeFlashLoad = machineTapeFlashLoad;
+    [[NSUserDefaults standardUserDefaults] setBool:machineTapeFlashLoad forKey:MachineTapeFlashLoad];
+}
+
 - (void)setMachineUseAYSound:(BOOL)machineUseAYSound
 {
     _machineUseAYSound = machineUseAYSound;
@@ -11,7 +11,6 @@
 #import <UserNotifications/UserNotifications.h>
 
 #import "AudioCore.h"
-#import "AudioQueue.hpp"
 #import "ConfigurationViewController.h"
 #import "Debug.hpp"
 #import "DebugViewController.h"
@@ -48,8 +47,6 @@ const int cSCREEN_FILL              = 1;
     NSString                            * mainBundlePath_;
     NSURL                               * lastOpenedURL_;
     
-    AudioQueue                          * audioQueue_;
-    
     NSDictionary                        * keyMappings_;
     
     NSStoryboard                        * storyBoard_;
@@ -70,11 +67,14 @@ const int cSCREEN_FILL              = 1;
     MTKView                             * metalView_;
     MetalRenderer                       * metalRenderer_;
     
-    // This timer is used when the emulator is run at > 1x speed. Rather than the sound driving the speed, a timer
-    // drives the updates
-    NSTimer                             * accelerationTimer_;
-    
     SmartLink                           * smartLink_;
+    
+    // Rows of the display that changed in the last frame. Only used on the emulation thread
+    std::vector<ZXSpectrum::DisplayRect>  dirtyRects_;
+    
+    // Set while a display upload is waiting on the main queue so frames generated faster than the main thread can
+    // draw them don't pile up behind it
+    std::atomic<bool>                     displayUpdatePending_;
 }
 @end
 
@@ -84,10 +84,12 @@ const int cSCREEN_FILL              = 1;
 
 - (void)dealloc
 {
+    emulationController->stopEmulation();
     delete emulationController;
     [self.defaults removeObserver:self forKeyPath:MachineAcceleration];
     [self.defaults removeObserver:self forKeyPath:MachineSelectedModel];
     [self.defaults removeObserver:self forKeyPath:MachineTapeInstantLoad];
+    [self.defaults removeObserver:self forKeyPath:MachineTapeFlashLoad];
     [self.defaults removeObserver:self forKeyPath:MachineUseAYSound];
     [self.defaults removeObserver:self forKeyPath:MachineUseSpecDRUM];
 }
@@ -96,60 +98,44 @@ const int cSCREEN_FILL              = 1;
 
 - (void)audioCallback:(int)inNumberFrames buffer:(int16_t *)buffer
 {
-    if (emulationController->getMachine())
-    {
-        const uint32_t b = (cAUDIO_SAMPLE_RATE / (cFRAMES_PER_SECOND * _defaults.machineAcceleration)) * 2;
-        
-        audioQueue_->read(buffer, (inNumberFrames << 1));
-        
-        // Check if we have used a frames worth of buffer storage and if so then its time to generate another frame.
-        if (audioQueue_->bufferUsed() <= b)
-        {
-            if (_defaults.machineAcceleration == 1)
-            {
-                // No point in updating the screen if the screen isn't visible. Also needed to stop the app from stalling when
-                // brought to the front
-                dispatch_async(dispatch_get_main_queue(), ^{
-                    if (self.view.window.occlusionState & NSApplicationOcclusionStateVisible)
-                    {
-                        [metalRenderer_ updateTextureData:emulationController->getDisplayBuffer()];
-                    }
-                });
-                
-                // Generate another frame
-                emulationController->generateFrame();
-            }
-            audioQueue_->write(emulationController->getAudioBuffer(), b);
-        }
-    }
+    // Frames are generated on the emulation thread, so all that's left to do here is play what it has queued
+    emulationController->readAudio(buffer, (inNumberFrames << 1));
 }
 
-- (void)setupAccelerationTimer
+- (void)setupEmulation
 {
-    if (_defaults.machineAcceleration > 1)
-    {
-        [accelerationTimer_ invalidate];
-        accelerationTimer_ = [NSTimer timerWithTimeInterval:1.0 / (cFRAMES_PER_SECOND * _defaults.machineAcceleration) repeats:YES block:^(NSTimer * _Nonnull timer) {
-            
-            emulationController->generateFrame();
-            
-            if (!(emulationController->getFrameCounter() % static_cast<uint32_t>(_defaults.machineAcceleration)))
-            {
-                [metalRenderer_ updateTextureData:emulationController->getDisplayBuffer()];
-            }
-        }];
+    EmulationViewController *blockSelf = self;
+    
+    emulationController->setFrameCallback([blockSelf]() {
         
-        [[NSRunLoop mainRunLoop] addTimer:accelerationTimer_ forMode:NSRunLoopCommonModes];
-    }
-    else
-    {
-        [accelerationTimer_ invalidate];
-    }
+        // No point in updating the screen if it hasn't changed since the last frame or isn't visible. Also needed to
+        // stop the app from stalling when brought to the front
+        if (blockSelf->emulationController->getDisplayDirtyRects(blockSelf->dirtyRects_) && !blockSelf->displayUpdatePending_.exchange(true))
+        {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                blockSelf->displayUpdatePending_ = false;
+                if (blockSelf.view.window.occlusionState & NSApplicationOcclusionStateVisible)
+                {
+                    [blockSelf->metalRenderer_ updateTextureData:blockSelf->emulationController->acquireDisplayFrame()];
+                    blockSelf->emulationController->releaseDisplayFrame();
+                }
+                else
+                {
+                    // Make sure the frame is uploaded once the window is visible again
+                    blockSelf->emulationController->invalidateDisplay();
+                }
+            });
+        }
+    });
+    
+    emulationController->setEmulationSpeed(_defaults.machineAcceleration);
+    emulationController->startEmulation();
 }
 
 - (void)updateDisplay
 {
-    [metalRenderer_ updateTextureData:emulationController->getDisplayBuffer()];
+    [metalRenderer_ updateTextureData:emulationController->acquireDisplayFrame()];
+    emulationController->releaseDisplayFrame();
     
 //    if (_debugger && _debugViewController) {
 //        if (!_debugViewController.view.isHidden) {
@@ -194,9 +180,7 @@ const int cSCREEN_FILL              = 1;
     
     smartLink_ = [[SmartLink alloc] init];
     
-    // The AudioCore uses the sound buffer to identify when a new frame should be drawn for accurate timing. The AudioQueue
-    // is used to help measure usage of the audio buffer
-    audioQueue_ = new AudioQueue();
+    // Frames are paced by the emulation controller's own thread, the AudioCore just plays the audio it queues
     self.audioCore = [[AudioCore alloc] initWithSampleRate:cAUDIO_SAMPLE_RATE framesPerSecond:cFRAMES_PER_SECOND callback:(id <EmulationProtocol>)self];
     
     emulationController = new EmulationController();
@@ -211,11 +195,7 @@ const int cSCREEN_FILL              = 1;
     [self setupKeyMappings];
         
     [self restoreSession];
-    
-    if (_defaults.machineAcceleration > 1)
-    {
-        [self setupAccelerationTimer];
-    }
+    [self setupEmulation];
 }
 
 - (void)viewWillAppear
@@ -259,6 +239,7 @@ const int cSCREEN_FILL              = 1;
     [self.defaults addObserver:self forKeyPath:MachineAcceleration options:NSKeyValueObservingOptionNew context:NULL];
     [self.defaults addObserver:self forKeyPath:MachineSelectedModel options:NSKeyValueObservingOptionNew context:NULL];
     [self.defaults addObserver:self forKeyPath:MachineTapeInstantLoad options:NSKeyValueObservingOptionNew context:NULL];
+    [self.defaults addObserver:self forKeyPath:MachineTapeFlashLoad options:NSKeyValueObservingOptionNew context:NULL];
     [self.defaults addObserver:self forKeyPath:MachineUseAYSound options:NSKeyValueObservingOptionNew context:NULL];
     [self.defaults addObserver:self forKeyPath:MachineUseSpecDRUM options:NSKeyValueObservingOptionNew context:NULL];
     
@@ -275,7 +256,7 @@ const int cSCREEN_FILL              = 1;
 {
     if ([keyPath isEqualToString:MachineAcceleration])
     {
-        [self setupAccelerationTimer];
+        emulationController->setEmulationSpeed(_defaults.machineAcceleration);
     }
     else if ([keyPath isEqualToString:MachineSelectedModel])
     {
@@ -285,6 +266,10 @@ const int cSCREEN_FILL              = 1;
     {
         emulationController->setInstantTapeLoad([change[NSKeyValueChangeNewKey] boolValue]);
     }
+    else if ([keyPath isEqualToString:MachineTapeFlashLoad])
+    {
+        emulationController->setFlashTapeLoad([change[NSKeyValueChangeNewKey] boolValue]);
+    }
     else if ([keyPath isEqualToString:MachineUseAYSound])
     {
         emulationController->setUseAySound([change[NSKeyValueChangeNewKey] boolValue]);
@@ -325,6 +310,7 @@ const int cSCREEN_FILL              = 1;
 - (void)applyDefaults
 {
     emulationController->setInstantTapeLoad(self.defaults.machineTapeInstantLoad);
+    emulationController->setFlashTapeLoad(self.defaults.machineTapeFlashLoad);
     emulationController->setUseAySound(self.defaults.machineUseAYSound);
     emulationController->setUseSpecDrum(self.defaults.machineUseSpecDRUM);
 }
@@ -377,6 +363,7 @@ const int cSCREEN_FILL              = 1;
     
     emulationController->pauseMachine();
     emulationController->createMachineOfType(machineType, [romPath cStringUsingEncoding:NSUTF8StringEncoding]);
+    emulationController->setAudioSampleRate(cAUDIO_SAMPLE_RATE);
     [infoPanelViewController_ displayMessage:[NSString stringWithCString:emulationController->getMachineName() encoding:NSUTF8StringEncoding] duration:5];
 
     if (tapeBrowserViewController_)
@@ -443,7 +430,7 @@ const int cSCREEN_FILL              = 1;
     NSOpenPanel *openPanel = [NSOpenPanel new];
     openPanel.canChooseDirectories = NO;
     openPanel.allowsMultipleSelection = NO;
-    openPanel.allowedFileTypes = @[cSNA_EXTENSION, cZ80_EXTENSION, cTAP_EXTENSION];
+    openPanel.allowedFileTypes = @[cSNA_EXTENSION, cZ80_EXTENSION, cTAP_EXTENSION, cTZX_EXTENSION, cPZX_EXTENSION];
     
     [openPanel beginWithCompletionHandler:^(NSModalResponse result) {
         if (result == NSModalResponseOK)
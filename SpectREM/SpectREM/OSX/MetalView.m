@@ -45,6 +45,10 @@
             if ([extension isEqualToString:cZ80_EXTENSION] ||
                 [extension isEqualToString:cSNA_EXTENSION] ||
                 [extension isEqualToString:cTAP_EXTENSION] ||
+            [extension isEqualToString:cTZX_EXTENSION] ||
+            [extension isEqualToString:cPZX_EXTENSION] ||
+                [extension isEqualToString:cTZX_EXTENSION] ||
+                [extension isEqualToString:cPZX_EXTENSION] ||
                 [extension isEqualToString:cSCR_EXTENSION])
             {
                 return NSDragOperationCopy;
@@ -68,6 +72,8 @@
         if ([extension isEqualToString:cZ80_EXTENSION] ||
             [extension isEqualToString:cSNA_EXTENSION] ||
             [extension isEqualToString:cTAP_EXTENSION] ||
+            [extension isEqualToString:cTZX_EXTENSION] ||
+            [extension isEqualToString:cPZX_EXTENSION] ||
             [extension isEqualToString:cSCR_EXTENSION])
         {
             id <EmulationProtocol> emulationViewController = (id <EmulationProtocol>)[self.window contentViewController];
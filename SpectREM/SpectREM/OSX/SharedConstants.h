@@ -12,6 +12,8 @@
 NSString *const cSNA_EXTENSION = @"SNA";
 NSString *const cZ80_EXTENSION = @"Z80";
 NSString *const cTAP_EXTENSION = @"TAP";
+NSString *const cTZX_EXTENSION = @"TZX";
+NSString *const cPZX_EXTENSION = @"PZX";
 NSString *const cSCR_EXTENSION = @"SCR";
 
 // ------------------------------------------------------------------------------------------------------------
@@ -27,7 +27,7 @@
 #include "..\Emulation Core\ZX_Spectrum_48k\ZXSpectrum48.hpp"
 #include "..\Emulation Core\ZX_Spectrum_128k\ZXSpectrum128.hpp"
 #include "..\Emulation Core\Tape\Tape.hpp"
-#include "..\OSX\AudioQueue.hpp"
+#include "..\Emulation Core\Audio_Queue\AudioQueue.hpp"
 #include "OpenGLView.hpp"
 #include "../../resource.h"
 #include "PMDawn.cpp"
@@ -93,6 +93,7 @@ HWND statusWindow;
 //HWND tapeViewerWindow;
 HMENU mainMenu;
 bool TurboMode = false;
+const int TURBO_FRAMES_PER_UPDATE = 8;
 bool menuDisplayed = true;
 bool statusDisplayed = true;
 uint8_t zoomLevel = 3;
@@ -357,7 +358,7 @@ static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lpara
         {
         case PM_UPDATESPECTREM:
             Sleep(50);
-            m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+            m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
             PMDawn::Log(PMDawn::LOG_DEBUG, "Changed slideshow image");
             break;
         }
@@ -475,7 +476,7 @@ static void OpenSCR()
         if (sR.success)
         {
             Sleep(1);
-            m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+            m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
             PMDawn::Log(PMDawn::LOG_INFO, "Loaded .scr file - " + std::string(szFile));
         }
         else
@@ -534,13 +535,13 @@ static void IterateSCRImagesOnTimerCallback()
         int randomIndex = (int)rand() % fileList.size();
         ZXSpectrum::Response sR = m_pMachine->scrLoadWithPath(PMDawn::GetApplicationBasePath() + slideshowDirectory + fileList[randomIndex]);
         Sleep(1);
-        m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+        m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
     }
     else
     {
         ZXSpectrum::Response sR = m_pMachine->scrLoadWithPath(PMDawn::GetApplicationBasePath() + slideshowDirectory + fileList[fileListIndex]);
         Sleep(1);
-        m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+        m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
         fileListIndex++;
         if (fileListIndex >= fileList.size())
         {
@@ -789,11 +790,24 @@ static void audio_callback(uint32_t nNumSamples, uint8_t* pBuffer)
             // Check if we have used a frames worth of buffer storage and if so then its time to generate another frame.
             if (m_pAudioQueue->bufferUsed() < ((44100 * 2) / 50))
             {
-                m_pMachine->generateFrame();
+                if (TurboMode)
+                {
+                    // Run a batch of frames without producing audio, only drawing the last one as that is the only
+                    // one that will be seen. Nothing is queued so the next callback runs another batch straight away
+                    for (int i = 1; i < TURBO_FRAMES_PER_UPDATE; i++)
+                    {
+                        m_pMachine->generateFrame(false, false);
+                    }
+                    m_pMachine->generateFrame(true, false);
+                }
+                else
+                {
+                    m_pMachine->generateFrame();
 
-                //			m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+                    //			m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
 
-                m_pAudioQueue->write(m_pMachine->audioBuffer, ((44100 * 2) / 50));
+                    m_pAudioQueue->write(m_pMachine->audioBuffer, m_pMachine->getLastAudioBufferIndex());
+                }
             }
         }
     }
@@ -940,7 +954,7 @@ int __stdcall WinMain(HINSTANCE inst, HINSTANCE prev, LPSTR cmd, int ncmd)
             {
                 last_time = time;
 
-                m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+                m_pOpenGLView->UpdateTextureData(static_cast<unsigned char *>(m_pMachine->getScreenBuffer()));
 
                 // Set the time
                 char specType[20];
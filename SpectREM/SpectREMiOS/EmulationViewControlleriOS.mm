@@ -177,14 +177,14 @@ NSString  *const cSESSION_FILE_NAME = @"session.z80";
         {
             _machine->generateFrame();
             [_metalRenderer updateTextureData:_machine->getScreenBuffer()];
-            _audioQueue->write(_machine->audioBuffer, b);
+            _audioQueue->write(_machine->audioBuffer, _machine->getLastAudioBufferIndex());
         }
     }
 }
 
 - (void)updateDisplay
 {
-    [_metalRenderer updateTextureData:_machine->displayBuffer];
+    [_metalRenderer updateTextureData:_machine->getScreenBuffer()];
 }
 
 #pragma mark - View Methods